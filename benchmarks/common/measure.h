@@ -0,0 +1,45 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_BENCHMARKS_COMMON_MEASURE_H__
+#define __MIF_BENCHMARKS_COMMON_MEASURE_H__
+
+// STD
+#include <chrono>
+#include <cstddef>
+#include <iomanip>
+#include <iostream>
+#include <string>
+
+namespace Bench
+{
+
+    // Runs the function once to warm up and then the given number of times.
+    // Prints and returns the total time of the measured runs.
+    template <typename TFunc>
+    std::chrono::microseconds Measure(std::string const &name, std::size_t runs, TFunc func)
+    {
+        func();
+
+        auto const start = std::chrono::steady_clock::now();
+
+        for (std::size_t i = 0 ; i < runs ; ++i)
+            func();
+
+        auto const time = std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+
+        std::cout << std::left << std::setw(56) << name << " "
+                << std::right << std::setw(10) << std::fixed << std::setprecision(1) << (time.count() / 1000.0) << " ms"
+                << " (" << runs << " runs, " << std::setprecision(3) << (static_cast<double>(time.count()) / (runs ? runs : 1))
+                << " us/run)" << std::endl;
+
+        return time;
+    }
+
+}   // namespace Bench
+
+#endif  // !__MIF_BENCHMARKS_COMMON_MEASURE_H__
@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// MIF
+#include "mif/db/iconnection.h"
+#include "mif/db/id/service.h"
+#include "mif/db/istatement.h"
+#include "mif/service/create.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace
+{
+
+    std::string GetEnv(char const *name, std::string const &defaultValue)
+    {
+        auto const *value = std::getenv(name);
+        return value && *value ? value : defaultValue;
+    }
+
+}   // namespace
+
+// Inserts the same rows by the separate executions and by Statement::ExecuteBatch, which sends them
+// by the pipelined portions. The server is taken from the same variables as the tests use:
+// MIF_TEST_PG_HOST, MIF_TEST_PG_PORT, MIF_TEST_PG_USER, MIF_TEST_PG_PASSWORD and MIF_TEST_PG_DB.
+int main()
+{
+    auto const host = GetEnv("MIF_TEST_PG_HOST", {});
+    if (host.empty())
+    {
+        std::cout << "MIF_TEST_PG_HOST is not set. The benchmark is skipped." << std::endl;
+        return EXIT_SUCCESS;
+    }
+
+    try
+    {
+        std::size_t const rows = 10000;
+        std::size_t const runs = 5;
+
+        auto connection = Mif::Service::Create<Mif::Db::Id::Service::PostgreSQL, Mif::Db::IConnection>(
+                host,
+                static_cast<std::uint16_t>(std::stoi(GetEnv("MIF_TEST_PG_PORT", "5432"))),
+                GetEnv("MIF_TEST_PG_USER", "postgres"),
+                GetEnv("MIF_TEST_PG_PASSWORD", {}),
+                GetEnv("MIF_TEST_PG_DB", "postgres"),
+                std::uint32_t{10}
+            );
+
+        connection->ExecuteDirect("create temporary table mif_bench_batch (id integer, name text);");
+
+        std::vector<Mif::Db::Parameters> batch;
+        batch.reserve(rows);
+        for (std::size_t i = 0 ; i < rows ; ++i)
+            batch.push_back({static_cast<std::int32_t>(i), "name"});
+
+        auto statement = connection->CreateStatement("insert into mif_bench_batch (id, name) values ($1, $2);");
+
+        // Both are run in a transaction, so only the round trips differ.
+        Bench::Measure("Execute, " + std::to_string(rows) + " rows", runs, [&]
+                {
+                    connection->ExecuteDirect("begin;");
+                    for (auto const &parameters : batch)
+                        statement->Execute(parameters);
+                    connection->ExecuteDirect("commit;");
+                    connection->ExecuteDirect("truncate mif_bench_batch;");
+                }
+            );
+
+        Bench::Measure("ExecuteBatch, " + std::to_string(rows) + " rows", runs, [&]
+                {
+                    connection->ExecuteDirect("begin;");
+                    statement->ExecuteBatch(batch);
+                    connection->ExecuteDirect("commit;");
+                    connection->ExecuteDirect("truncate mif_bench_batch;");
+                }
+            );
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
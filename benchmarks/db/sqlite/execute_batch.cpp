@@ -0,0 +1,71 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <vector>
+
+// MIF
+#include "mif/db/iconnection.h"
+#include "mif/db/id/service.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
+#include "mif/service/create.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+// Inserts the same rows by the separate executions and by Statement::ExecuteBatch
+// into the in-memory database.
+int main()
+{
+    try
+    {
+        std::size_t const rows = 10000;
+        std::size_t const runs = 10;
+
+        auto connection = Mif::Service::Create<Mif::Db::Id::Service::SQLite, Mif::Db::IConnection>();
+        connection->ExecuteDirect("create table bench (id integer, name text);");
+
+        std::vector<Mif::Db::Parameters> batch;
+        batch.reserve(rows);
+        for (std::size_t i = 0 ; i < rows ; ++i)
+            batch.push_back({static_cast<std::int32_t>(i), "name"});
+
+        auto statement = connection->CreateStatement("insert into bench (id, name) values (?, ?);");
+
+        Bench::Measure("Execute, " + std::to_string(rows) + " rows", runs, [&]
+                {
+                    connection->ExecuteDirect("begin;");
+                    // The statement is stepped by the recordset.
+                    for (auto const &parameters : batch)
+                        statement->Execute(parameters)->Read();
+                    connection->ExecuteDirect("commit;");
+                    connection->ExecuteDirect("delete from bench;");
+                }
+            );
+
+        Bench::Measure("ExecuteBatch, " + std::to_string(rows) + " rows", runs, [&]
+                {
+                    connection->ExecuteDirect("begin;");
+                    statement->ExecuteBatch(batch);
+                    connection->ExecuteDirect("commit;");
+                    connection->ExecuteDirect("delete from bench;");
+                }
+            );
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
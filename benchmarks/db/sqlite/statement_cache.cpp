@@ -0,0 +1,88 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// MIF
+#include "mif/db/iconnection.h"
+#include "mif/db/id/service.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
+#include "mif/service/create.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace
+{
+
+    Mif::Db::IConnectionPtr Connect(std::size_t statementCacheSize)
+    {
+        auto connection = Mif::Service::Create<Mif::Db::Id::Service::SQLite, Mif::Db::IConnection>(
+                std::string{":memory:"}, statementCacheSize);
+
+        connection->ExecuteDirect("create table bench (id integer primary key, name text);");
+
+        std::vector<Mif::Db::Parameters> batch;
+        for (std::int32_t i = 0 ; i < 10000 ; ++i)
+            batch.push_back({i, "name " + std::to_string(i)});
+
+        connection->ExecuteDirect("begin;");
+        connection->CreateStatement("insert into bench (id, name) values (?, ?);")->ExecuteBatch(batch);
+        connection->ExecuteDirect("commit;");
+
+        return connection;
+    }
+
+    void Select(Mif::Db::IStatementPtr statement, std::int32_t id)
+    {
+        auto recordset = statement->Execute({id});
+        if (!recordset->Read() || recordset->GetAsInt32(0) != id)
+            throw std::runtime_error{"No row with id " + std::to_string(id) + "."};
+    }
+
+}   // namespace
+
+// Makes the point selects from the in-memory table, creating the statement for every select
+// with and without the statement cache and creating it once.
+int main()
+{
+    try
+    {
+        std::size_t const runs = 200000;
+        std::string const query = "select id, name from bench where id = ?;";
+
+        std::int32_t id = 0;
+        auto next = [&id] { return id++ % 10000; };
+
+        auto connection = Connect(0);
+        Bench::Measure("CreateStatement per select, cache off", runs,
+                [&] { Select(connection->CreateStatement(query), next()); } );
+
+        connection = Connect(64);
+        Bench::Measure("CreateStatement per select, cache on", runs,
+                [&] { Select(connection->CreateStatement(query), next()); } );
+
+        auto statement = connection->CreateStatement(query);
+        Bench::Measure("One statement for all selects", runs,
+                [&] { Select(statement, next()); } );
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,131 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstddef>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+// MIF
+#include "mif/net/http/router.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace
+{
+
+    // The reference: every route is tried in turn, segment by segment.
+    bool MatchRoute(std::string const &route, std::string const &path)
+    {
+        std::size_t r = 0;
+        std::size_t p = 0;
+
+        for (;;)
+        {
+            while (r < route.size() && route[r] == '/')
+                ++r;
+            while (p < path.size() && path[p] == '/')
+                ++p;
+
+            if (r == route.size() || p == path.size())
+                return r == route.size() && p == path.size();
+
+            auto routeEnd = route.find('/', r);
+            if (routeEnd == std::string::npos)
+                routeEnd = route.size();
+            auto pathEnd = path.find('/', p);
+            if (pathEnd == std::string::npos)
+                pathEnd = path.size();
+
+            if (route[r] != '{' && route.compare(r, routeEnd - r, path, p, pathEnd - p))
+                return false;
+
+            r = routeEnd;
+            p = pathEnd;
+        }
+    }
+
+}   // namespace
+
+// Matches the paths against a few hundred routes of a typical REST service:
+// a static route, a route with a parameter and a nested one with two parameters per resource.
+int main()
+{
+    std::size_t const resources = 100;
+    std::size_t const runs = 200;
+
+    std::vector<std::string> routes;
+    for (std::size_t i = 0 ; i < resources ; ++i)
+    {
+        auto const resource = "/api/v1/resource" + std::to_string(i);
+        routes.push_back(resource);
+        routes.push_back(resource + "/{id}");
+        routes.push_back(resource + "/{id}/items/{item}");
+    }
+
+    Mif::Net::Http::Router router;
+    for (std::size_t i = 0 ; i < routes.size() ; ++i)
+        router.Add(routes[i], i);
+
+    // The hits of every kind spread over the resources and the misses.
+    std::vector<std::string> paths;
+    for (std::size_t i = 0 ; i < resources ; i += 7)
+    {
+        auto const resource = "/api/v1/resource" + std::to_string(i);
+        paths.push_back(resource);
+        paths.push_back(resource + "/12345");
+        paths.push_back(resource + "/12345/items/67");
+        paths.push_back(resource + "/12345/unknown");
+        paths.push_back("/api/v2/resource" + std::to_string(i));
+    }
+
+    std::size_t const lookups = runs * paths.size();
+    std::cout << routes.size() << " routes, " << lookups << " lookups per case." << std::endl;
+
+    std::size_t found = 0;
+
+    auto const routerTime = Bench::Measure("Router::Find", runs, [&]
+            {
+                Mif::Net::Http::Router::Match match;
+                for (auto const &path : paths)
+                    found += router.Find(path, match) ? 1 : 0;
+            }
+        );
+
+    Bench::Measure("Router::FindPrefix", runs, [&]
+            {
+                Mif::Net::Http::Router::Match match;
+                for (auto const &path : paths)
+                    found += router.FindPrefix(path, match) ? 1 : 0;
+            }
+        );
+
+    auto const linearTime = Bench::Measure("Linear scan over the routes (reference)", runs, [&]
+            {
+                for (auto const &path : paths)
+                {
+                    for (auto const &route : routes)
+                    {
+                        if (MatchRoute(route, path))
+                        {
+                            ++found;
+                            break;
+                        }
+                    }
+                }
+            }
+        );
+
+    std::cout << "Router::Find: " << (routerTime.count() * 1000.0 / lookups) << " ns/lookup, "
+            << "the linear scan: " << (linearTime.count() * 1000.0 / lookups) << " ns/lookup." << std::endl;
+
+    // Keeps the results in use.
+    return found ? EXIT_SUCCESS : EXIT_FAILURE;
+}
@@ -0,0 +1,135 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <functional>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <utility>
+
+// MIF
+#include "mif/remote/detail/pending_calls.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace
+{
+
+    using Handler = std::function<void ()>;
+
+    // The former registry of PSClient: the calls are kept by the request id string
+    // and all of them are checked for the expiration on every registration and response.
+    class ScannedCalls final
+    {
+    public:
+        ScannedCalls(std::chrono::microseconds const &timeout)
+            : m_timeout{timeout}
+        {
+        }
+
+        bool Insert(std::string const &requestId, Handler handler)
+        {
+            ExtractExpired();
+            return m_calls.insert(std::make_pair(requestId, Call{Now(), std::move(handler)})).second;
+        }
+
+        bool Extract(std::string const &requestId, Handler &handler)
+        {
+            auto iter = m_calls.find(requestId);
+            if (iter == std::end(m_calls))
+                return false;
+            handler = std::move(iter->second.second);
+            m_calls.erase(iter);
+            ExtractExpired();
+            return true;
+        }
+
+    private:
+        using Call = std::pair<std::chrono::microseconds, Handler>;
+
+        std::chrono::microseconds const m_timeout;
+        std::map<std::string, Call> m_calls;
+
+        static std::chrono::microseconds Now()
+        {
+            return std::chrono::duration_cast<std::chrono::microseconds>(
+                std::chrono::steady_clock::now().time_since_epoch());
+        }
+
+        void ExtractExpired()
+        {
+            auto const now = Now();
+            for (auto i = std::begin(m_calls) ; i != std::end(m_calls) ; )
+            {
+                if (now - i->second.first > m_timeout)
+                    m_calls.erase(i++);
+                else
+                    ++i;
+            }
+        }
+    };
+
+}   // namespace
+
+// Keeps the given number of calls in flight and measures the registration
+// and the completion of one more call.
+int main()
+{
+    try
+    {
+        std::size_t const runs = 20000;
+        auto const timeout = std::chrono::seconds{10};
+
+        for (std::size_t const inFlight : {100, 1000, 10000})
+        {
+            std::uint64_t next = 0;
+
+            Mif::Remote::Detail::PendingCalls<Handler> pendingCalls{timeout};
+            ScannedCalls scannedCalls{timeout};
+            for ( ; next < inFlight ; ++next)
+            {
+                pendingCalls.Insert(next, [] {} );
+                scannedCalls.Insert(std::to_string(next), [] {} );
+            }
+
+            auto const suffix = ", " + std::to_string(inFlight) + " in flight";
+
+            std::uint64_t first = 0;
+            Bench::Measure("Scanned std::map" + suffix, runs, [&]
+                    {
+                        Handler handler;
+                        scannedCalls.Insert(std::to_string(next++), [] {} );
+                        scannedCalls.Extract(std::to_string(first++), handler);
+                    }
+                );
+
+            next = inFlight;
+            first = 0;
+            Bench::Measure("Detail::PendingCalls" + suffix, runs, [&]
+                    {
+                        Handler handler;
+                        pendingCalls.Insert(next++, [] {} );
+                        pendingCalls.Extract(first++, handler);
+                    }
+                );
+        }
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,227 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <chrono>
+#include <condition_variable>
+#include <cstdint>
+#include <cstdlib>
+#include <deque>
+#include <exception>
+#include <future>
+#include <iostream>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// MIF
+#include "mif/net/icontrol.h"
+#include "mif/net/ihandler.h"
+#include "mif/net/ipublisher.h"
+#include "mif/remote/predefined/serialization/boost/binary.h"
+#include "mif/remote/ps.h"
+#include "mif/remote/ps_client.h"
+#include "mif/service/factory.h"
+#include "mif/service/make.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace Bench
+{
+
+    struct ICalculator
+        : public Mif::Service::Inherit<Mif::Service::IService>
+    {
+        virtual std::int32_t Add(std::int32_t x, std::int32_t y) = 0;
+    };
+
+    namespace Meta
+    {
+
+        using namespace ::Bench;
+
+        MIF_REMOTE_PS_BEGIN(ICalculator)
+            MIF_REMOTE_METHOD(Add)
+        MIF_REMOTE_PS_END()
+
+    }   // namespace Meta
+
+}   // namespace Bench
+
+MIF_REMOTE_REGISTER_PS(Bench::Meta::ICalculator)
+
+namespace
+{
+
+    enum : Mif::Service::ServiceId
+    {
+        CalculatorId = 1
+    };
+
+    class Calculator
+        : public Mif::Service::Inherit<Bench::ICalculator>
+    {
+    private:
+        // ICalculator
+        virtual std::int32_t Add(std::int32_t x, std::int32_t y) override final
+        {
+            return x + y;
+        }
+    };
+
+    // Delivers the data to the peer in a thread of its own like a network connection does.
+    class Channel final
+        : public Mif::Net::IPublisher
+        , public Mif::Net::IControl
+    {
+    public:
+        Channel()
+            : m_thread{[this] { Run(); } }
+        {
+        }
+
+        ~Channel()
+        {
+            {
+                std::lock_guard<std::mutex> lock{m_lock};
+                m_stop = true;
+            }
+            m_changed.notify_one();
+            m_thread.join();
+        }
+
+        void SetPeer(std::weak_ptr<Mif::Net::IHandler> peer)
+        {
+            std::lock_guard<std::mutex> lock{m_lock};
+            m_peer = peer;
+        }
+
+    private:
+        std::mutex m_lock;
+        std::condition_variable m_changed;
+        std::deque<Mif::Common::Buffer> m_queue;
+        std::weak_ptr<Mif::Net::IHandler> m_peer;
+        bool m_stop = false;
+        std::thread m_thread;
+
+        void Run()
+        {
+            std::unique_lock<std::mutex> lock{m_lock};
+            while (true)
+            {
+                m_changed.wait(lock, [this] { return m_stop || !m_queue.empty(); } );
+                if (m_stop)
+                    break;
+
+                auto buffer = std::move(m_queue.front());
+                m_queue.pop_front();
+                auto peer = m_peer.lock();
+
+                lock.unlock();
+                if (peer)
+                    peer->OnData(std::move(buffer));
+                lock.lock();
+            }
+        }
+
+        // IPublisher
+        virtual void Publish(Mif::Common::Buffer buffer) override final
+        {
+            {
+                std::lock_guard<std::mutex> lock{m_lock};
+                m_queue.push_back(std::move(buffer));
+            }
+            m_changed.notify_one();
+        }
+
+        // IControl
+        virtual void CloseMe() override final
+        {
+        }
+    };
+
+    using Serialization = Mif::Remote::Predefined::Serialization::Boost::Binary;
+    using Client = Mif::Remote::PSClient<Serialization>;
+    using Proxy = Bench::Meta::ICalculator_PS<Serialization>::Proxy;
+
+}   // namespace
+
+// Makes the calls from many threads, each of them waits for its response,
+// and from one thread which keeps all the calls in flight by the Async methods.
+int main()
+{
+    try
+    {
+        std::size_t const calls = 20000;
+        std::size_t const runs = 5;
+
+        // The channels outlive the clients, the remote objects are released by calls.
+        auto serverChannel = std::make_shared<Channel>();
+        auto clientChannel = std::make_shared<Channel>();
+
+        auto factory = Mif::Service::Make<Mif::Service::Factory, Mif::Service::Factory>();
+        factory->AddInstance(CalculatorId, Mif::Service::Make<Calculator, Mif::Service::IService>());
+
+        auto const timeout = std::chrono::seconds{10};
+        auto server = std::make_shared<Client>(serverChannel, serverChannel, timeout,
+                Mif::Service::Cast<Mif::Service::IFactory>(factory));
+        auto client = std::make_shared<Client>(clientChannel, clientChannel, timeout);
+
+        serverChannel->SetPeer(client);
+        clientChannel->SetPeer(server);
+
+        auto service = client->CreateService<Bench::ICalculator>(CalculatorId);
+        auto &proxy = dynamic_cast<Proxy &>(*service);
+
+        for (std::size_t const threads : {1, 8, 64})
+        {
+            Bench::Measure("Sync calls, " + std::to_string(threads) + " threads, " + std::to_string(calls) + " calls", runs, [&]
+                    {
+                        std::vector<std::thread> workers;
+                        for (std::size_t i = 0 ; i < threads ; ++i)
+                        {
+                            workers.emplace_back([&]
+                                    {
+                                        for (std::size_t j = 0 ; j < calls / threads ; ++j)
+                                            service->Add(1, 2);
+                                    }
+                                );
+                        }
+
+                        for (auto &worker : workers)
+                            worker.join();
+                    }
+                );
+        }
+
+        Bench::Measure("Async calls, 1 thread, " + std::to_string(calls) + " calls in flight", runs, [&]
+                {
+                    std::vector<std::future<std::int32_t>> results;
+                    results.reserve(calls);
+                    for (std::size_t i = 0 ; i < calls ; ++i)
+                        results.push_back(proxy.AddAsync(1, 2));
+
+                    for (auto &result : results)
+                        result.get();
+
+                    // The response handlers hold the proxy and are released in the channel thread
+                    // after the futures are ready. The next response comes in the same thread,
+                    // so the last proxy is not released there at exit.
+                    service->Add(1, 2);
+                }
+            );
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
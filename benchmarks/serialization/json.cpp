@@ -0,0 +1,127 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+#include <exception>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/reflection/reflect_type.h"
+#include "mif/serialization/json.h"
+#include "mif/serialization/json_stream.h"
+
+// BENCHMARKS
+#include "common/measure.h"
+
+namespace Bench
+{
+
+    struct Address
+    {
+        std::string city;
+        std::string street;
+        std::int32_t building = 0;
+    };
+
+    struct Record
+    {
+        std::int64_t id = 0;
+        std::string name;
+        std::string email;
+        double score = 0;
+        bool active = false;
+        Address address;
+        std::vector<std::string> tags;
+    };
+
+    MIF_REFLECT_BEGIN(Address)
+        MIF_REFLECT_FIELD(city)
+        MIF_REFLECT_FIELD(street)
+        MIF_REFLECT_FIELD(building)
+    MIF_REFLECT_END()
+
+    MIF_REFLECT_BEGIN(Record)
+        MIF_REFLECT_FIELD(id)
+        MIF_REFLECT_FIELD(name)
+        MIF_REFLECT_FIELD(email)
+        MIF_REFLECT_FIELD(score)
+        MIF_REFLECT_FIELD(active)
+        MIF_REFLECT_FIELD(address)
+        MIF_REFLECT_FIELD(tags)
+    MIF_REFLECT_END()
+
+}   // namespace Bench
+
+MIF_REGISTER_REFLECTED_TYPE(Bench::Address)
+MIF_REGISTER_REFLECTED_TYPE(Bench::Record)
+
+// Writes and reads the array of reflected records by the jsoncpp DOM serializer
+// and by the streaming one. Both of them make the same document.
+int main()
+{
+    try
+    {
+        std::size_t const count = 100000;
+        std::size_t const runs = 5;
+
+        using Records = std::vector<Bench::Record>;
+
+        Records records(count);
+        for (std::size_t i = 0 ; i < count ; ++i)
+        {
+            auto &record = records[i];
+            record.id = static_cast<std::int64_t>(i);
+            record.name = "Name " + std::to_string(i);
+            record.email = "user" + std::to_string(i) + "@example.com";
+            record.score = i * 0.25;
+            record.active = i % 2 == 0;
+            record.address.city = "City";
+            record.address.street = "Street " + std::to_string(i % 100);
+            record.address.building = static_cast<std::int32_t>(i % 1000);
+            record.tags = {"first", "second", "third"};
+        }
+
+        auto const suffix = ", " + std::to_string(count) + " records";
+
+        Mif::Common::Buffer dom;
+        Bench::Measure("Json::Serialize" + suffix, runs,
+                [&] { dom = Mif::Serialization::Json::Serialize(records); } );
+
+        Mif::Common::Buffer stream;
+        Bench::Measure("JsonStream::Serialize" + suffix, runs,
+                [&] { stream = Mif::Serialization::JsonStream::Serialize(records); } );
+
+        // Each serializer reads the document of the other one. A mutable buffer is taken for a stream.
+        auto const &domData = dom;
+        auto const &streamData = stream;
+
+        Records result;
+        Bench::Measure("Json::Deserialize" + suffix, runs,
+                [&] { result = Mif::Serialization::Json::Deserialize<Records>(streamData); } );
+        if (result.size() != count || result.back().email != records.back().email)
+            throw std::runtime_error{"The DOM serializer has read other records."};
+
+        result.clear();
+        Bench::Measure("JsonStream::Deserialize" + suffix, runs,
+                [&] { result = Mif::Serialization::JsonStream::Deserialize<Records>(domData); } );
+        if (result.size() != count || result.back().tags != records.back().tags)
+            throw std::runtime_error{"The streaming serializer has read other records."};
+    }
+    catch (std::exception const &e)
+    {
+        std::cerr << "Error: " << e.what() << std::endl;
+        return EXIT_FAILURE;
+    }
+
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,66 @@
+if (MIF_BUILD_BENCHMARKS)
+    if (NOT MIF_STATIC_LIBS)
+        message (FATAL_ERROR "[MIF] The benchmarks are linked with the static library. Set MIF_STATIC_LIBS=ON.")
+    endif()
+
+    # The benchmarks are not run by ctest. They print the time of every case and are run by hand
+    # on a release build, e.g. bin/mif_bench_db_sqlite_execute_batch.
+    set (MIF_BENCHMARKS_LIBRARIES
+        ${PROJECT_LC}
+        ${BOOST_LIBRARIES}
+        ${JSONCPP_LIBRARIES}
+        ${ZLIB_LIBRARIES}
+        ${EVENT_LIBRARIES}
+        ${PUGIXML_LIBRARIES}
+    )
+
+    set (MIF_BENCHMARKS_SOURCES
+        ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/net/http/router.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/remote/pending_calls.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/remote/ps_client.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/serialization/json.cpp
+    )
+
+    if (MIF_WITH_SQLITE)
+        set (MIF_BENCHMARKS_LIBRARIES
+            ${MIF_BENCHMARKS_LIBRARIES}
+            ${SQLITE_LIBRARIES}
+        )
+
+        set (MIF_BENCHMARKS_SOURCES
+            ${MIF_BENCHMARKS_SOURCES}
+            ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/db/sqlite/execute_batch.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/db/sqlite/statement_cache.cpp
+        )
+    endif()
+
+    if (MIF_WITH_POSTGRESQL)
+        set (MIF_BENCHMARKS_LIBRARIES
+            ${MIF_BENCHMARKS_LIBRARIES}
+            ${LIBPQ_LIBRARIES}
+        )
+
+        set (MIF_BENCHMARKS_SOURCES
+            ${MIF_BENCHMARKS_SOURCES}
+            ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks/db/postgresql/execute_batch.cpp
+        )
+    endif()
+
+    set (MIF_BENCHMARKS_LIBRARIES
+        ${MIF_BENCHMARKS_LIBRARIES}
+        pthread
+        rt
+    )
+
+    # The name is made of the path, e.g. benchmarks/db/sqlite/execute_batch.cpp is mif_bench_db_sqlite_execute_batch.
+    foreach (source ${MIF_BENCHMARKS_SOURCES})
+        file (RELATIVE_PATH name ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks ${source})
+        string (REGEX REPLACE "\\.cpp$" "" name ${name})
+        string (REPLACE "/" "_" name ${name})
+        set (name "${PROJECT_LC}_bench_${name}")
+
+        add_executable (${name} ${source})
+        target_include_directories (${name} PRIVATE ${CMAKE_CURRENT_SOURCE_DIR}/benchmarks)
+        target_link_libraries (${name} ${MIF_BENCHMARKS_LIBRARIES})
+    endforeach()
+endif()
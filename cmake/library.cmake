@@ -20,7 +20,9 @@ set(MIF_SOURCES
     # Common
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/common/log.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/common/thread_pool.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/common/timer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/common/uuid_generator.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/common/id_generator.cpp
 
     # Service
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/service/locator.cpp
@@ -37,21 +39,29 @@ set(MIF_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/frame_writer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/gzip_decompressor.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/gzip_compressor.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/compressor.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/decompressor.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/detail/zlib_stream.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/clients/parallel_handler.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/tcp/server.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/tcp/clients.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/tcp/connection.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/tcp/detail/session.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/tcp/detail/buffer_pool.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/server.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/server_thread.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/lib_event_initializer.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/server.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/input_pack.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/output_pack.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/async_output_pack.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/dispatcher.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/utility.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/detail/client_engine.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/connection.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/servlet.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/web_service.cpp
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/router.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/net/http/clients.cpp
 
     # Application
@@ -64,6 +74,7 @@ set(MIF_SOURCES
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/application/config/xml.cpp
 
     # DB
+    ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/parameters.cpp
     ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/transaction.cpp
 )
 
@@ -72,7 +83,9 @@ if (MIF_WITH_SQLITE)
         ${MIF_SOURCES}
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/sqlite/connection.cpp
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/sqlite/detail/statement.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/sqlite/detail/statement_cache.cpp
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/sqlite/detail/recordset.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/sqlite/detail/bulk_writer.cpp
         )
 endif()
 
@@ -83,7 +96,11 @@ if (MIF_WITH_POSTGRESQL)
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/connection.cpp
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/detail/statement.cpp
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/detail/recordset.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/detail/parameters.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/detail/values.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/detail/copy.cpp
             ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/connection_pool.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/src/mif/db/postgresql/async_connection.cpp
         )
 endif()
 
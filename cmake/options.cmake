@@ -6,3 +6,5 @@ option (MIF_WITH_POSTGRESQL "[MIF] Support working with PostgreSQL library (libp
 # MIF library options
 option (MIF_STATIC_LIBS "[MIF] Create static libs" ON)
 option (MIF_SHARED_LIBS "[MIF] Create shared libs" OFF)
+option (MIF_BUILD_TESTS "[MIF] Build tests" OFF)
+option (MIF_BUILD_BENCHMARKS "[MIF] Build benchmarks" OFF)
@@ -0,0 +1,70 @@
+if (MIF_BUILD_TESTS)
+    if (NOT MIF_STATIC_LIBS)
+        message (FATAL_ERROR "[MIF] The tests are linked with the static library. Set MIF_STATIC_LIBS=ON.")
+    endif()
+
+    enable_testing ()
+
+    # The tests use the header-only runner of Boost.Test, so no more libraries are needed.
+    set (MIF_TESTS_LIBRARIES
+        ${PROJECT_LC}
+        ${BOOST_LIBRARIES}
+        ${JSONCPP_LIBRARIES}
+        ${ZLIB_LIBRARIES}
+        ${EVENT_LIBRARIES}
+        ${PUGIXML_LIBRARIES}
+    )
+
+    set (MIF_TESTS_SOURCES
+        ${CMAKE_CURRENT_SOURCE_DIR}/tests/net/clients/frame.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/tests/net/http/router.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/tests/net/tcp/buffer_pool.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/tests/remote/ps.cpp
+        ${CMAKE_CURRENT_SOURCE_DIR}/tests/service/pool.cpp
+    )
+
+    if (MIF_WITH_SQLITE)
+        set (MIF_TESTS_LIBRARIES
+            ${MIF_TESTS_LIBRARIES}
+            ${SQLITE_LIBRARIES}
+        )
+
+        set (MIF_TESTS_SOURCES
+            ${MIF_TESTS_SOURCES}
+            ${CMAKE_CURRENT_SOURCE_DIR}/tests/db/mapper.cpp
+        )
+    endif()
+
+    if (MIF_WITH_POSTGRESQL)
+        set (MIF_TESTS_LIBRARIES
+            ${MIF_TESTS_LIBRARIES}
+            ${LIBPQ_LIBRARIES}
+        )
+
+        set (MIF_TESTS_SOURCES
+            ${MIF_TESTS_SOURCES}
+            ${CMAKE_CURRENT_SOURCE_DIR}/tests/db/postgresql/async_connection.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/tests/db/postgresql/connection_pool.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/tests/db/postgresql/recordset.cpp
+            ${CMAKE_CURRENT_SOURCE_DIR}/tests/db/postgresql/statement.cpp
+        )
+    endif()
+
+    set (MIF_TESTS_LIBRARIES
+        ${MIF_TESTS_LIBRARIES}
+        pthread
+        rt
+    )
+
+    # The test name is made of its path, e.g. tests/db/postgresql/recordset.cpp is mif_test_db_postgresql_recordset.
+    foreach (source ${MIF_TESTS_SOURCES})
+        file (RELATIVE_PATH name ${CMAKE_CURRENT_SOURCE_DIR}/tests ${source})
+        string (REGEX REPLACE "\\.cpp$" "" name ${name})
+        string (REPLACE "/" "_" name ${name})
+        set (name "${PROJECT_LC}_test_${name}")
+
+        add_executable (${name} ${source})
+        target_link_libraries (${name} ${MIF_TESTS_LIBRARIES})
+        add_test (NAME ${name} COMMAND ${name})
+    endforeach()
+endif()
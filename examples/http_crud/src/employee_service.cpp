@@ -220,14 +220,14 @@ namespace Service
         if (offset)
         {
             sql += "OFFSET $1::integer ";
-            params.push_back(std::to_string(offset.Get()));
+            params.push_back(offset.Get());
         }
 
         if (limit)
         {
             auto const index = !offset ? 1 : 2;
             sql += "LIMIT $" + std::to_string(index) + "::integer ";
-            params.push_back(std::to_string(limit.Get()));
+            params.push_back(limit.Get());
         }
 
         sql += ";";
@@ -208,14 +208,14 @@ namespace Storage
                         if (offset != std::numeric_limits<std::size_t>::max())
                         {
                             sql += "OFFSET $1::integer ";
-                            params.push_back(std::to_string(offset));
+                            params.push_back(offset);
                         }
 
                         if (limit != std::numeric_limits<std::size_t>::max())
                         {
                             auto const index = offset == std::numeric_limits<std::size_t>::max() ? 1 : 2;
                             sql += "LIMIT $" + std::to_string(index) + "::integer ";
-                            params.push_back(std::to_string(limit));
+                            params.push_back(limit);
                         }
 
                         sql += ";";
@@ -9,10 +9,12 @@
 #define __MIF_APPLICATION_HTTP_SERVER_H__
 
 // STD
+#include <cstdint>
 #include <memory>
 
 // MIF
 #include "mif/application/net_base_application.h"
+#include "mif/common/thread_pool.h"
 #include "mif/net/http/server.h"
 
 namespace Mif
@@ -33,10 +35,13 @@ namespace Mif
 
         protected:
             virtual void Init(Net::Http::ServerHandlers &handlers);
+            virtual void InitAsync(Net::Http::ServerAsyncHandlers &handlers);
             virtual void Done();
 
         private:
             Net::Http::Methods m_methods;
+            std::uint16_t m_handlerWorkers = 0;
+            Common::IThreadPoolPtr m_handlersPool;
             std::unique_ptr<Net::Http::Server> m_server;
 
             // NetBaseApplication
@@ -35,6 +35,9 @@ namespace Mif
             std::string GetPort() const;
             std::uint16_t GetWorkers() const;
             std::chrono::microseconds GetTimeout() const;
+            // The "server" branch of the configuration, it is null without the branch.
+            // The derived applications read their own options from it.
+            IConfigPtr GetServerConfig() const;
 
         private:
             std::string m_host;
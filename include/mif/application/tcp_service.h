@@ -44,6 +44,8 @@ namespace Mif
 
         private:
             ClientFactory m_clientFactory;
+            std::uint16_t m_ioWorkers = 1;
+            bool m_reusePort = false;
             std::unique_ptr<Net::Tcp::Server> m_server;
 
             // NetBaseApplication
@@ -64,10 +64,17 @@ namespace Mif
 
         typedef Crc32TableHolderT<void> Crc32TableHolder;
 
+        inline constexpr std::uint32_t Crc32Step(std::uint32_t crc, char ch)
+        {
+            return (crc >> 8) ^ Crc32TableHolder::Table.m_data[(crc ^ ch) & 0x000000FF];
+        }
+
+        // The previous value is calculated once per character. It keeps
+        // the compile-time calculation linear for long strings.
         template<std::uint32_t const I>
         inline constexpr std::uint32_t Crc32(char const *str)
         {
-            return (Crc32<I - 1>(str) >> 8) ^ Crc32TableHolder::Table.m_data[(Crc32<I - 1>(str) ^ str[I - 1]) & 0x000000FF];
+            return Crc32Step(Crc32<I - 1>(str), str[I - 1]);
         }
 
         template<>
@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_COMMON_ID_GENERATOR_H__
+#define __MIF_COMMON_ID_GENERATOR_H__
+
+// STD
+#include <atomic>
+#include <cstdint>
+
+namespace Mif
+{
+    namespace Common
+    {
+
+        // Generates 64-bit ids: a random start value plus a counter.
+        // The random start keeps the ids of different generators apart.
+        class IdGenerator final
+        {
+        public:
+            IdGenerator();
+
+            IdGenerator(IdGenerator const &) = delete;
+            IdGenerator& operator = (IdGenerator const &) = delete;
+
+            std::uint64_t Generate();
+
+        private:
+            std::atomic<std::uint64_t> m_next;
+        };
+
+    }   // namespace Common
+}   // namespace Mif
+
+#endif  // !__MIF_COMMON_ID_GENERATOR_H__
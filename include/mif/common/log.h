@@ -9,10 +9,20 @@
 #define __MIF_COMMON_LOG_H__
 
 // STD
-#include <sstream>
+#include <atomic>
+#include <ostream>
 #include <utility>
 
-#define MIF_LOG(level_) Logger(::Mif::Common::Log::Level :: level_ )
+// The most verbose level which is compiled in. The records above it are removed by the compiler.
+#ifndef MIF_LOG_MAX_LEVEL
+    #define MIF_LOG_MAX_LEVEL Trace
+#endif  // !MIF_LOG_MAX_LEVEL
+
+// The level is checked before the record is formatted, so a disabled record costs one comparison.
+#define MIF_LOG(level_) \
+    !::Mif::Common::Log::IsEnabled(::Mif::Common::Log::Level :: level_ ) ? \
+        static_cast<void>(0) : \
+        ::Mif::Common::Log::Voidify{} & Logger(::Mif::Common::Log::Level :: level_ )
 
 namespace Mif
 {
@@ -31,8 +41,15 @@ namespace Mif
                 Trace
             };
 
-            Log(Log &&) = default;
-            Log& operator = (Log &&) = default;
+            struct Voidify
+            {
+                void operator & (Log const &) const
+                {
+                }
+            };
+
+            Log(Log &&other) noexcept;
+            Log& operator = (Log &&) = delete;
             Log(Log const &) = delete;
             Log& operator = (Log const &) = delete;
 
@@ -40,10 +57,18 @@ namespace Mif
 
             friend Log Logger(Level const &level);
 
+            static bool IsEnabled(Level const &level)
+            {
+                return level <= Level::MIF_LOG_MAX_LEVEL && level <= m_maxLevel.load(std::memory_order_relaxed);
+            }
+
+            static void SetLevel(Level const &level);
+
             template <typename T>
             Log& operator << (T && data)
             {
-                m_stream << std::forward<T>(data);
+                if (m_stream)
+                    *m_stream << std::forward<T>(data);
                 return *this;
             }
 
@@ -51,7 +76,10 @@ namespace Mif
             class Impl;
             Impl &m_impl;
             Level m_level;
-            std::stringstream m_stream;
+            // The formatting buffer is taken from the pool of the current thread.
+            std::ostream *m_stream = nullptr;
+
+            static std::atomic<Level> m_maxLevel;
 
             Log(Level const &level);
         };
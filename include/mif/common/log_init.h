@@ -20,12 +20,31 @@ namespace Mif
     namespace Common
     {
 
+        // What to do with a record when the queue of the background writer is full.
+        // The error and fatal records always wait for the free space.
+        enum class LogOverflow
+        {
+            Drop,
+            Block
+        };
+
+        struct LogCounters
+        {
+            std::uint64_t written;
+            std::uint64_t dropped;
+        };
+
         void InitConsoleLog(Log::Level const &level = Log::Level::Trace);
 
         void InitFileLog(Log::Level const &level,
             std::string const &logDir, std::string const &filePattern,
             std::size_t maxSize = 1, std::size_t maxCount = 10);
 
+        void SetLogOverflow(LogOverflow overflow);
+        LogCounters GetLogCounters();
+        // Waits until all the records posted before the call are written.
+        void FlushLog();
+
     }   // namespace Common
 }   // namespace Mif
 
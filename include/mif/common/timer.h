@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_COMMON_TIMER_H__
+#define __MIF_COMMON_TIMER_H__
+
+// STD
+#include <chrono>
+#include <functional>
+#include <memory>
+
+namespace Mif
+{
+    namespace Common
+    {
+
+        // Calls the task with the period in a thread shared by all the timers.
+        // The task is not called any more after the timer is destroyed.
+        class PeriodicTimer final
+        {
+        public:
+            using Task = std::function<void ()>;
+
+            PeriodicTimer(std::chrono::microseconds const &period, Task task);
+            ~PeriodicTimer();
+
+            PeriodicTimer(PeriodicTimer const &) = delete;
+            PeriodicTimer(PeriodicTimer &&) = delete;
+            PeriodicTimer& operator = (PeriodicTimer const &) = delete;
+            PeriodicTimer& operator = (PeriodicTimer &&) = delete;
+
+        private:
+            class Impl;
+            std::shared_ptr<Impl> m_impl;
+        };
+
+    }   // namespace Common
+}   // namespace Mif
+
+#endif  // !__MIF_COMMON_TIMER_H__
@@ -0,0 +1,140 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_BULK_H__
+#define __MIF_DB_BULK_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// MIF
+#include "mif/db/detail/mapper.h"
+#include "mif/db/iconnection.h"
+#include "mif/db/mapper.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        // Loads the reflected objects into a table. The table columns are named as the fields.
+        // PostgreSQL sends the rows by COPY, SQLite inserts them in one transaction.
+        template <typename T>
+        class BulkWriter final
+        {
+        public:
+            BulkWriter(IConnectionPtr connection, std::string const &table)
+            {
+                if (!connection)
+                    throw std::invalid_argument{"[Mif::Db::BulkWriter] Empty connection pointer."};
+
+                m_writer = connection->CreateBulkWriter(table, GetColumns<T>());
+            }
+
+            void Write(T const &object)
+            {
+                m_row.clear();
+                Detail::Mapping::Object<T>::Write(m_row, object);
+                m_writer->Write(m_row);
+            }
+
+            template <typename TIterator>
+            void Write(TIterator first, TIterator last)
+            {
+                for ( ; first != last ; ++first)
+                    Write(*first);
+            }
+
+            // Without it the load is discarded when the writer is destroyed.
+            std::uint64_t Finish()
+            {
+                return m_writer->Finish();
+            }
+
+        private:
+            IBulkWriterPtr m_writer;
+            Parameters m_row;
+        };
+
+        // Reads the reflected objects from a table. The rows are received one by one,
+        // so the memory does not depend on the size of the table.
+        template <typename T>
+        class BulkReader final
+        {
+        public:
+            BulkReader(IConnectionPtr connection, std::string const &table)
+                : BulkReader{connection, table, std::string{}}
+            {
+            }
+
+            // The condition is put into the where clause.
+            BulkReader(IConnectionPtr connection, std::string const &table, std::string const &condition)
+            {
+                if (!connection)
+                    throw std::invalid_argument{"[Mif::Db::BulkReader] Empty connection pointer."};
+
+                if (table.empty())
+                    throw std::invalid_argument{"[Mif::Db::BulkReader] Empty table name."};
+
+                std::string query = "select ";
+
+                auto const columns = GetColumns<T>();
+                for (std::size_t i = 0 ; i < columns.size() ; ++i)
+                {
+                    if (i)
+                        query += ", ";
+                    query += columns[i];
+                }
+
+                query += " from " + table;
+
+                if (!condition.empty())
+                    query += " where " + condition;
+
+                m_recordset = connection->CreateBulkReader(query);
+            }
+
+            bool Read(T &object)
+            {
+                if (!m_recordset->Read())
+                    return false;
+
+                std::size_t index = 0;
+                Detail::Mapping::Object<T>::Read(*m_recordset, index, object);
+
+                return true;
+            }
+
+            // Appends up to maxRows next objects. Returns the number of the read objects (0 at the end).
+            std::size_t Read(std::vector<T> &objects, std::size_t maxRows)
+            {
+                std::size_t count = 0;
+
+                for ( ; count < maxRows ; ++count)
+                {
+                    objects.emplace_back();
+                    if (!Read(objects.back()))
+                    {
+                        objects.pop_back();
+                        break;
+                    }
+                }
+
+                return count;
+            }
+
+        private:
+            IRecordsetPtr m_recordset;
+        };
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_BULK_H__
@@ -0,0 +1,202 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_COLUMNS_H__
+#define __MIF_DB_COLUMNS_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        // Reference to a string value inside the recordset. It is valid while the recordset is alive.
+        struct StringView
+        {
+            char const *data;
+            std::size_t size;
+
+            std::string ToString() const
+            {
+                return {data, size};
+            }
+        };
+
+        // Set of the caller's vectors which are filled by IRecordset::Fetch column by column.
+        class Columns final
+        {
+        public:
+            enum class Type
+            {
+                Int32,
+                Int64,
+                Double,
+                String,
+                StringView
+            };
+
+            struct Column
+            {
+                std::size_t field;
+                Type type;
+                void *values;
+                // Optional. If it is not set, a null value is an error.
+                std::vector<bool> *nulls;
+            };
+
+            template <typename T>
+            Columns& Add(std::size_t field, std::vector<T> &values, std::vector<bool> *nulls = nullptr)
+            {
+                m_columns.push_back({field, TypeOf<T>::value, &values, nulls});
+                return *this;
+            }
+
+            std::vector<Column> const& Get() const
+            {
+                return m_columns;
+            }
+
+            // Restores the sizes of all the vectors unless it is released, so the columns
+            // keep the same length when Fetch fails in the middle of the rows.
+            class Rollback final
+            {
+            public:
+                explicit Rollback(Columns const &columns)
+                    : m_columns{columns.m_columns}
+                {
+                    m_sizes.reserve(m_columns.size());
+                    for (auto const &column : m_columns)
+                        m_sizes.push_back({GetSize(column), column.nulls ? column.nulls->size() : 0});
+                }
+
+                ~Rollback()
+                {
+                    if (m_released)
+                        return;
+
+                    for (std::size_t i = 0 ; i < m_columns.size() ; ++i)
+                    {
+                        Resize(m_columns[i], m_sizes[i].values);
+                        if (m_columns[i].nulls)
+                            m_columns[i].nulls->resize(m_sizes[i].nulls);
+                    }
+                }
+
+                Rollback(Rollback const &) = delete;
+                Rollback& operator = (Rollback const &) = delete;
+
+                void Release()
+                {
+                    m_released = true;
+                }
+
+            private:
+                struct Size
+                {
+                    std::size_t values;
+                    std::size_t nulls;
+                };
+
+                std::vector<Column> const &m_columns;
+                std::vector<Size> m_sizes;
+                bool m_released = false;
+            };
+
+        private:
+            template <typename T>
+            struct TypeOf
+            {
+                static_assert(sizeof(T) != sizeof(T), "[Mif::Db::Columns] Unsupported column type.");
+            };
+
+            std::vector<Column> m_columns;
+
+            static std::size_t GetSize(Column const &column);
+            static void Resize(Column const &column, std::size_t size);
+        };
+
+        template <>
+        struct Columns::TypeOf<std::int32_t>
+            : public std::integral_constant<Columns::Type, Columns::Type::Int32>
+        {
+        };
+
+        template <>
+        struct Columns::TypeOf<std::int64_t>
+            : public std::integral_constant<Columns::Type, Columns::Type::Int64>
+        {
+        };
+
+        template <>
+        struct Columns::TypeOf<double>
+            : public std::integral_constant<Columns::Type, Columns::Type::Double>
+        {
+        };
+
+        template <>
+        struct Columns::TypeOf<std::string>
+            : public std::integral_constant<Columns::Type, Columns::Type::String>
+        {
+        };
+
+        template <>
+        struct Columns::TypeOf<StringView>
+            : public std::integral_constant<Columns::Type, Columns::Type::StringView>
+        {
+        };
+
+        inline std::size_t Columns::GetSize(Column const &column)
+        {
+            switch (column.type)
+            {
+            case Type::Int32 :
+                return static_cast<std::vector<std::int32_t> const *>(column.values)->size();
+            case Type::Int64 :
+                return static_cast<std::vector<std::int64_t> const *>(column.values)->size();
+            case Type::Double :
+                return static_cast<std::vector<double> const *>(column.values)->size();
+            case Type::String :
+                return static_cast<std::vector<std::string> const *>(column.values)->size();
+            case Type::StringView :
+                return static_cast<std::vector<StringView> const *>(column.values)->size();
+            }
+
+            return 0;
+        }
+
+        inline void Columns::Resize(Column const &column, std::size_t size)
+        {
+            switch (column.type)
+            {
+            case Type::Int32 :
+                static_cast<std::vector<std::int32_t> *>(column.values)->resize(size);
+                break;
+            case Type::Int64 :
+                static_cast<std::vector<std::int64_t> *>(column.values)->resize(size);
+                break;
+            case Type::Double :
+                static_cast<std::vector<double> *>(column.values)->resize(size);
+                break;
+            case Type::String :
+                static_cast<std::vector<std::string> *>(column.values)->resize(size);
+                break;
+            case Type::StringView :
+                static_cast<std::vector<StringView> *>(column.values)->resize(size);
+                break;
+            }
+        }
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_COLUMNS_H__
@@ -0,0 +1,295 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_DETAIL_MAPPER_H__
+#define __MIF_DB_DETAIL_MAPPER_H__
+
+// STD
+#include <cctype>
+#include <cstddef>
+#include <cstring>
+#include <iterator>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <vector>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/parameters.h"
+#include "mif/reflection/reflection.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace Detail
+        {
+            namespace Mapping
+            {
+
+                // Case-insensitive comparison of the column and the field names.
+                inline bool IsSameName(std::string const &column, char const *field)
+                {
+                    if (column.size() != std::strlen(field))
+                        return false;
+
+                    for (std::size_t i = 0 ; i < column.size() ; ++i)
+                    {
+                        if (std::tolower(static_cast<unsigned char>(column[i])) !=
+                                std::tolower(static_cast<unsigned char>(field[i])))
+                        {
+                            return false;
+                        }
+                    }
+
+                    return true;
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_arithmetic<T>::value>::type
+                Append(Parameters &row, T value)
+                {
+                    row.push_back(Parameter{value});
+                }
+
+                inline void Append(Parameters &row, std::string const &value)
+                {
+                    row.push_back(Parameter::Text(value.data(), value.size()));
+                }
+
+                inline void Append(Parameters &row, Common::Buffer const &value)
+                {
+                    row.push_back(Parameter::Blob(value.data(), value.size()));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_enum<T>::value && Reflection::IsReflectable<T>()>::type
+                Append(Parameters &row, T value)
+                {
+                    auto const text = Reflection::ToString(value);
+                    row.push_back(Parameter::Text(text.data(), text.size()));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_integral<T>::value>::type
+                Read(IRecordset const &recordset, std::size_t index, T &value)
+                {
+                    if (recordset.IsNull(index))
+                        value = T{};
+                    else if (std::is_same<T, bool>::value)
+                        value = recordset.GetAsInt64(index) != 0;
+                    else
+                        value = static_cast<T>(recordset.GetAsInt64(index));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_floating_point<T>::value>::type
+                Read(IRecordset const &recordset, std::size_t index, T &value)
+                {
+                    value = recordset.IsNull(index) ? T{} : static_cast<T>(recordset.GetAsDouble(index));
+                }
+
+                inline void Read(IRecordset const &recordset, std::size_t index, std::string &value)
+                {
+                    if (recordset.IsNull(index))
+                        value.clear();
+                    else
+                        value = recordset.GetAsString(index);
+                }
+
+                inline void Read(IRecordset const &recordset, std::size_t index, Common::Buffer &value)
+                {
+                    if (recordset.IsNull(index))
+                    {
+                        value.clear();
+                        return;
+                    }
+
+                    value = recordset.GetAsBuffer(index);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_enum<T>::value && Reflection::IsReflectable<T>()>::type
+                Read(IRecordset const &recordset, std::size_t index, T &value)
+                {
+                    value = recordset.IsNull(index) ? T{} : Reflection::FromString<T>(recordset.GetAsString(index));
+                }
+
+                // Access to one field of an object of type T, the field can be declared in any of its bases.
+                template <typename T>
+                struct Binding
+                {
+                    using Setter = void (*)(IRecordset const &, std::size_t, T &);
+                    using Getter = void (*)(Parameters &, T const &);
+
+                    char const *name;
+                    Setter setter;
+                    Getter getter;
+                };
+
+                template <typename T, typename TOwner, typename TField>
+                inline void SetField(IRecordset const &recordset, std::size_t index, T &object)
+                {
+                    Read(recordset, index, static_cast<TOwner &>(object).*TField::Access());
+                }
+
+                template <typename T, typename TOwner, typename TField>
+                inline void GetField(Parameters &row, T const &object)
+                {
+                    Append(row, static_cast<TOwner const &>(object).*TField::Access());
+                }
+
+                template <typename T>
+                struct Object;
+
+                template <typename TBases, std::size_t I>
+                struct Bases
+                {
+                    template <typename TRoot>
+                    static void GetBindings(std::vector<Binding<TRoot>> &bindings)
+                    {
+                        Bases<TBases, I - 1>::GetBindings(bindings);
+                        Object<typename std::tuple_element<I - 1, TBases>::type>::GetBindings(bindings);
+                    }
+
+                    template <typename T>
+                    static void Write(Parameters &row, T const &object)
+                    {
+                        Bases<TBases, I - 1>::Write(row, object);
+                        using BaseType = typename std::tuple_element<I - 1, TBases>::type;
+                        Object<BaseType>::Write(row, static_cast<BaseType const &>(object));
+                    }
+
+                    template <typename T>
+                    static void Read(IRecordset const &recordset, std::size_t &index, T &object)
+                    {
+                        Bases<TBases, I - 1>::Read(recordset, index, object);
+                        using BaseType = typename std::tuple_element<I - 1, TBases>::type;
+                        Object<BaseType>::Read(recordset, index, static_cast<BaseType &>(object));
+                    }
+                };
+
+                template <typename TBases>
+                struct Bases<TBases, 0>
+                {
+                    template <typename TRoot>
+                    static void GetBindings(std::vector<Binding<TRoot>> &)
+                    {
+                    }
+
+                    template <typename T>
+                    static void Write(Parameters &, T const &)
+                    {
+                    }
+
+                    template <typename T>
+                    static void Read(IRecordset const &, std::size_t &, T &)
+                    {
+                    }
+                };
+
+                template <std::size_t I>
+                struct Fields
+                {
+                    template <typename TRoot, typename T>
+                    static void GetBindings(std::vector<Binding<TRoot>> &bindings)
+                    {
+                        Fields<I - 1>::template GetBindings<TRoot, T>(bindings);
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        bindings.push_back({FieldType::Name::Value, &SetField<TRoot, T, FieldType>,
+                                &GetField<TRoot, T, FieldType>});
+                    }
+
+                    template <typename T>
+                    static void Write(Parameters &row, T const &object)
+                    {
+                        Fields<I - 1>::Write(row, object);
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        Append(row, object.*FieldType::Access());
+                    }
+
+                    template <typename T>
+                    static void Read(IRecordset const &recordset, std::size_t &index, T &object)
+                    {
+                        Fields<I - 1>::Read(recordset, index, object);
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        Mapping::Read(recordset, index++, object.*FieldType::Access());
+                    }
+                };
+
+                template <>
+                struct Fields<0>
+                {
+                    template <typename TRoot, typename T>
+                    static void GetBindings(std::vector<Binding<TRoot>> &)
+                    {
+                    }
+
+                    template <typename T>
+                    static void Write(Parameters &, T const &)
+                    {
+                    }
+
+                    template <typename T>
+                    static void Read(IRecordset const &, std::size_t &, T &)
+                    {
+                    }
+                };
+
+                // The columns are the fields of the bases followed by the own fields of the type.
+                // Write and Read go through the columns in this order.
+                template <typename T>
+                struct Object
+                {
+                    static_assert(Reflection::IsReflectable<T>(), "[Mif::Db::Detail::Mapping::Object] The type must be reflectable.");
+
+                    using BasesType = typename Reflection::Reflect<T>::Base;
+                    using BasesList = Bases<BasesType, std::tuple_size<BasesType>::value>;
+                    using FieldsList = Fields<Reflection::Reflect<T>::Fields::Count>;
+
+                    template <typename TRoot>
+                    static void GetBindings(std::vector<Binding<TRoot>> &bindings)
+                    {
+                        BasesList::GetBindings(bindings);
+                        FieldsList::template GetBindings<TRoot, T>(bindings);
+                    }
+
+                    static void Write(Parameters &row, T const &object)
+                    {
+                        BasesList::Write(row, object);
+                        FieldsList::Write(row, object);
+                    }
+
+                    static void Read(IRecordset const &recordset, std::size_t &index, T &object)
+                    {
+                        BasesList::Read(recordset, index, object);
+                        FieldsList::Read(recordset, index, object);
+                    }
+                };
+
+                // The table is made once per type.
+                template <typename T>
+                inline std::vector<Binding<T>> const& GetBindings()
+                {
+                    static std::vector<Binding<T>> const bindings = []
+                        {
+                            std::vector<Binding<T>> items;
+                            Object<T>::GetBindings(items);
+                            return items;
+                        } ();
+
+                    return bindings;
+                }
+
+            }   // namespace Mapping
+        }   // namespace Detail
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_DETAIL_MAPPER_H__
@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_IASYNC_CONNECTION_H__
+#define __MIF_DB_IASYNC_CONNECTION_H__
+
+// STD
+#include <exception>
+#include <functional>
+#include <future>
+#include <memory>
+#include <string>
+#include <utility>
+
+// MIF
+#include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
+#include "mif/service/iservice.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        // Runs the queries without holding the calling thread. The queries are queued and executed
+        // on the first free connection, so the queries of one caller are not guaranteed to share
+        // a connection and a transaction must be a single query.
+        struct IAsyncConnection
+            : public Service::Inherit<Service::IService>
+        {
+            using Parameters = Db::Parameters;
+            using ResultFormat = IStatement::ResultFormat;
+            // Either the recordset or the error is passed. The callback is called by the thread
+            // which serves the connections, so it must not block. The recordset holds the whole result
+            // and may be read from any thread.
+            using Callback = std::function<void (IRecordsetPtr, std::exception_ptr)>;
+
+            virtual void Execute(std::string const &query, Parameters const &parameters,
+                    ResultFormat format, Callback callback) = 0;
+
+            void Execute(std::string const &query, Parameters const &parameters, Callback callback)
+            {
+                Execute(query, parameters, ResultFormat::Text, std::move(callback));
+            }
+
+            std::future<IRecordsetPtr> Execute(std::string const &query, Parameters const &parameters = {},
+                    ResultFormat format = ResultFormat::Text)
+            {
+                auto promise = std::make_shared<std::promise<IRecordsetPtr>>();
+                auto future = promise->get_future();
+
+                Execute(query, parameters, format,
+                        [promise] (IRecordsetPtr recordset, std::exception_ptr error)
+                        {
+                            if (error)
+                                promise->set_exception(error);
+                            else
+                                promise->set_value(recordset);
+                        }
+                    );
+
+                return future;
+            }
+        };
+
+        using IAsyncConnectionPtr = Service::TServicePtr<IAsyncConnection>;
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_IASYNC_CONNECTION_H__
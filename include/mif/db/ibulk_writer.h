@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_IBULK_WRITER_H__
+#define __MIF_DB_IBULK_WRITER_H__
+
+// STD
+#include <cstdint>
+
+// MIF
+#include "mif/db/parameters.h"
+#include "mif/service/iservice.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        // Loads the rows into a table. The rows are buffered and sent by portions of a bounded size.
+        struct IBulkWriter
+            : public Service::Inherit<Service::IService>
+        {
+            // The values of one row in the order of the writer columns.
+            virtual void Write(Parameters const &row) = 0;
+            // Sends the rest of the rows and completes the load. Returns the number of the written rows.
+            // The load of a writer released without it is discarded.
+            virtual std::uint64_t Finish() = 0;
+        };
+
+        using IBulkWriterPtr = Service::TServicePtr<IBulkWriter>;
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_IBULK_WRITER_H__
@@ -10,8 +10,11 @@
 
 // STD
 #include <string>
+#include <vector>
 
 // MIF
+#include "mif/db/ibulk_writer.h"
+#include "mif/db/irecordset.h"
 #include "mif/db/istatement.h"
 #include "mif/service/iservice.h"
 
@@ -25,6 +28,11 @@ namespace Mif
         {
             virtual void ExecuteDirect(std::string const &query) = 0;
             virtual IStatementPtr CreateStatement(std::string const &query) = 0;
+
+            // The bulk operations take the connection until the writer is finished or released
+            // and until the reader is read to the end or released.
+            virtual IBulkWriterPtr CreateBulkWriter(std::string const &table, std::vector<std::string> const &columns) = 0;
+            virtual IRecordsetPtr CreateBulkReader(std::string const &query) = 0;
         };
 
         using IConnectionPtr = Service::TServicePtr<IConnection>;
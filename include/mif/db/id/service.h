@@ -25,7 +25,8 @@ namespace Mif
                 {
 #ifdef MIF_WITH_POSTGRESQL
                     PostgreSQL = Common::Crc32("Mif.Db.Service.Connection.PostgreSQL"),
-                    PostgresConnectionPool = Common::Crc32("Mif.Db.Service.PostgresConnectionPool")
+                    PostgresConnectionPool = Common::Crc32("Mif.Db.Service.PostgresConnectionPool"),
+                    PostgresAsyncConnection = Common::Crc32("Mif.Db.Service.PostgresAsyncConnection")
 #endif  // !MIF_WITH_POSTGRESQL
 #ifdef MIF_WITH_SQLITE
 #ifdef MIF_WITH_POSTGRESQL
@@ -13,6 +13,8 @@
 #include <string>
 
 // MIF
+#include "mif/common/types.h"
+#include "mif/db/columns.h"
 #include "mif/service/iservice.h"
 
 namespace Mif
@@ -32,6 +34,14 @@ namespace Mif
             virtual std::int32_t GetAsInt32(std::size_t index) const = 0;
             virtual std::int64_t GetAsInt64(std::size_t index) const = 0;
             virtual double GetAsDouble(std::size_t index) const = 0;
+            // The raw bytes of a binary field, the escaped text form of the database is decoded.
+            virtual Common::Buffer GetAsBuffer(std::size_t index) const = 0;
+
+            // Reads up to maxRows next rows and appends their values to the bound vectors.
+            // Returns the number of the read rows (0 at the end of the recordset). A streamed recordset
+            // returns at most the rows received at once, and its string views are valid until the next call.
+            // If it fails, the vectors are left as they were.
+            virtual std::size_t Fetch(Columns &columns, std::size_t maxRows) = 0;
         };
 
         using IRecordsetPtr = Service::TServicePtr<IRecordset>;
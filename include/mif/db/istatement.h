@@ -9,10 +9,13 @@
 #define __MIF_DB_ISTATEMENT_H__
 
 // STD
-#include <list>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
 
 // MIF
 #include "mif/db/irecordset.h"
+#include "mif/db/parameters.h"
 #include "mif/service/iservice.h"
 
 namespace Mif
@@ -23,9 +26,39 @@ namespace Mif
         struct IStatement
             : public Service::Inherit<Service::IService>
         {
-            using Parameters = std::list<std::string/*value*/>;
+            using Parameters = Db::Parameters;
+
+            enum class ResultFormat
+            {
+                Text,
+                // The values are decoded without parsing text. Only numbers, booleans, strings and
+                // binary strings can be read in this format; the backends with typed storage ignore it.
+                Binary
+            };
+
+            struct ExecuteOptions
+            {
+                ResultFormat format;
+                // If it is not 0, the rows are received from the server by portions of this size
+                // (or one by one, if the backend can not do it) instead of the whole result at once.
+                // The connection can not be used for other queries until the recordset is read or released.
+                std::size_t fetchSize;
+
+                ExecuteOptions(ResultFormat format = ResultFormat::Text, std::size_t fetchSize = 0)
+                    : format{format}
+                    , fetchSize{fetchSize}
+                {
+                }
+            };
 
             virtual IRecordsetPtr Execute(Parameters const &parameters = {}) = 0;
+            virtual IRecordsetPtr Execute(Parameters const &parameters, ExecuteOptions const &options) = 0;
+
+            // Executes the statement once for every parameter set and returns the total number of the affected rows.
+            // The result rows are discarded. The backends with a network protocol send the executions by portions
+            // without waiting for the results, so it is meant for the bulk writes. A failed execution stops the batch
+            // with an exception; the batch is atomic only inside a transaction.
+            virtual std::uint64_t ExecuteBatch(std::vector<Parameters> const &batch) = 0;
         };
 
         using IStatementPtr = Service::TServicePtr<IStatement>;
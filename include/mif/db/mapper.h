@@ -0,0 +1,203 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_MAPPER_H__
+#define __MIF_DB_MAPPER_H__
+
+// STD
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+// MIF
+#include "mif/db/detail/mapper.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/parameters.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        // Fills the reflected objects from the rows of a recordset. The columns are found by the field names
+        // once, when the mapper is created, so the rows are read without any lookup. The fields which have
+        // no column in the recordset keep their values.
+        // The names are compared as the unquoted SQL identifiers in the generated queries are, ignoring case:
+        // PostgreSQL returns the field "firstName" as the column "firstname". An exact match is taken first.
+        template <typename T>
+        class Mapper final
+        {
+        public:
+            explicit Mapper(IRecordset const &recordset)
+            {
+                auto const &bindings = Detail::Mapping::GetBindings<T>();
+                auto const count = recordset.GetFieldsCount();
+
+                for (std::size_t i = 0 ; i < count ; ++i)
+                {
+                    auto const name = recordset.GetFieldName(i);
+
+                    Detail::Mapping::Binding<T> const *found = nullptr;
+                    for (auto const &binding : bindings)
+                    {
+                        if (name == binding.name)
+                        {
+                            found = &binding;
+                            break;
+                        }
+
+                        if (!found && Detail::Mapping::IsSameName(name, binding.name))
+                            found = &binding;
+                    }
+
+                    if (found)
+                        m_setters.emplace_back(i, found->setter);
+                }
+            }
+
+            void Read(IRecordset const &recordset, T &object) const
+            {
+                for (auto const &setter : m_setters)
+                    setter.second(recordset, setter.first, object);
+            }
+
+        private:
+            using Setter = typename Detail::Mapping::Binding<T>::Setter;
+
+            std::vector<std::pair<std::size_t, Setter>> m_setters;
+        };
+
+        // Reads all the rows of the recordset.
+        template <typename T>
+        inline std::vector<T> Map(IRecordsetPtr recordset)
+        {
+            if (!recordset)
+                throw std::invalid_argument{"[Mif::Db::Map] Empty recordset pointer."};
+
+            Mapper<T> const mapper{*recordset};
+
+            std::vector<T> objects;
+            while (recordset->Read())
+            {
+                objects.emplace_back();
+                mapper.Read(*recordset, objects.back());
+            }
+
+            return objects;
+        }
+
+        template <typename T>
+        inline std::vector<std::string> GetColumns()
+        {
+            std::vector<std::string> columns;
+            for (auto const &binding : Detail::Mapping::GetBindings<T>())
+                columns.emplace_back(binding.name);
+            return columns;
+        }
+
+        // The values of all the fields in the order of GetColumns. They are the parameters of the query
+        // made by GetInsertQuery.
+        template <typename T>
+        inline Parameters ToParameters(T const &object)
+        {
+            Parameters parameters;
+            Detail::Mapping::Object<T>::Write(parameters, object);
+            return parameters;
+        }
+
+        // insert into table (column_1, ..., column_n) values ($1, ..., $n);
+        template <typename T>
+        inline std::string GetInsertQuery(std::string const &table)
+        {
+            if (table.empty())
+                throw std::invalid_argument{"[Mif::Db::GetInsertQuery] Empty table name."};
+
+            std::string columns;
+            std::string values;
+
+            std::size_t index = 0;
+            for (auto const &binding : Detail::Mapping::GetBindings<T>())
+            {
+                if (index)
+                {
+                    columns += ", ";
+                    values += ", ";
+                }
+
+                columns += binding.name;
+                values += "$" + std::to_string(++index);
+            }
+
+            return "insert into " + table + " (" + columns + ") values (" + values + ");";
+        }
+
+        // update table set column_1 = $1, ..., column_n = $n where key = $(n + 1);
+        // The key column is not updated and its value is the last parameter, so the positional
+        // parameters are numbered in the order they appear in the query.
+        template <typename T>
+        inline std::string GetUpdateQuery(std::string const &table, std::string const &key)
+        {
+            if (table.empty())
+                throw std::invalid_argument{"[Mif::Db::GetUpdateQuery] Empty table name."};
+
+            std::string query = "update " + table + " set ";
+
+            bool hasKey = false;
+            std::size_t index = 0;
+            for (auto const &binding : Detail::Mapping::GetBindings<T>())
+            {
+                if (key == binding.name)
+                {
+                    hasKey = true;
+                    continue;
+                }
+
+                if (index)
+                    query += ", ";
+
+                query += binding.name;
+                query += " = $" + std::to_string(++index);
+            }
+
+            if (!hasKey)
+                throw std::invalid_argument{"[Mif::Db::GetUpdateQuery] There is no field \"" + key + "\"."};
+
+            if (!index)
+                throw std::invalid_argument{"[Mif::Db::GetUpdateQuery] There are no fields to update besides the key."};
+
+            return query + " where " + key + " = $" + std::to_string(index + 1) + ";";
+        }
+
+        // The parameters of the query made by GetUpdateQuery.
+        template <typename T>
+        inline Parameters ToUpdateParameters(T const &object, std::string const &key)
+        {
+            Parameters parameters;
+
+            typename Detail::Mapping::Binding<T>::Getter keyGetter = nullptr;
+            for (auto const &binding : Detail::Mapping::GetBindings<T>())
+            {
+                if (key == binding.name)
+                    keyGetter = binding.getter;
+                else
+                    binding.getter(parameters, object);
+            }
+
+            if (!keyGetter)
+                throw std::invalid_argument{"[Mif::Db::ToUpdateParameters] There is no field \"" + key + "\"."};
+
+            keyGetter(parameters, object);
+
+            return parameters;
+        }
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_MAPPER_H__
@@ -0,0 +1,154 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_PARAMETERS_H__
+#define __MIF_DB_PARAMETERS_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        // Typed value of a statement parameter. Text and blob values are not owned.
+        class Parameter final
+        {
+        public:
+            enum class Type
+            {
+                Null,
+                Int32,
+                Int64,
+                Double,
+                Text,
+                Blob
+            };
+
+            Parameter() = default;
+
+            Parameter(std::nullptr_t)
+            {
+            }
+
+            template
+            <
+                typename T,
+                typename std::enable_if<std::is_integral<T>::value, int>::type = 0
+            >
+            Parameter(T value)
+            {
+                if (sizeof(T) < sizeof(std::int32_t) || (sizeof(T) == sizeof(std::int32_t) && std::is_signed<T>::value))
+                {
+                    m_type = Type::Int32;
+                    m_int32 = static_cast<std::int32_t>(value);
+                }
+                else
+                {
+                    m_type = Type::Int64;
+                    m_int64 = static_cast<std::int64_t>(value);
+                }
+            }
+
+            template
+            <
+                typename T,
+                typename std::enable_if<std::is_floating_point<T>::value, int>::type = 0
+            >
+            Parameter(T value)
+                : m_type{Type::Double}
+                , m_double{static_cast<double>(value)}
+            {
+            }
+
+            // An empty string is bound as null, as it was done with the text-only parameters.
+            // Use Text() to bind an empty string.
+            Parameter(char const *text);
+            Parameter(std::string const &text);
+
+            static Parameter Text(char const *data, std::size_t size);
+            static Parameter Blob(void const *data, std::size_t size);
+
+            Type GetType() const;
+            bool IsNull() const;
+
+            std::int32_t GetInt32() const;
+            std::int64_t GetInt64() const;
+            double GetDouble() const;
+            // The text is terminated by zero when the parameter is taken from Parameters.
+            char const* GetData() const;
+            std::size_t GetSize() const;
+
+        private:
+            friend class Parameters;
+
+            Type m_type = Type::Null;
+
+            union
+            {
+                std::int32_t m_int32;
+                std::int64_t m_int64;
+                double m_double = 0;
+            };
+
+            char const *m_data = nullptr;
+            std::size_t m_size = 0;
+
+            Parameter(Type type, char const *data, std::size_t size);
+        };
+
+        // List of the statement parameters. The values are copied into one buffer,
+        // so the small lists do not allocate memory at all.
+        class Parameters final
+        {
+        public:
+            Parameters() = default;
+            Parameters(std::initializer_list<Parameter> parameters);
+
+            Parameters(Parameters const &other);
+            Parameters& operator = (Parameters const &other);
+
+            void push_back(Parameter const &parameter);
+            void clear();
+
+            std::size_t size() const;
+            bool empty() const;
+
+            Parameter operator [] (std::size_t index) const;
+
+        private:
+            static constexpr std::size_t InlineCount = 8;
+            static constexpr std::size_t InlineDataSize = 256;
+
+            struct Entry
+            {
+                Parameter value;
+                std::size_t offset;
+            };
+
+            std::size_t m_count = 0;
+            Entry m_inlineEntries[InlineCount];
+            std::vector<Entry> m_entries;
+
+            std::size_t m_dataSize = 0;
+            char m_inlineData[InlineDataSize];
+            std::vector<char> m_data;
+
+            std::size_t Append(char const *data, std::size_t size, bool terminate);
+            char const* GetDataBuffer() const;
+        };
+
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_PARAMETERS_H__
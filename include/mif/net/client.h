@@ -43,6 +43,7 @@ namespace Mif
         protected:
             bool CloseMe();
             bool Post(Common::Buffer buffer);
+            bool Post(Common::Buffer header, Common::Buffer payload);
 
             virtual void ProcessData(Common::Buffer /*buffer*/);
             virtual void Close();
@@ -0,0 +1,33 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_CLIENTS_CODEC_H__
+#define __MIF_NET_CLIENTS_CODEC_H__
+
+// STD
+#include <cstdint>
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+
+            // The first byte of every message written by Compressor.
+            // Decompressor follows it, so the sender chooses the codec per message.
+            enum class Codec : std::uint8_t
+            {
+                None = 0,
+                Deflate = 1
+            };
+
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_CLIENTS_CODEC_H__
@@ -0,0 +1,49 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_CLIENTS_COMPRESSOR_H__
+#define __MIF_NET_CLIENTS_COMPRESSOR_H__
+
+// STD
+#include <cstddef>
+#include <memory>
+
+// MIF
+#include "mif/net/client.h"
+#include "mif/net/clients/codec.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+
+            class Compressor final
+                : public Net::Client
+            {
+            public:
+                // level - zlib compression level, -1 is the zlib default one.
+                // threshold - messages smaller than it are sent without compression.
+                Compressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher,
+                        Codec codec = Codec::Deflate, int level = -1, std::size_t threshold = 256);
+                ~Compressor();
+
+            private:
+                class Impl;
+                std::unique_ptr<Impl> m_impl;
+
+            protected:
+                // Client
+                virtual void ProcessData(Common::Buffer buffer) override final;
+            };
+
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_CLIENTS_COMPRESSOR_H__
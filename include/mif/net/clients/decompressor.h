@@ -0,0 +1,44 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_CLIENTS_DECOMPRESSOR_H__
+#define __MIF_NET_CLIENTS_DECOMPRESSOR_H__
+
+// STD
+#include <memory>
+
+// MIF
+#include "mif/net/client.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+
+            class Decompressor final
+                : public Net::Client
+            {
+            public:
+                Decompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher);
+                ~Decompressor();
+
+            private:
+                class Impl;
+                std::unique_ptr<Impl> m_impl;
+
+            protected:
+                // Client
+                virtual void ProcessData(Common::Buffer buffer) override final;
+            };
+
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_CLIENTS_DECOMPRESSOR_H__
@@ -26,6 +26,11 @@ namespace Mif
             {
             public:
                 GZipCompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher);
+                ~GZipCompressor();
+
+            private:
+                class Impl;
+                std::unique_ptr<Impl> m_impl;
 
             protected:
                 // Client
@@ -26,6 +26,11 @@ namespace Mif
             {
             public:
                 GZipDecompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher);
+                ~GZipDecompressor();
+
+            private:
+                class Impl;
+                std::unique_ptr<Impl> m_impl;
 
             protected:
                 // Client
@@ -10,6 +10,7 @@
 
 // STD
 #include <cstdint>
+#include <iterator>
 #include <memory>
 #include <tuple>
 #include <type_traits>
@@ -61,6 +62,15 @@ namespace Mif
             {
                 virtual ~IHolder() = default;
                 virtual Client* GetClient(std::type_info const &info) = 0;
+
+                // Only the end of the chain passes the pair on, the clients get the whole data.
+                virtual void OnData(Common::Buffer header, Common::Buffer payload)
+                {
+                    payload.insert(std::begin(payload), std::begin(header), std::end(header));
+                    OnData(std::move(payload));
+                }
+
+                using IHandler::OnData;
             };
 
             std::shared_ptr<IHolder> m_client;
@@ -122,6 +132,12 @@ namespace Mif
                     throw std::runtime_error{"[Mif::Net::ClientsChain::ChainClient::GetClient] Client item not found."};
                 }
 
+                // IHolder
+                virtual void OnData(Common::Buffer header, Common::Buffer payload) override final
+                {
+                    m_owner.Post(std::move(header), std::move(payload));
+                }
+
                 // IHandler
                 virtual void OnData(Common::Buffer buffer) override final
                 {
@@ -223,6 +239,11 @@ namespace Mif
                     m_next->OnData(std::move(buffer));
                 }
 
+                virtual void Publish(Common::Buffer header, Common::Buffer payload) override final
+                {
+                    m_next->OnData(std::move(header), std::move(payload));
+                }
+
                 // IControl
                 virtual void CloseMe() override final
                 {
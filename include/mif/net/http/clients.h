@@ -9,6 +9,7 @@
 #define __MIF_NET_HTTP_CLIENTS_H__
 
 // STD
+#include <cstddef>
 #include <memory>
 #include <string>
 
@@ -25,7 +26,10 @@ namespace Mif
             class Clients final
             {
             public:
-                Clients(std::shared_ptr<IClientFactory> factory);
+                // Every session sends the requests over up to "connections" keep-alive connections,
+                // so the concurrent calls are not queued behind one of them. The new connections
+                // are made only when all the others are busy.
+                Clients(std::shared_ptr<IClientFactory> factory, std::size_t connections = 4);
                 ~Clients();
 
                 IClientFactory::ClientPtr RunClient(std::string const &host, std::string const &port,
@@ -26,6 +26,8 @@ namespace Mif
                     {
 
                         using Session = MIF_STATIC_STR("X-Mif-Session");
+                        // The server returns it as is, so the client can match the response with the request.
+                        using Request = MIF_STATIC_STR("X-Mif-Request");
 
                     }   // namespace MifExt
 
@@ -13,6 +13,7 @@
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <type_traits>
 
 namespace Mif
 {
@@ -64,6 +65,16 @@ namespace Mif
                     std::unique_ptr<T> const m_value;
                 };
 
+                template <typename T, std::uint32_t ID, typename TConverter>
+                std::true_type IsPrm(Prm<T, ID, TConverter> const *);
+                std::false_type IsPrm(...);
+
+                template <typename T>
+                inline constexpr bool IsPrm()
+                {
+                    return decltype(IsPrm(static_cast<typename std::decay<T>::type const *>(0)))::value;
+                }
+
             }   // namespace Detail
         }   // namespace Http
     }   // namespace Net
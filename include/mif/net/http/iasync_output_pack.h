@@ -0,0 +1,39 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_HTTP_IASYNC_OUTPUT_PACK_H__
+#define __MIF_NET_HTTP_IASYNC_OUTPUT_PACK_H__
+
+// STD
+#include <memory>
+
+// MIF
+#include "mif/net/http/ioutput_pack.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+
+            // The response which can be completed later. It may be filled and sent from any thread,
+            // the reply itself is always written by the thread of the connection. A response released
+            // without sending is completed with the internal error code.
+            struct IAsyncOutputPack
+                : public IOutputPack
+            {
+                virtual void Send() = 0;
+            };
+
+            using IAsyncOutputPackPtr = std::shared_ptr<IAsyncOutputPack>;
+
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_HTTP_IASYNC_OUTPUT_PACK_H__
@@ -9,9 +9,11 @@
 #define __MIF_NET_HTTP_IINPUT_PACK_H__
 
 // STD
+#include <cstddef>
 #include <cstdint>
 #include <map>
 #include <string>
+#include <vector>
 
 // MIF
 #include "mif/common/types.h"
@@ -30,6 +32,26 @@ namespace Mif
                 using Params = std::map<std::string, std::string>;
                 using Headers = std::map<std::string, std::string>;
 
+                // Reference to a part of the request. It is valid while the pack is alive.
+                struct View
+                {
+                    char const *data;
+                    std::size_t size;
+
+                    std::string ToString() const
+                    {
+                        return {data, size};
+                    }
+                };
+
+                struct Field
+                {
+                    View name;
+                    View value;
+                };
+
+                using Fields = std::vector<Field>;
+
                 virtual ~IInputPack() = default;
 
                 virtual Method::Type GetType() const = 0;
@@ -51,6 +73,11 @@ namespace Mif
                 virtual Headers GetHeaders() const = 0;
 
                 virtual Common::Buffer GetData() const = 0;
+
+                // The same parts without copying. Each part is parsed once, on the first call.
+                virtual Fields const& GetParamsView() const = 0;
+                virtual Fields const& GetHeadersView() const = 0;
+                virtual View GetDataView() const = 0;
             };
 
         }   // namespace Http
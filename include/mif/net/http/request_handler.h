@@ -14,6 +14,7 @@
 #include <memory>
 
 // MIF
+#include "mif/net/http/iasync_output_pack.h"
 #include "mif/net/http/iinput_pack.h"
 #include "mif/net/http/ioutput_pack.h"
 
@@ -27,6 +28,10 @@ namespace Mif
             using ServerHandler = std::function<void (IInputPack const &, IOutputPack &)>;
             using ServerHandlers = std::map<std::string/*resource*/, ServerHandler>;
 
+            using IInputPackPtr = std::shared_ptr<IInputPack const>;
+            using ServerAsyncHandler = std::function<void (IInputPackPtr, IAsyncOutputPackPtr)>;
+            using ServerAsyncHandlers = std::map<std::string/*resource*/, ServerAsyncHandler>;
+
             using ClientHandler = std::function<void (IInputPack const &)>;
 
         }   // namespace Http
@@ -0,0 +1,104 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_HTTP_ROUTER_H__
+#define __MIF_NET_HTTP_ROUTER_H__
+
+// STD
+#include <cstddef>
+#include <string>
+#include <vector>
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+
+            // Maps the request paths to the indexes of the handlers. The routes are put into a tree of
+            // the path segments when the handlers are registered, and a path is matched in one pass without
+            // memory allocation. The segment "{name}" matches any segment and captures it as the parameter
+            // "name". Empty segments are skipped, so "/list/" and "/list" are the same path.
+            // The static segments take precedence over the parameters. The router is not changed
+            // after the start, so it can be used from many threads without locks.
+            class Router final
+            {
+            public:
+                using Index = std::size_t;
+
+                static constexpr std::size_t MaxParams = 8;
+
+                struct Param
+                {
+                    // The name belongs to the router, the value points into the matched path.
+                    std::string const *name;
+                    char const *value;
+                    std::size_t size;
+                };
+
+                class Match final
+                {
+                public:
+                    Index GetIndex() const;
+                    // The route the path is matched with, as it was added.
+                    std::string const& GetRoute() const;
+
+                    std::size_t GetParamsCount() const;
+                    Param const& GetParam(std::size_t index) const;
+
+                private:
+                    friend class Router;
+
+                    Index m_index = 0;
+                    std::string const *m_route = nullptr;
+                    std::size_t m_count = 0;
+                    Param m_params[MaxParams];
+                };
+
+                // Returns false if the route is already added, the index is not changed in this case.
+                bool Add(std::string const &route, Index index);
+
+                // The whole path has to match a route.
+                bool Find(char const *path, std::size_t size, Match &match) const;
+                bool Find(std::string const &path, Match &match) const;
+
+                // The longest route which the path begins with ("/admin" for "/admin/list/1").
+                bool FindPrefix(char const *path, std::size_t size, Match &match) const;
+                bool FindPrefix(std::string const &path, Match &match) const;
+
+                bool Empty() const;
+
+            private:
+                static constexpr std::size_t None = static_cast<std::size_t>(-1);
+
+                struct Node
+                {
+                    std::string segment;
+                    // Sorted by the segments for the binary search.
+                    std::vector<std::size_t> children;
+                    std::size_t param = None;
+                    std::string paramName;
+                    bool hasRoute = false;
+                    Index index = 0;
+                    std::string route;
+                };
+
+                struct State;
+
+                std::vector<Node> m_nodes{1};
+
+                std::size_t FindChild(Node const &node, char const *segment, std::size_t size) const;
+                bool Find(std::size_t node, char const *path, std::size_t pos, std::size_t size,
+                        bool prefix, State &state) const;
+            };
+
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_HTTP_ROUTER_H__
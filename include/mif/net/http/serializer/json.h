@@ -10,6 +10,7 @@
 
 // MIF
 #include "mif/serialization/json.h"
+#include "mif/serialization/json_stream.h"
 
 namespace Mif
 {
@@ -30,7 +31,7 @@ namespace Mif
                     template <typename T>
                     static Common::Buffer Serialize(T const &data)
                     {
-                        return Serialization::Json::Serialize(data);
+                        return Serialization::JsonStream::Serialize(data);
                     }
                 };
 
@@ -14,6 +14,7 @@
 #include <string>
 
 // MIF
+#include "mif/common/thread_pool.h"
 #include "mif/net/http/methods.h"
 #include "mif/net/http/request_handler.h"
 
@@ -35,6 +36,19 @@ namespace Mif
                     std::size_t bodySize = -1,
                     std::size_t requestTimeout = -1);
 
+                // The handlers are called in the threads of the handlers pool, so the I/O threads are
+                // never blocked by them. Without the pool the handlers are called in the I/O threads.
+                // The asynchronous handlers may complete the response later from any thread in both cases.
+                Server(std::string const &host, std::string const &port,
+                    std::uint16_t workers,
+                    Methods const &allowedMethods,
+                    ServerHandlers const &handlers,
+                    ServerAsyncHandlers const &asyncHandlers,
+                    Common::IThreadPoolPtr handlersPool,
+                    std::size_t headersSize = -1,
+                    std::size_t bodySize = -1,
+                    std::size_t requestTimeout = -1);
+
                 ~Server();
 
             private:
@@ -9,6 +9,8 @@
 #define __MIF_NET_HTTP_WEB_SERVICE_H__
 
 // STD
+#include <algorithm>
+#include <array>
 #include <atomic>
 #include <cstdint>
 #include <map>
@@ -17,9 +19,12 @@
 #include <string>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 // MIF
 #include "mif/common/crc32.h"
+#include "mif/common/index_sequence.h"
+#include "mif/common/unused.h"
 #include "mif/net/http/converter/content/plain_text.h"
 #include "mif/net/http/converter/url/param.h"
 #include "mif/net/http/detail/content.h"
@@ -29,6 +34,7 @@
 #include "mif/net/http/detail/result.h"
 #include "mif/net/http/iweb_service.h"
 #include "mif/net/http/request_handler.h"
+#include "mif/net/http/router.h"
 #include "mif/net/http/serializer/plain_text.h"
 
 namespace Mif
@@ -60,13 +66,16 @@ namespace Mif
                 template <typename TSerializer = Serializer::PlainText>
                 using Result = Detail::Result<TSerializer>;
 
+                // The resource can contain the path parameters ("/employee/{id}"). Their values are
+                // passed to the handler as the query parameters with the same names.
                 template <typename C, typename R, typename ... Args>
                 typename std::enable_if<std::is_base_of<WebService, C>::value, void>::type
                 AddHandler(std::string const &resource, C *object, R (C::*method)(Args ...))
                 {
                     IWebServiceHandlerPtr hanlder{new WebServiceHandler<C, R, Args ... >{object, method}};
-                    m_handlers.emplace(resource, std::move(hanlder));
-                    m_statistics.resources[resource];
+                    auto &counter = m_statistics.resources[resource];
+                    if (m_router.Add(resource, m_handlers.size()))
+                        m_handlers.push_back({std::move(hanlder), &counter});
                 }
 
                 template <std::size_t N>
@@ -99,10 +108,33 @@ namespace Mif
                 virtual void PostProcessResponse(IOutputPack &response);
 
             private:
+                // The parts of the request are copied only if the handler has parameters which need them.
+                // The path parameters are added to the query parameters.
+                class RequestContext final
+                {
+                public:
+                    RequestContext(IInputPack const &request, Router::Match const &match);
+
+                    IInputPack const& GetRequest() const;
+                    Router::Match const& GetMatch() const;
+
+                    IInputPack::Params const& GetParams();
+                    IInputPack::Headers const& GetHeaders();
+                    Common::Buffer const& GetData();
+
+                private:
+                    IInputPack const &m_request;
+                    Router::Match const &m_match;
+
+                    std::unique_ptr<IInputPack::Params> m_params;
+                    std::unique_ptr<IInputPack::Headers> m_headers;
+                    std::unique_ptr<Common::Buffer> m_data;
+                };
+
                 struct IWebServiceHandler
                 {
                     virtual ~IWebServiceHandler() = default;
-                    virtual void OnRequest(IInputPack const &request, IOutputPack &response) = 0;
+                    virtual void OnRequest(RequestContext &context, IOutputPack &response) = 0;
                 };
 
                 template <typename C, typename R, typename ... Args>
@@ -114,86 +146,139 @@ namespace Mif
                         : m_object{object}
                         , m_method{method}
                     {
+                        AddPrmIds(static_cast<Indexes const *>(nullptr));
+                        std::sort(std::begin(m_prmIds), std::end(m_prmIds));
                     }
 
                 private:
                     using Method = R (C::*)(Args ... );
+                    using Indexes = Common::MakeIndexSequence<sizeof ... (Args)>;
+
+                    // The value of the Prm argument at the same position. The name is null if there is no value.
+                    using Slots = std::array<IInputPack::Field, sizeof ... (Args) + 1>;
+                    using PrmId = std::pair<std::uint32_t, std::size_t>;
 
                     C *m_object;
                     Method m_method;
+                    // The ids of the Prm arguments and their positions, sorted by the ids.
+                    std::vector<PrmId> m_prmIds;
 
                     template <typename T>
                     using ExtractType = typename std::decay<T>::type;
 
-                    template <typename T>
-                    typename ExtractType<T>::PrmType GetPrm(IInputPack::Params const &params,
-                            IInputPack::Headers const &, Common::Buffer const &) const
+                    template <std::size_t ... I>
+                    void AddPrmIds(Common::IndexSequence<I ... > const *)
                     {
-                        for (auto const &i : params)
-                        {
-                            if (Common::Crc32str(i.first) == ExtractType<T>::Id)
+                        Common::Unused(AddPrmId<Args, I>() ... );
+                    }
+
+                    template <typename T, std::size_t Index>
+                    typename std::enable_if<Detail::IsPrm<T>(), bool>::type AddPrmId()
+                    {
+                        std::uint32_t const id = ExtractType<T>::Id;
+                        m_prmIds.emplace_back(id, Index);
+                        return true;
+                    }
+
+                    template <typename T, std::size_t Index>
+                    typename std::enable_if<!Detail::IsPrm<T>(), bool>::type AddPrmId()
+                    {
+                        return false;
+                    }
+
+                    // Each name of the path and the query parameters is hashed once, whatever the number of
+                    // the Prm arguments is. The path parameters take precedence over the query ones.
+                    void FindPrms(RequestContext &context, Slots &slots) const
+                    {
+                        if (m_prmIds.empty())
+                            return;
+
+                        auto const set = [this, &slots] (IInputPack::View const &name, IInputPack::View const &value)
                             {
-                                return {i.first, i.second};
-                            }
+                                auto const id = Common::Crc32(name.data, name.size);
+                                auto iter = std::lower_bound(std::begin(m_prmIds), std::end(m_prmIds), PrmId{id, 0});
+                                for ( ; iter != std::end(m_prmIds) && iter->first == id ; ++iter)
+                                {
+                                    auto &slot = slots[iter->second];
+                                    if (!slot.name.data)
+                                        slot = {name, value};
+                                }
+                            };
+
+                        auto const &match = context.GetMatch();
+                        for (std::size_t i = 0 ; i < match.GetParamsCount() ; ++i)
+                        {
+                            auto const &param = match.GetParam(i);
+                            set({param.name->c_str(), param.name->size()}, {param.value, param.size});
                         }
-                        return {};
+
+                        for (auto const &i : context.GetRequest().GetParamsView())
+                            set(i.name, i.value);
                     }
 
-                    template <typename T>
+                    template <typename T, std::size_t Index>
+                    typename std::enable_if<Detail::IsPrm<T>(), ExtractType<T>>::type
+                    GetArg(RequestContext &, Slots const &slots) const
+                    {
+                        auto const &slot = slots[Index];
+                        if (!slot.name.data)
+                            return {};
+                        return {slot.name.ToString(), slot.value.ToString()};
+                    }
+
+                    template <typename T, std::size_t>
                     typename std::enable_if<std::is_same<ExtractType<T>, Params>::value, ExtractType<T>>::type
-                    GetPrm(IInputPack::Params const &params,
-                            IInputPack::Headers const &, Common::Buffer const &) const
+                    GetArg(RequestContext &context, Slots const &) const
                     {
-                        return {params};
+                        return {context.GetParams()};
                     }
 
-                    template <typename T>
+                    template <typename T, std::size_t>
                     typename std::enable_if<std::is_same<ExtractType<T>, Headers>::value, ExtractType<T>>::type
-                    GetPrm(IInputPack::Params const &,
-                            IInputPack::Headers const &headers, Common::Buffer const &) const
+                    GetArg(RequestContext &context, Slots const &) const
                     {
-                        return {headers};
+                        return {context.GetHeaders()};
                     }
 
-                    template <typename T>
+                    template <typename T, std::size_t>
                     typename std::enable_if<Detail::IsParamPack<T>(), ExtractType<T>>::type
-                    GetPrm(IInputPack::Params const &params,
-                            IInputPack::Headers const &, Common::Buffer const &) const
+                    GetArg(RequestContext &context, Slots const &) const
                     {
-                        return {params};
+                        return {context.GetParams()};
                     }
 
-                    template <typename T>
-                    typename ExtractType<T>::ContentType GetPrm(IInputPack::Params const &,
-                            IInputPack::Headers const &, Common::Buffer const &content) const
+                    template <typename T, std::size_t>
+                    typename ExtractType<T>::ContentType GetArg(RequestContext &context, Slots const &) const
                     {
-                        return {content};
+                        return {context.GetData()};
                     }
 
                     // IWebServiceHandler
-                    virtual void OnRequest(IInputPack const &request, IOutputPack &response) override final
+                    virtual void OnRequest(RequestContext &context, IOutputPack &response) override final
+                    {
+                        ProcessRequest<R>(context, response);
+                    }
+
+                    template <std::size_t ... I>
+                    R Call(RequestContext &context, Common::IndexSequence<I ... > const *)
                     {
-                        ProcessRequest<R>(request, response);
+                        Slots slots{};
+                        FindPrms(context, slots);
+                        return (m_object->*m_method)(GetArg<Args, I>(context, slots) ... );
                     }
 
                     template <typename T>
                     typename std::enable_if<std::is_same<T, void>::value, void>::type
-                    ProcessRequest(IInputPack const &request, IOutputPack &)
+                    ProcessRequest(RequestContext &context, IOutputPack &)
                     {
-                        auto const params = request.GetParams();
-                        auto const headers = request.GetHeaders();
-                        auto const content = request.GetData();
-                        (m_object->*m_method)(GetPrm<Args>(params, headers, content) ... );
+                        Call(context, static_cast<Indexes const *>(nullptr));
                     }
 
                     template <typename T>
                     typename std::enable_if<!std::is_same<T, void>::value, void>::type
-                    ProcessRequest(IInputPack const &request, IOutputPack &response)
+                    ProcessRequest(RequestContext &context, IOutputPack &response)
                     {
-                        auto const params = request.GetParams();
-                        auto const headers = request.GetHeaders();
-                        auto const content = request.GetData();
-                        Result<> res{(m_object->*m_method)(GetPrm<Args>(params, headers, content) ... )};
+                        Result<> res{Call(context, static_cast<Indexes const *>(nullptr))};
                         for (auto const &header : res.GetHeaders().Get())
                             response.SetHeader(header.first, header.second);
                         response.SetData(std::move(res.GetValue()));
@@ -201,10 +286,18 @@ namespace Mif
                 };
 
                 using IWebServiceHandlerPtr = std::unique_ptr<IWebServiceHandler>;
-                using Handlers = std::map<std::string, IWebServiceHandlerPtr>;
+
+                struct Handler
+                {
+                    IWebServiceHandlerPtr handler;
+                    Statistics::ItemCounter *counter;
+                };
+
+                using Handlers = std::vector<Handler>;
 
                 Statistics m_statistics;
                 Handlers m_handlers;
+                Router m_router;
 
                 //--------------------------------------------------------------------------------------------------
                 // IWebService
@@ -8,6 +8,10 @@
 #ifndef __MIF_NET_IPUBLISHER_H__
 #define __MIF_NET_IPUBLISHER_H__
 
+// STD
+#include <iterator>
+#include <utility>
+
 // MIF
 #include "mif/common/types.h"
 
@@ -20,6 +24,14 @@ namespace Mif
         {
             virtual ~IPublisher() = default;
             virtual void Publish(Common::Buffer buffer) = 0;
+
+            // The header and the payload are published as one piece of data. A publisher
+            // which can write them by one gather operation overrides it to avoid the copy.
+            virtual void Publish(Common::Buffer header, Common::Buffer payload)
+            {
+                payload.insert(std::begin(payload), std::begin(header), std::end(header));
+                Publish(std::move(payload));
+            }
         };
 
 
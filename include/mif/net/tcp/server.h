@@ -9,6 +9,7 @@
 #define __MIF_NET_TCP_SERVER_H__
 
 // STD
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -26,7 +27,19 @@ namespace Mif
             class Server final
             {
             public:
-                Server(std::string const &host, std::string const &port, IClientFactoryPtr factory);
+                enum class Balancing
+                {
+                    RoundRobin,
+                    LeastLoad
+                };
+
+                // ioThreads - count of io_service instances, each is run on its own thread.
+                // reusePort - every io_service gets its own SO_REUSEPORT listener
+                // instead of one shared acceptor.
+                // readBufferSize - size of the pooled buffers for the socket reads.
+                Server(std::string const &host, std::string const &port, IClientFactoryPtr factory,
+                    std::uint16_t ioThreads = 1, Balancing balancing = Balancing::LeastLoad,
+                    bool reusePort = false, std::size_t readBufferSize = 8192);
 
                 ~Server();
 
@@ -12,6 +12,7 @@
 #include <string>
 
 // MIF
+#include "mif/remote/types.h"
 #include "mif/service/iservice.h"
 
 namespace Mif
@@ -25,11 +26,11 @@ namespace Mif
                 : public Service::Inherit<Service::IService>
             {
                 virtual ~IObjectManager() = default;
-                virtual std::string CreateObject(Service::ServiceId serviceId, std::string const &interfaceId) = 0;
-                virtual void DestroyObject(std::string const &instanceId) = 0;
-                virtual std::string QueryInterface(std::string const &instanceId, std::string const &interfaceId,
+                virtual InstanceId CreateObject(Service::ServiceId serviceId, InterfaceId interfaceId) = 0;
+                virtual void DestroyObject(InstanceId instanceId) = 0;
+                virtual InstanceId QueryInterface(InstanceId instanceId, InterfaceId interfaceId,
                         std::string const &serviceId) = 0;
-                virtual std::string CloneReference(std::string const &instanceId, std::string const &interfaceId) = 0;
+                virtual InstanceId CloneReference(InstanceId instanceId, InterfaceId interfaceId) = 0;
             };
 
             using IObjectManagerPtr = Service::TServicePtr<IObjectManager>;
@@ -0,0 +1,195 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_REMOTE_DETAIL_PENDING_CALLS_H__
+#define __MIF_REMOTE_DETAIL_PENDING_CALLS_H__
+
+// STD
+#include <array>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <mutex>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// MIF
+#include "mif/remote/types.h"
+
+namespace Mif
+{
+    namespace Remote
+    {
+        namespace Detail
+        {
+
+            // Registry of the calls waiting for a response.
+            // Calls are spread over independently locked shards by request id.
+            // Every shard keeps a timer wheel whose span covers the call timeout,
+            // so both registration and expiration cost O(1) per call.
+            // The wheel does not turn by itself, the owner calls ExtractExpired
+            // about once per tick independently of the traffic.
+            template <typename THandler>
+            class PendingCalls final
+            {
+            public:
+                using Handlers = std::vector<THandler>;
+
+                PendingCalls(std::chrono::microseconds const &timeout)
+                    : m_tick{CalcTick(timeout)}
+                    , m_timeout{static_cast<std::uint64_t>(timeout.count())}
+                {
+                    auto const now = Now();
+                    for (auto &shard : m_shards)
+                        shard.current = now / m_tick;
+                }
+
+                PendingCalls(PendingCalls const &) = delete;
+                PendingCalls(PendingCalls &&) = delete;
+                PendingCalls& operator = (PendingCalls const &) = delete;
+                PendingCalls& operator = (PendingCalls &&) = delete;
+
+                std::chrono::microseconds GetTick() const
+                {
+                    return std::chrono::microseconds{static_cast<std::chrono::microseconds::rep>(m_tick)};
+                }
+
+                bool Insert(RequestId requestId, THandler handler)
+                {
+                    auto const now = Now();
+                    auto &shard = GetShard(requestId);
+                    LockGuard lock{shard.lock};
+                    auto const deadline = (now + m_timeout) / m_tick + 1;
+                    if (!shard.calls.emplace(requestId, Call{deadline, std::move(handler)}).second)
+                        return false;
+                    shard.slots[deadline % SlotCount].push_back(requestId);
+                    return true;
+                }
+
+                bool Extract(RequestId requestId, THandler &handler)
+                {
+                    auto &shard = GetShard(requestId);
+                    LockGuard lock{shard.lock};
+                    auto iter = shard.calls.find(requestId);
+                    if (iter == std::end(shard.calls))
+                        return false;
+                    handler = std::move(iter->second.second);
+                    shard.calls.erase(iter);
+                    return true;
+                }
+
+                bool Erase(RequestId requestId)
+                {
+                    auto &shard = GetShard(requestId);
+                    LockGuard lock{shard.lock};
+                    return shard.calls.erase(requestId) != 0;
+                }
+
+                bool Contains(RequestId requestId)
+                {
+                    auto &shard = GetShard(requestId);
+                    LockGuard lock{shard.lock};
+                    return shard.calls.find(requestId) != std::end(shard.calls);
+                }
+
+                void ExtractExpired(Handlers &handlers)
+                {
+                    auto const now = Now() / m_tick;
+                    for (auto &shard : m_shards)
+                    {
+                        LockGuard lock{shard.lock};
+                        if (shard.current >= now)
+                            continue;
+                        // Every slot is visited once when the wheel was idle longer than its span.
+                        auto const first = now - shard.current > SlotCount ? now - SlotCount : shard.current;
+                        for (auto i = first + 1 ; i <= now ; ++i)
+                        {
+                            auto &slot = shard.slots[i % SlotCount];
+                            for (auto j = std::begin(slot) ; j != std::end(slot) ; )
+                            {
+                                auto iter = shard.calls.find(*j);
+                                if (iter != std::end(shard.calls) && iter->second.first > i)
+                                {
+                                    ++j;
+                                    continue;
+                                }
+                                if (iter != std::end(shard.calls))
+                                {
+                                    handlers.push_back(std::move(iter->second.second));
+                                    shard.calls.erase(iter);
+                                }
+                                if (std::next(j) != std::end(slot))
+                                    *j = std::move(slot.back());
+                                slot.pop_back();
+                            }
+                        }
+                        shard.current = now;
+                    }
+                }
+
+                void ExtractAll(Handlers &handlers)
+                {
+                    for (auto &shard : m_shards)
+                    {
+                        LockGuard lock{shard.lock};
+                        for (auto &i : shard.calls)
+                            handlers.push_back(std::move(i.second.second));
+                        shard.calls.clear();
+                        for (auto &slot : shard.slots)
+                            slot.clear();
+                    }
+                }
+
+            private:
+                using LockType = std::mutex;
+                using LockGuard = std::lock_guard<LockType>;
+
+                static constexpr std::size_t ShardCount = 16;
+                static constexpr std::uint64_t SlotCount = 64;
+
+                using Call = std::pair<std::uint64_t/*deadline tick*/, THandler>;
+
+                struct Shard
+                {
+                    LockType lock;
+                    std::unordered_map<RequestId, Call> calls;
+                    std::array<std::vector<RequestId>, SlotCount> slots;
+                    std::uint64_t current = 0;
+                };
+
+                std::uint64_t const m_tick;
+                std::uint64_t const m_timeout;
+
+                std::array<Shard, ShardCount> m_shards;
+
+                static std::uint64_t CalcTick(std::chrono::microseconds const &timeout)
+                {
+                    // The deadline of a new call must always fall into the wheel span.
+                    auto const count = static_cast<std::uint64_t>(timeout.count() > 0 ? timeout.count() : 0);
+                    auto const tick = (count + SlotCount - 3) / (SlotCount - 2);
+                    return tick ? tick : 1;
+                }
+
+                static std::uint64_t Now()
+                {
+                    return static_cast<std::uint64_t>(std::chrono::duration_cast<std::chrono::microseconds>(
+                        std::chrono::steady_clock::now().time_since_epoch()).count());
+                }
+
+                Shard& GetShard(RequestId requestId)
+                {
+                    return m_shards[requestId % ShardCount];
+                }
+            };
+
+        }   // namespace Detail
+    }   // namespace Remote
+}   // namespace Mif
+
+#endif  // !__MIF_REMOTE_DETAIL_PENDING_CALLS_H__
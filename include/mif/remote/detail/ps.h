@@ -10,7 +10,11 @@
 
 // STD
 #include <algorithm>
+#include <array>
+#include <cstddef>
+#include <exception>
 #include <functional>
+#include <future>
 #include <list>
 #include <memory>
 #include <stdexcept>
@@ -26,11 +30,12 @@
 #include "mif/common/index_sequence.h"
 #include "mif/common/log.h"
 #include "mif/common/types.h"
-#include "mif/common/uuid_generator.h"
+#include "mif/common/id_generator.h"
 #include "mif/common/unused.h"
 #include "mif/remote/detail/iobject_manager.h"
 #include "mif/remote/detail/registry.h"
 #include "mif/remote/detail/type_traits.h"
+#include "mif/remote/types.h"
 #include "mif/service/iservice.h"
 #include "mif/service/make.h"
 
@@ -64,8 +69,8 @@ namespace Mif
                 PackResult(T res, Serializer &serializer, TStubCreator &stubCreator)
                 {
                     using PSType = typename Registry::Registry<typename T::element_type>::template Type<TSerializer>;
-                    auto instanceId = stubCreator(res, std::string{PSType::InterfaceId});
-                    serializer.PutParams(std::move(instanceId));
+                    auto const instanceId = stubCreator(res, PSType::InterfaceId);
+                    serializer.PutParams(instanceId);
                 }
 
                 template <typename T, typename TStubCreator>
@@ -96,7 +101,113 @@ namespace Mif
                 using std::runtime_error::runtime_error;
             };
 
-            using StubCreator = std::function<std::string (Service::IServicePtr, std::string const &)>;
+            using StubCreator = std::function<InstanceId (Service::IServicePtr, InterfaceId)>;
+
+            // The ids of a method are sent, the names are kept for the error messages.
+            struct MethodInfo
+            {
+                InterfaceId interfaceId;
+                MethodId methodId;
+                char const *interfaceName;
+                char const *methodName;
+            };
+
+            inline constexpr bool IsNotIn(MethodId)
+            {
+                return true;
+            }
+
+            template <typename ... T>
+            inline constexpr bool IsNotIn(MethodId id, MethodId first, T ... rest)
+            {
+                return id != first && IsNotIn(id, rest ... );
+            }
+
+            inline constexpr bool AreUnique()
+            {
+                return true;
+            }
+
+            template <typename ... T>
+            inline constexpr bool AreUnique(MethodId first, T ... rest)
+            {
+                return IsNotIn(first, rest ... ) && AreUnique(rest ... );
+            }
+
+            // The method stubs of one interface sorted by the method id. It is built once
+            // per stub type and searched by the id like a sparse switch.
+            template <typename TSerializer, typename TStub, typename ... TMethods>
+            class MethodTable final
+            {
+            public:
+                using Serializer = typename TSerializer::Serializer;
+                using Deserializer = typename TSerializer::Deserializer;
+                using Handler = void (*)(TStub &, Deserializer &, Serializer &);
+
+                static_assert(AreUnique(static_cast<MethodId>(TMethods::_Mif_Remote_Method_Id) ... ),
+                        "The interface has methods with the same id. Rename one of them.");
+
+                static Handler Find(MethodId id)
+                {
+                    static Entries const entries = MakeEntries();
+                    auto const iter = std::lower_bound(std::begin(entries), std::end(entries), id,
+                            [] (Entry const &entry, MethodId value)
+                            {
+                                return entry.first < value;
+                            }
+                        );
+                    return iter != std::end(entries) && iter->first == id ? iter->second : nullptr;
+                }
+
+            private:
+                using Entry = std::pair<MethodId, Handler>;
+                using Entries = std::array<Entry, sizeof ... (TMethods)>;
+
+                static Entries MakeEntries()
+                {
+                    Entries entries{{Entry{TMethods::_Mif_Remote_Method_Id,
+                            &TMethods::template _Mif_Remote_Invoke<TStub>} ... }};
+                    std::sort(std::begin(entries), std::end(entries),
+                            [] (Entry const &x, Entry const &y)
+                            {
+                                return x.first < y.first;
+                            }
+                        );
+                    return entries;
+                }
+            };
+
+            template <typename T>
+            using AsyncHandler = std::function<void (std::future<T>)>;
+
+            template <typename T>
+            inline typename std::enable_if<!std::is_same<T, void>::value, void>::type
+            MoveFutureToPromise(std::future<T> &future, std::promise<T> &promise)
+            {
+                try
+                {
+                    promise.set_value(future.get());
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                }
+            }
+
+            template <typename T>
+            inline typename std::enable_if<std::is_same<T, void>::value, void>::type
+            MoveFutureToPromise(std::future<T> &future, std::promise<T> &promise)
+            {
+                try
+                {
+                    future.get();
+                    promise.set_value();
+                }
+                catch (...)
+                {
+                    promise.set_exception(std::current_exception());
+                }
+            }
 
             class ObjectCleaner final
             {
@@ -117,7 +228,7 @@ namespace Mif
                         return;
 
                     std::for_each(std::begin(m_ids), std::end(m_ids),
-                            [this] (std::string const &id)
+                            [this] (InstanceId id)
                             {
                                 try
                                 {
@@ -126,14 +237,14 @@ namespace Mif
                                 catch (std::exception const &e)
                                 {
                                     MIF_LOG(Warning) << "[Mif::Remote::Detail::ObjectCleaner::~ObjectCleaner] "
-                                                     << "Failed to call Destroy object for instance whith id \""
-                                                     << id << "\" Error: " << e.what();
+                                                     << "Failed to call Destroy object for instance whith id "
+                                                     << id << ". Error: " << e.what();
                                 }
                             }
                         );
                 }
 
-                void AppendId(std::string const &id)
+                void AppendId(InstanceId id)
                 {
                     // TODO: uncomment it
                     //m_ids.push_back(id);
@@ -142,7 +253,7 @@ namespace Mif
 
             private:
                 Service::TIntrusivePtr<IObjectManager> m_manager;
-                std::list<std::string> m_ids;
+                std::list<InstanceId> m_ids;
             };
 
             template <typename TSerializer>
@@ -153,9 +264,12 @@ namespace Mif
                 using Deserializer = typename TSerializer::Deserializer;
                 using DeserializerPtr = std::unique_ptr<Deserializer>;
 
-                using Sender = std::function<DeserializerPtr (std::string const &, Serializer &)>;
+                using ResponseHandler = std::function<void (DeserializerPtr, std::exception_ptr)>;
+                // If the handler is empty, the sender waits for the response and returns it.
+                // Otherwise it returns immediately and the handler is called on response or error.
+                using Sender = std::function<DeserializerPtr (RequestId, Serializer &, ResponseHandler)>;
 
-                Proxy(IObjectManagerPtr manager, Service::ServiceId serviceId, std::string const &interfaceId,
+                Proxy(IObjectManagerPtr manager, Service::ServiceId serviceId, InterfaceId interfaceId,
                         Sender && sender, StubCreator && stubCreator)
                     : m_manager{manager}
                     , m_instance{m_manager->CreateObject(serviceId, interfaceId)}
@@ -164,7 +278,7 @@ namespace Mif
                 {
                 }
 
-                Proxy(IObjectManagerPtr manager, std::string const &instance,
+                Proxy(IObjectManagerPtr manager, InstanceId instance,
                         Sender && sender, StubCreator && stubCreator)
                     : m_manager{manager}
                     , m_instance{instance}
@@ -173,7 +287,7 @@ namespace Mif
                 {
                 }
 
-                Proxy(std::string const &instance, Sender && sender, StubCreator && stubCreator)
+                Proxy(InstanceId instance, Sender && sender, StubCreator && stubCreator)
                     : m_instance{instance}
                     , m_sender{std::move(sender)}
                     , m_stubCreator{stubCreator}
@@ -192,56 +306,66 @@ namespace Mif
                         {
                             MIF_LOG(Warning) << "[Mif::Remote::Detail::Proxy::~Proxy] "
                                 << "Failed to destroy service with instance id "
-                                << "\"" << m_instance + "\". Error: " << e.what();
+                                << m_instance << ". Error: " << e.what();
                         }
                     }
                 }
 
                 template <typename TResult, typename ... TParams>
-                TResult RemoteCall(std::string const &interface, std::string const &method, TParams && ... params)
+                TResult RemoteCall(MethodInfo const &method, TParams && ... params)
                 {
                     try
                     {
                         auto const requestId = m_generator.Generate();
                         ObjectCleaner cleaner{m_manager};
-                        Serializer serializer(true, requestId, m_instance, interface, method,
+                        Serializer serializer(true, requestId, m_instance, method.interfaceId, method.methodId,
                                 PrepareParam(std::forward<TParams>(params), cleaner) ... );
-                        auto deserializer = m_sender(requestId, serializer);
-                        if (!deserializer->IsResponse())
-                            throw ProxyStubException{"[Mif::Remote::Proxy::RemoteCall] Bad response type \"" + deserializer->GetType() + "\""};
-                        auto const &instance = deserializer->GetInstance();
-                        if (instance != m_instance)
-                        {
-                            throw ProxyStubException{"[Mif::Remote::Proxy::RemoteCall] Bad instance id \"" + instance + "\" "
-                                "Needed instance id \"" + m_instance + "\""};
-                        }
-                        auto const &interfaceId = deserializer->GetInterface();
-                        if (interface != interfaceId)
-                        {
-                            throw ProxyStubException{"[Mif::Remote::Proxy::RemoteCall] Bad interface for instance whith id \"" +
-                                interfaceId + "\" Needed \"" + interface + "\""};
-                        }
-                        auto const &methodId = deserializer->GetMethod();
-                        if (method != methodId)
-                        {
-                            throw ProxyStubException{"[Mif::Remote::Proxy::RemoteCall] Method \"" + methodId + "\" "
-                                "of interface \"" + interface + "\" for instance with id \"" + m_instance + "\" "
-                                "not found. Needed method \"" + method + "\""};
-                        }
-
-                        if (deserializer->HasException())
-                            std::rethrow_exception(deserializer->GetException());
-
+                        auto deserializer = m_sender(requestId, serializer, ResponseHandler{});
+                        CheckResponse(*deserializer, method);
                         return ExtractResult<TResult>(*deserializer);
                     }
                     catch (std::exception const &e)
                     {
                         throw ProxyStubException{"[Mif::Remote::Proxy::RemoteCall] Failed to call remote method \"" +
-                            interface + "::" + method + "\" for instance with id \"" + m_instance + "\". Error: " +
-                            std::string{e.what()}};
+                            std::string{method.interfaceName} + "::" + method.methodName + "\" for instance with id " +
+                            std::to_string(m_instance) + ". Error: " + std::string{e.what()}};
                     }
                 }
 
+                template <typename TResult, typename THolder, typename ... TParams>
+                void RemoteCallAsync(THolder holder, AsyncHandler<TResult> handler, MethodInfo const &method,
+                        TParams && ... params)
+                {
+                    if (!handler)
+                        throw std::invalid_argument{"[Mif::Remote::Proxy::RemoteCallAsync] Empty handler."};
+
+                    auto const requestId = m_generator.Generate();
+                    auto cleaner = std::make_shared<ObjectCleaner>(m_manager);
+                    Serializer serializer(true, requestId, m_instance, method.interfaceId, method.methodId,
+                            PrepareParam(std::forward<TParams>(params), *cleaner) ... );
+                    auto onResponse = [this, holder, cleaner, handler, method]
+                            (DeserializerPtr deserializer, std::exception_ptr exception)
+                            {
+                                std::promise<TResult> promise;
+                                try
+                                {
+                                    if (exception)
+                                        std::rethrow_exception(exception);
+                                    CheckResponse(*deserializer, method);
+                                    SetResult(promise, *deserializer);
+                                }
+                                catch (std::exception const &e)
+                                {
+                                    promise.set_exception(std::make_exception_ptr(ProxyStubException{
+                                        "[Mif::Remote::Proxy::RemoteCallAsync] Failed to call remote method \"" +
+                                        std::string{method.interfaceName} + "::" + method.methodName + "\" for instance "
+                                        "with id " + std::to_string(m_instance) + ". Error: " + std::string{e.what()}}));
+                                }
+                                handler(promise.get_future());
+                            };
+                    m_sender(requestId, serializer, std::move(onResponse));
+                }
+
                 bool QueryRemoteInterface(void **service, std::type_info const &typeInfo,
                         std::string const &serviceId, Service::IService **holder)
                 {
@@ -251,12 +375,56 @@ namespace Mif
                 }
 
             private:
-                Common::UuidGenerator m_generator;
+                Common::IdGenerator m_generator;
                 IObjectManagerPtr m_manager;
-                std::string m_instance;
+                InstanceId m_instance;
                 Sender m_sender;
                 StubCreator m_stubCreator;
 
+                void CheckResponse(Deserializer &deserializer, MethodInfo const &method) const
+                {
+                    if (!deserializer.IsResponse())
+                        throw ProxyStubException{"[Mif::Remote::Proxy::CheckResponse] Bad response type. Request is received."};
+                    auto const instance = deserializer.GetInstance();
+                    if (instance != m_instance)
+                    {
+                        throw ProxyStubException{"[Mif::Remote::Proxy::CheckResponse] Bad instance id " +
+                            std::to_string(instance) + ". Needed instance id " + std::to_string(m_instance) + "."};
+                    }
+                    auto const interfaceId = deserializer.GetInterface();
+                    if (interfaceId != method.interfaceId)
+                    {
+                        throw ProxyStubException{"[Mif::Remote::Proxy::CheckResponse] Bad interface id " +
+                            std::to_string(interfaceId) + " for instance with id " + std::to_string(m_instance) + ". "
+                            "Needed \"" + method.interfaceName + "\""};
+                    }
+                    auto const methodId = deserializer.GetMethod();
+                    if (methodId != method.methodId)
+                    {
+                        throw ProxyStubException{"[Mif::Remote::Proxy::CheckResponse] Bad method id " +
+                            std::to_string(methodId) + " of interface \"" + method.interfaceName + "\" for instance "
+                            "with id " + std::to_string(m_instance) + ". Needed method \"" + method.methodName + "\""};
+                    }
+
+                    if (deserializer.HasException())
+                        std::rethrow_exception(deserializer.GetException());
+                }
+
+                template <typename TResult>
+                typename std::enable_if<!std::is_same<TResult, void>::value, void>::type
+                SetResult(std::promise<TResult> &promise, Deserializer &deserializer)
+                {
+                    promise.set_value(ExtractResult<TResult>(deserializer));
+                }
+
+                template <typename TResult>
+                typename std::enable_if<std::is_same<TResult, void>::value, void>::type
+                SetResult(std::promise<TResult> &promise, Deserializer &deserializer)
+                {
+                    ExtractResult<TResult>(deserializer);
+                    promise.set_value();
+                }
+
                 template <typename TResult>
                 typename std::enable_if
                     <
@@ -273,8 +441,8 @@ namespace Mif
                 typename std::enable_if<Traits::IsTServicePtr<TResult>(), TResult>::type
                 ExtractResult(Deserializer &deserializer)
                 {
-                    auto const instanceId = std::get<0>(deserializer.template GetParams<std::string>());
-                    if (instanceId.empty())
+                    auto const instanceId = std::get<0>(deserializer.template GetParams<InstanceId>());
+                    if (!instanceId)
                         return {};
 
                     using InterfaceType = typename TResult::element_type;
@@ -312,7 +480,7 @@ namespace Mif
                     using Result = bool;
 
                     template <typename T>
-                    static Result Visit(IObjectManagerPtr manager, std::string const &instance,
+                    static Result Visit(IObjectManagerPtr manager, InstanceId instance,
                             Sender const &sender, StubCreator const &stubCreator,
                             void **service, std::type_index const &typeId,
                             std::string const &serviceId, Service::IService **holder)
@@ -322,7 +490,7 @@ namespace Mif
                          if (std::type_index{typeid(InterfaceType)} == typeId)
                          {
                              auto const instanceId = manager->QueryInterface(instance, T::InterfaceId, serviceId);
-                             if (instanceId.empty())
+                             if (!instanceId)
                                  return false;
                              Sender newSender{sender};
                              StubCreator newStubCreator{stubCreator};
@@ -347,7 +515,7 @@ namespace Mif
 
                 // Specialization for pointers on interfaces based on IService
                 template <typename T>
-                typename std::enable_if<Traits::IsInterfaceRawPtr<T>(), std::string>::type
+                typename std::enable_if<Traits::IsInterfaceRawPtr<T>(), InstanceId>::type
                 PrepareParam(T && param, ObjectCleaner &cleaner)
                 {
                     return PrepareParam(Service::TIntrusivePtr<Traits::ExtractType<T>>{param}, cleaner);
@@ -355,7 +523,7 @@ namespace Mif
 
                 // Specialization for references on interfaces based on IService
                 template <typename T>
-                typename std::enable_if<Traits::IsInterfaceRef<T>(), std::string>::type
+                typename std::enable_if<Traits::IsInterfaceRef<T>(), InstanceId>::type
                 PrepareParam(T && param, ObjectCleaner &cleaner)
                 {
                     return PrepareParam(&param, cleaner);
@@ -363,14 +531,14 @@ namespace Mif
 
                 // Specialization for smart pointers on interfaces based on IService
                 template <typename T>
-                typename std::enable_if<Traits::IsInterfaceSmartPtr<T>(), std::string>::type
+                typename std::enable_if<Traits::IsInterfaceSmartPtr<T>(), InstanceId>::type
                 PrepareParam(T && param, ObjectCleaner &cleaner)
                 {
                     if (!param)
                         return {};
                     using InterfaceType = typename Traits::ExtractType<T>::element_type;
                     using PSType = typename Registry::Registry<InterfaceType>::template Type<TSerializer>;
-                    auto instanceId = m_stubCreator(std::forward<T>(param), PSType::InterfaceId);
+                    auto const instanceId = m_stubCreator(std::forward<T>(param), PSType::InterfaceId);
                     cleaner.AppendId(instanceId);
                     return instanceId;
                 }
@@ -382,15 +550,15 @@ namespace Mif
                     bool = Traits::IsInterfaceRawPtr<T>() || Traits::IsInterfaceRef<T>() ||
                             Traits::IsInterfaceSmartPtr<T>()
                 >
-            struct InterfaceTypeToString
+            struct InterfaceTypeToInstanceId
             {
                 using Type = T;
             };
 
             template <typename T>
-            struct InterfaceTypeToString<T, true>
+            struct InterfaceTypeToInstanceId<T, true>
             {
-                using Type = std::string;
+                using Type = InstanceId;
             };
 
             template <typename TSerializer>
@@ -401,7 +569,7 @@ namespace Mif
 
                 virtual ~IStub() = default;
                 virtual void Call(Deserializer &request, Serializer &response) = 0;
-                virtual Service::IServicePtr Query(std::string const &interfaceId, std::string const &serviceId) = 0;
+                virtual Service::IServicePtr Query(InterfaceId interfaceId, std::string const &serviceId) = 0;
                 virtual Service::IServicePtr GetInstance() = 0;
             };
 
@@ -416,7 +584,7 @@ namespace Mif
 
                 using Sender = typename Proxy<TSerializer>::Sender;
 
-                Stub(Service::IServicePtr instance, std::string const &instanceId,
+                Stub(Service::IServicePtr instance, InstanceId instanceId,
                         Service::TIntrusivePtr<IObjectManager> manager,
                         StubCreator && stubCreator, Sender && sender)
                     : m_instance{instance}
@@ -427,7 +595,7 @@ namespace Mif
                 {
                 }
 
-                Stub(Service::IServicePtr instance, std::string const &instanceId)
+                Stub(Service::IServicePtr instance, InstanceId instanceId)
                     : m_instance{instance}
                     , m_instanceId{instanceId}
                 {
@@ -437,14 +605,13 @@ namespace Mif
                 {
                     try
                     {
-                        auto const &interfaceId = request.GetInterface();
+                        auto const interfaceId = request.GetInterface();
                         if (!ContainInterfaceId(interfaceId))
                         {
-                            throw ProxyStubException{"[Mif::Remote::Stub::Call] Interface with id \"" +
-                                interfaceId + "\" not supported for this object."};
+                            throw ProxyStubException{"[Mif::Remote::Stub::Call] Interface with id " +
+                                std::to_string(interfaceId) + " not supported for this object."};
                         }
-                        auto const &method = request.GetMethod();
-                        InvokeMethod(method, request, response);
+                        InvokeMethod(interfaceId, request.GetMethod(), request, response);
                     }
                     catch (...)
                     {
@@ -452,7 +619,7 @@ namespace Mif
                     }
                 }
 
-                virtual Service::IServicePtr Query(std::string const &interfaceId, std::string const &serviceId) override final
+                virtual Service::IServicePtr Query(InterfaceId interfaceId, std::string const &serviceId) override final
                 {
                     return Registry::Visitor::Accept<QueryInterfaceVisitor>(m_instance, interfaceId, serviceId);
                 }
@@ -464,7 +631,7 @@ namespace Mif
 
              private:
                 Service::IServicePtr m_instance;
-                std::string m_instanceId;
+                InstanceId m_instanceId;
                 Service::TIntrusivePtr<IObjectManager> m_manager;
                 StubCreator m_stubCreator;
                 Sender m_sender;
@@ -476,7 +643,7 @@ namespace Mif
                     using Result = Service::IServicePtr;
 
                     template <typename T>
-                    static Result Visit(Service::IServicePtr instance, std::string const &interfaceId,
+                    static Result Visit(Service::IServicePtr instance, InterfaceId interfaceId,
                             std::string const &serviceId)
                     {
                         using InterfaceType = typename T::InterfaceType;
@@ -494,12 +661,15 @@ namespace Mif
                 };
 
             protected:
-                virtual void InvokeMethod(std::string const &method, Deserializer &, Serializer &)
+                // Generated stubs look the method up in the table of their interface
+                // and pass the call to the base interfaces if it is not there.
+                virtual void InvokeMethod(InterfaceId interfaceId, MethodId methodId, Deserializer &, Serializer &)
                 {
-                    throw ProxyStubException{"[Mif::Remote::Stub::InvokeMethod] Method \"" + method + "\" not found."};
+                    throw ProxyStubException{"[Mif::Remote::Stub::InvokeMethod] Method with id " +
+                        std::to_string(methodId) + " of interface with id " + std::to_string(interfaceId) + " not found."};
                 }
 
-                virtual bool ContainInterfaceId(std::string const &id) const
+                virtual bool ContainInterfaceId(InterfaceId id) const
                 {
                     Common::Unused(id);
                     return false;
@@ -510,7 +680,7 @@ namespace Mif
                                       Deserializer &deserializer, Serializer &serializer)
                 {
                     auto inst = Service::Cast<TInterface>(m_instance);
-                    auto tmpParams = deserializer.template GetParams<typename InterfaceTypeToString<TParams>::Type ... >();
+                    auto tmpParams = deserializer.template GetParams<typename InterfaceTypeToInstanceId<TParams>::Type ... >();
                     Services services;
                     auto params = PrepareParams<TParams ... >(std::move(tmpParams), services,
                             static_cast<Common::MakeIndexSequence<sizeof ... (TParams)> const *>(nullptr));
@@ -543,7 +713,7 @@ namespace Mif
                 // Specialization for pointers on interfaces based on IService
                 template <typename T>
                 typename std::enable_if<Traits::IsInterfaceRawPtr<T>(), T>::type
-                PrepareParam(std::string const &param, Services &services)
+                PrepareParam(InstanceId param, Services &services)
                 {
                     return PrepareParam<Service::TServicePtr<Traits::ExtractType<T>>>(param, services).get();
                 }
@@ -552,7 +722,7 @@ namespace Mif
                 // Specialization for references on interfaces based on IService
                 template <typename T>
                 typename std::enable_if<Traits::IsInterfaceRef<T>(), Traits::ExtractType<T>>::type &
-                PrepareParam(std::string const &param, Services &services)
+                PrepareParam(InstanceId param, Services &services)
                 {
                     Common::Unused(param);
                     Common::Unused(services);
@@ -563,10 +733,10 @@ namespace Mif
                 // Specialization for smart pointers on interfaces based on IService
                 template <typename T>
                 typename std::enable_if<Traits::IsInterfaceSmartPtr<T>(), T>::type
-                PrepareParam(std::string const &param, Services &services)
+                PrepareParam(InstanceId param, Services &services)
                 {
                     // TODO: add implementation for reference on smart pointer
-                    if (param.empty())
+                    if (!param)
                         return {};
                     StubCreator stubCreator{m_stubCreator};
                     Sender sender{m_sender};
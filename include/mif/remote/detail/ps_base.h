@@ -9,6 +9,8 @@
 #define __MIF_REMOTE_DETAIL_PS_BASE_H__
 
 // STD
+#include <future>
+#include <memory>
 #include <string>
 #include <tuple>
 #include <typeinfo>
@@ -61,9 +63,40 @@ namespace Mif
                 virtual ~BaseProxies() = default;
 
                 template <typename TResult, typename ... TParams>
-                TResult _Mif_Remote_Call_Method(std::string const &interfaceId, std::string const &method, TParams && ... params) const
+                TResult _Mif_Remote_Call_Method(MethodInfo const &method, TParams && ... params) const
                 {
-                    return m_proxy.template RemoteCall<TResult>(interfaceId, method, std::forward<TParams>(params) ... );
+                    return m_proxy.template RemoteCall<TResult>(method, std::forward<TParams>(params) ... );
+                }
+
+                template <typename TResult, typename ... TParams>
+                void _Mif_Remote_Call_Method_Async(AsyncHandler<TResult> handler, MethodInfo const &method,
+                        TParams && ... params) const
+                {
+                    Service::TServicePtr<TInterface> holder{const_cast<BaseProxies *>(this)};
+                    m_proxy.template RemoteCallAsync<TResult>(std::move(holder), std::move(handler),
+                            method, std::forward<TParams>(params) ... );
+                }
+
+                template <typename TResult, typename ... TParams>
+                std::future<TResult> _Mif_Remote_Call_Method_Future(MethodInfo const &method, TParams && ... params) const
+                {
+                    auto promise = std::make_shared<std::promise<TResult>>();
+                    auto future = promise->get_future();
+                    try
+                    {
+                        _Mif_Remote_Call_Method_Async<TResult>(
+                                [promise] (std::future<TResult> result)
+                                {
+                                    MoveFutureToPromise(result, *promise);
+                                },
+                                method, std::forward<TParams>(params) ...
+                            );
+                    }
+                    catch (...)
+                    {
+                        promise->set_exception(std::current_exception());
+                    }
+                    return future;
                 }
 
             private:
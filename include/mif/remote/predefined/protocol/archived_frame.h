@@ -13,8 +13,8 @@
 #include "mif/net/clients/parallel_handler.h"
 #include "mif/net/clients/frame_reader.h"
 #include "mif/net/clients/frame_writer.h"
-#include "mif/net/clients/gzip_compressor.h"
-#include "mif/net/clients/gzip_decompressor.h"
+#include "mif/net/clients/compressor.h"
+#include "mif/net/clients/decompressor.h"
 
 namespace Mif
 {
@@ -30,9 +30,9 @@ namespace Mif
                         <
                             Net::Clients::FrameReader,
                             Net::Clients::ParallelHandler,
-                            Net::Clients::GZipDecompressor,
+                            Net::Clients::Decompressor,
                             TClient,
-                            Net::Clients::GZipCompressor,
+                            Net::Clients::Compressor,
                             Net::Clients::FrameWriter
                         >;
 
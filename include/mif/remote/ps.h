@@ -10,14 +10,17 @@
 
 // STD
 #include <cstdint>
+#include <future>
 #include <string>
 #include <tuple>
 #include <type_traits>
 
 // MIF
+#include "mif/common/crc32.h"
 #include "mif/common/index_sequence.h"
 #include "mif/common/detail/method.h"
 #include "mif/remote/detail/ps_base.h"
+#include "mif/remote/types.h"
 
 #define MIF_REMOTE_PS_BEGIN(interface_) \
     template <typename TSerializer> \
@@ -26,7 +29,8 @@
     public: \
         using ThisType = interface_ ## _PS <TSerializer>; \
         using InterfaceType = interface_; \
-        static constexpr auto InterfaceId = #interface_; \
+        static constexpr auto InterfaceName = #interface_; \
+        enum : ::Mif::Remote::InterfaceId { InterfaceId = ::Mif::Common::Crc32(#interface_) }; \
     private: \
         template <typename TBase> \
         class ProxyBase \
@@ -54,6 +58,7 @@
                 ::Mif::Common::Detail::FakeHierarchy{}))>::type; \
         template <typename TBase> \
         using MethodStubs = decltype(ThisType::GetStubBase<TBase>(::Mif::Common::Detail::FakeHierarchy{})); \
+        enum { MethodCount = sizeof(GetNextCounter(static_cast<::Mif::Common::Detail::FakeHierarchy *>(nullptr))) - 1 }; \
     public: \
         template <typename TBase = ::Mif::Remote::Detail::InheritProxy<TSerializer, InterfaceType>> \
         using ProxyItem = MethodProxies<TBase>; \
@@ -62,17 +67,36 @@
         class StubItem \
             : public MethodStubs<TBase> \
         { \
+        private: \
+            template <std::size_t ... Indexes> \
+            static ::Mif::Remote::Detail::MethodTable \
+                < \
+                    TSerializer, \
+                    StubItem, \
+                    decltype(ThisType::GetStubBase<TBase>(::Mif::Common::Detail::Hierarchy<Indexes + 2>{})) ... \
+                > \
+            GetMethodTable(::Mif::Common::IndexSequence<Indexes ... >); \
+            using MethodTable = decltype(GetMethodTable(::Mif::Common::MakeIndexSequence<MethodCount>{})); \
         protected: \
             using MethodStubs<TBase>::MethodStubs; \
             using Serializer = typename MethodStubs<TBase>::Serializer; \
             using Deserializer = typename MethodStubs<TBase>::Deserializer; \
-            virtual bool ContainInterfaceId(std::string const &id) const \
+            virtual bool ContainInterfaceId(::Mif::Remote::InterfaceId id) const \
             { \
-                return InterfaceId == id || MethodStubs<TBase>::ContainInterfaceId(id); \
+                return id == InterfaceId || MethodStubs<TBase>::ContainInterfaceId(id); \
             } \
-            virtual void InvokeMethod(std::string const &method, Deserializer &deserializer, Serializer &serializer) \
+            virtual void InvokeMethod(::Mif::Remote::InterfaceId interfaceId, ::Mif::Remote::MethodId methodId, \
+                    Deserializer &deserializer, Serializer &serializer) \
             { \
-                MethodStubs<TBase>::InvokeMethod(method, deserializer, serializer); \
+                if (interfaceId == InterfaceId) \
+                { \
+                    if (auto handler = MethodTable::Find(methodId)) \
+                    { \
+                        handler(*this, deserializer, serializer); \
+                        return; \
+                    } \
+                } \
+                MethodStubs<TBase>::InvokeMethod(interfaceId, methodId, deserializer, serializer); \
             } \
         }; \
         using Stub = StubItem<>; \
@@ -94,8 +118,39 @@
         { \
             return this->template _Mif_Remote_Call_Method<ResultType> \
                 ( \
-                    InterfaceId, \
-                    #method_, \
+                    method_ ## _GetMethodInfo(), \
+                    std::forward \
+                    < \
+                        typename std::tuple_element<Indexes, typename method_ ## _Info ::ParamTypeList>::type \
+                    > \
+                    (params) \
+                ... ); \
+        } \
+    public: \
+        void method_ ## Async \
+            ( \
+                typename std::tuple_element<Indexes, typename method_ ## _Info ::ParamTypeList>::type ... params, \
+                ::Mif::Remote::Detail::AsyncHandler<ResultType> handler \
+            ) const_ \
+        { \
+            this->template _Mif_Remote_Call_Method_Async<ResultType> \
+                ( \
+                    std::move(handler), \
+                    method_ ## _GetMethodInfo(), \
+                    std::forward \
+                    < \
+                        typename std::tuple_element<Indexes, typename method_ ## _Info ::ParamTypeList>::type \
+                    > \
+                    (params) \
+                ... ); \
+        } \
+        std::future<ResultType> method_ ## Async \
+            (typename std::tuple_element<Indexes, typename method_ ## _Info ::ParamTypeList>::type ... params) \
+            const_ \
+        { \
+            return this->template _Mif_Remote_Call_Method_Future<ResultType> \
+                ( \
+                    method_ ## _GetMethodInfo(), \
                     std::forward \
                     < \
                         typename std::tuple_element<Indexes, typename method_ ## _Info ::ParamTypeList>::type \
@@ -110,6 +165,11 @@
 
 #define MIF_REMOTE_METHOD(method_) \
     using method_ ## _Info = ::Mif::Common::Detail::Method<decltype(&InterfaceType :: method_)>; \
+    enum : ::Mif::Remote::MethodId { method_ ## _Id = ::Mif::Common::Crc32(#method_) }; \
+    static ::Mif::Remote::Detail::MethodInfo method_ ## _GetMethodInfo() \
+    { \
+        return {InterfaceId, method_ ## _Id, InterfaceName, #method_}; \
+    } \
     enum { method_ ## _Index = sizeof(GetNextCounter(static_cast<::Mif::Common::Detail::FakeHierarchy *>(nullptr))) }; \
     using method_ ## _IndexSequence = ::Mif::Common::MakeIndexSequence<std::tuple_size<typename method_ ## _Info ::ParamTypeList>::value>; \
     template <typename TBase> \
@@ -143,12 +203,12 @@
         { \
             return instance. method_ (std::get<Indexes>(params) ... ); \
         } \
-        virtual void InvokeMethod(std::string const &method, Deserializer &deserializer, Serializer &serializer) override \
+    public: \
+        enum : ::Mif::Remote::MethodId { _Mif_Remote_Method_Id = method_ ## _Id }; \
+        template <typename TStub> \
+        static void _Mif_Remote_Invoke(TStub &stub, Deserializer &deserializer, Serializer &serializer) \
         { \
-            if (method != #method_) \
-                BaseType::InvokeMethod(method, deserializer, serializer); \
-            else \
-                BaseType::InvokeRealMethod(& method_ ## _Mif_Remote_Stub :: Invoke, deserializer, serializer); \
+            stub.InvokeRealMethod(& method_ ## _Mif_Remote_Stub :: Invoke, deserializer, serializer); \
         } \
     }; \
     template <typename TBase, std::size_t ... Indexes> \
@@ -9,22 +9,28 @@
 #define __MIF_REMOTE_PS_CLIENT_H__
 
 // STD
+#include <algorithm>
+#include <atomic>
 #include <chrono>
-#include <condition_variable>
+#include <exception>
 #include <functional>
+#include <future>
 #include <map>
 #include <memory>
 #include <mutex>
 #include <stdexcept>
 #include <string>
 #include <sstream>
-#include <thread>
 #include <utility>
 
 // MIF
+#include "mif/common/log.h"
+#include "mif/common/timer.h"
 #include "mif/net/client.h"
 #include "mif/remote/detail/meta/iobject_manager.h"
+#include "mif/remote/detail/pending_calls.h"
 #include "mif/remote/meta/iservice.h"
+#include "mif/remote/types.h"
 #include "mif/service/factory.h"
 #include "mif/service/make.h"
 
@@ -45,6 +51,7 @@ namespace Mif
                 Service::IFactoryPtr factory = Service::Make<Service::Factory, Service::IFactory>())
                 : Client{control, publisher}
                 , m_timeout{timeout}
+                , m_pendingCalls{timeout}
             {
                 using ObjectManagerStub = typename Detail::Meta::IObjectManager_PS<TSerializer>::Stub;
                 m_stubObjectManager = Service::Make<ObjectManager, ObjectManager>(this, std::move(factory));
@@ -71,11 +78,12 @@ namespace Mif
             using Deserializer = typename TSerializer::Deserializer;
 
             using DeserializerPtr = std::unique_ptr<Deserializer>;
-            using Response = std::pair<std::chrono::microseconds/*timestamp*/, DeserializerPtr>;
-            using Responses = std::map<std::string/*uuid*/, Response>;
+            using ResponseHandler = typename Detail::Proxy<TSerializer>::ResponseHandler;
+            using PendingCalls = Detail::PendingCalls<ResponseHandler>;
+            using ResponseHandlers = typename PendingCalls::Handlers;
 
             using IStubPtr = std::shared_ptr<Detail::IStub<TSerializer>>;
-            using Stubs = std::map<std::string/*instance id*/, IStubPtr>;
+            using Stubs = std::map<InstanceId, IStubPtr>;
 
             class ObjectManager
                 : public Service::Inherit<Detail::IObjectManager>
@@ -96,25 +104,23 @@ namespace Mif
                 }
 
             private:
-                Common::UuidGenerator m_uuidGenerator;
+                // The handles are given in turn, 0 is a null reference and 1 is the object manager.
+                std::atomic<InstanceId> m_nextInstanceId{2};
 
                 ThisType *m_owner;
 
                 Service::IFactoryPtr m_factory;
 
                 // IObjectManager
-                virtual std::string CreateObject(Service::ServiceId serviceId, std::string const &interfaceId) override final
+                virtual InstanceId CreateObject(Service::ServiceId serviceId, InterfaceId interfaceId) override final
                 {
-                    if (interfaceId.empty())
-                        throw std::invalid_argument{"[Mif::Remote::PSClient::CreateObject] Parameter \"interfaceId\" must not be empty."};
-
                     auto instance = m_factory->Create(serviceId);
                     return AppendStub(std::move(instance), interfaceId);
                 }
 
-                virtual void DestroyObject(std::string const &instanceId) override final
+                virtual void DestroyObject(InstanceId instanceId) override final
                 {
-                    if (instanceId.empty())
+                    if (!instanceId)
                         throw std::invalid_argument{"[Mif::Remote::PSClient::DestrowObject] Parameter \"instanceId\" must not be empty."};
 
                     IStubPtr stubService;
@@ -124,14 +130,14 @@ namespace Mif
                         if (iter == std::end(m_owner->m_stubs))
                         {
                             throw std::invalid_argument{"[Mif::Remote::PSClient::DestroyObject] "
-                                "Instance with id \"" + instanceId + "\" not found."};
+                                "Instance with id " + std::to_string(instanceId) + " not found."};
                         }
                         stubService = std::move(iter->second);
                         m_owner->m_stubs.erase(iter);
                     }
                 }
 
-                virtual std::string QueryInterface(std::string const &instanceId, std::string const &interfaceId,
+                virtual InstanceId QueryInterface(InstanceId instanceId, InterfaceId interfaceId,
                         std::string const &serviceId) override final
                 {
                     IStubPtr stub;
@@ -141,7 +147,7 @@ namespace Mif
                         if (iter == std::end(m_owner->m_stubs))
                         {
                             throw std::invalid_argument{"[Mif::Remote::PSClient::QueryInterface] "
-                                "Instance with id \"" + instanceId + "\" not found."};
+                                "Instance with id " + std::to_string(instanceId) + " not found."};
                         }
                         stub = iter->second;
                     }
@@ -153,8 +159,7 @@ namespace Mif
                     return AppendStub(std::move(instance), interfaceId);
                 }
 
-                virtual std::string CloneReference(std::string const &instanceId,
-                        std::string const &interfaceId) override final
+                virtual InstanceId CloneReference(InstanceId instanceId, InterfaceId interfaceId) override final
                 {
                     Service::IServicePtr instance;
                     {
@@ -163,7 +168,7 @@ namespace Mif
                         if (iter == std::end(m_owner->m_stubs))
                         {
                             throw std::invalid_argument{"[Mif::Remote::PSClient::CloneReference] "
-                                "Instance with id \"" + instanceId + "\" not found."};
+                                "Instance with id " + std::to_string(instanceId) + " not found."};
                         }
                         instance = iter->second->GetInstance();
                     }
@@ -178,14 +183,14 @@ namespace Mif
 
                     template <typename T>
                     static Result Visit(ObjectManager *objectManager, Service::IServicePtr instance,
-                        std::string const &instanceId, std::string const &interfaceId)
+                        InstanceId instanceId, InterfaceId interfaceId)
                     {
                         if (T::InterfaceId == interfaceId)
                         {
                             auto self = Service::TServicePtr<ObjectManager>{objectManager};
                             auto stubCreator = objectManager->GetStubCreator();
                             auto sender = std::bind(&ThisType::Send, objectManager->m_owner,
-                                    std::placeholders::_1, std::placeholders::_2);
+                                    std::placeholders::_1, std::placeholders::_2, std::placeholders::_3);
                             return std::make_shared<typename T::Stub>(std::move(instance), instanceId,
                                     objectManager->m_owner->GetProxyObjectManager(),
                                     std::move(stubCreator), std::move(sender));
@@ -194,53 +199,62 @@ namespace Mif
                     }
                 };
 
-                std::string AppendStub(Service::IServicePtr instance, std::string const &interfaceId)
+                InstanceId AppendStub(Service::IServicePtr instance, InterfaceId interfaceId)
                 {
                     if (!instance)
                         return {};
 
-                    auto const instanceId = m_uuidGenerator.Generate();
-
+                    // The handle is reserved before the stub is made, the stub is set into it later.
+                    InstanceId instanceId = 0;
                     {
                         LockGuard lock(m_owner->m_lock);
-                        if (m_owner->m_stubs.find(instanceId) != std::end(m_owner->m_stubs))
-                            return instanceId;
+                        do
+                        {
+                            instanceId = m_nextInstanceId++;
+                        }
+                        while (instanceId <= m_owner->m_psInstanceId ||
+                                !m_owner->m_stubs.insert(std::make_pair(instanceId, IStubPtr{})).second);
                     }
 
-
-                    auto stub = Detail::Registry::Visitor::Accept<CreateStubVisitor>(this,
-                            std::move(instance), instanceId, interfaceId);
-
+                    IStubPtr stub;
+                    try
+                    {
+                        stub = Detail::Registry::Visitor::Accept<CreateStubVisitor>(this,
+                                std::move(instance), instanceId, interfaceId);
+                    }
+                    catch (...)
                     {
                         LockGuard lock(m_owner->m_lock);
+                        m_owner->m_stubs.erase(instanceId);
+                        throw;
+                    }
 
-                        if (m_owner->m_stubs.find(instanceId) != std::end(m_owner->m_stubs))
-                            return instanceId;
-
-                        m_owner->m_stubs.insert(std::make_pair(instanceId, std::move(stub)));
+                    {
+                        LockGuard lock(m_owner->m_lock);
+                        m_owner->m_stubs[instanceId] = std::move(stub);
                     }
 
                     return instanceId;
-            }
+                }
 
             };
 
             friend class ObjectManager;
 
-            std::string const m_psInstanceId = "0";
+            InstanceId const m_psInstanceId = 1;
 
             std::chrono::microseconds const m_timeout;
 
-            std::condition_variable m_condVar;
-
             LockType m_lock;
             Detail::IObjectManagerPtr m_proxyObjectManager;
             Service::TIntrusivePtr<ObjectManager> m_stubObjectManager;
 
             Stubs m_stubs;
 
-            LockType m_dataLock;
-            Responses m_responses;
+            PendingCalls m_pendingCalls;
+
+            std::once_flag m_expirationFlag;
+            std::unique_ptr<Common::PeriodicTimer> m_expirationTimer;
 
             Detail::IObjectManagerPtr GetProxyObjectManager()
             {
@@ -249,21 +263,61 @@ namespace Mif
                 {
                     using ObjectManagerProxy = typename Detail::Meta::IObjectManager_PS<TSerializer>::Proxy;
                     m_proxyObjectManager = Service::Make<ObjectManagerProxy, Detail::IObjectManager>(m_psInstanceId, std::bind(&ThisType::Send,
-                            std::static_pointer_cast<ThisType>(shared_from_this()), std::placeholders::_1, std::placeholders::_2),
-                            [] (Service::IServicePtr, std::string const &interfaceId) -> std::string
+                            std::static_pointer_cast<ThisType>(shared_from_this()), std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3),
+                            [] (Service::IServicePtr, InterfaceId interfaceId) -> InstanceId
                             {
                                 throw Detail::ProxyStubException{"[Mif::Remote::PSClient::GetProxyObjectManager] "
-                                    "Failed to create proxy from ObjectManager. Interface id \"" + interfaceId + "\""};
+                                    "Failed to create proxy from ObjectManager. Interface id " + std::to_string(interfaceId)};
                             }
                         );
                 }
                 return m_proxyObjectManager;
             }
 
-            DeserializerPtr Send(std::string const &requestId, Serializer &serializer)
+            DeserializerPtr Send(RequestId requestId, Serializer &serializer, ResponseHandler handler)
             {
+                if (handler)
+                {
+                    RegisterCall(requestId, std::move(handler));
+                    PostRequest(requestId, serializer);
+                    return {};
+                }
+
+                auto promise = std::make_shared<std::promise<DeserializerPtr>>();
+                auto future = promise->get_future();
+                RegisterCall(requestId,
+                        [promise] (DeserializerPtr deserializer, std::exception_ptr exception)
+                        {
+                            if (exception)
+                                promise->set_exception(exception);
+                            else
+                                promise->set_value(std::move(deserializer));
+                        }
+                    );
+                PostRequest(requestId, serializer);
+
+                if (future.wait_for(m_timeout) != std::future_status::ready && m_pendingCalls.Erase(requestId))
+                {
+                    throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to send data. "
+                        "Expired response timeout from remote server."};
+                }
+
+                return future.get();
+            }
+
+            void PostRequest(RequestId requestId, Serializer &serializer)
+            {
+                if (IsClosed())
+                {
+                    m_pendingCalls.Erase(requestId);
+                    throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to send data. "
+                        "Connection was closed by remote server."};
+                }
+
                 if (!Post(std::move(serializer.GetBuffer())))
                 {
+                    m_pendingCalls.Erase(requestId);
                     if (!CloseMe())
                     {
                         throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to post request. "
@@ -272,44 +326,16 @@ namespace Mif
                     throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to post request. "
                         "No channel for post data."};
                 }
+            }
 
-                for (auto t = GetCurTime() ; (GetCurTime() - t) < m_timeout ; )
+            void RegisterCall(RequestId requestId, ResponseHandler handler)
+            {
+                std::call_once(m_expirationFlag, [this] { StartExpiration(); });
+                if (!m_pendingCalls.Insert(requestId, std::move(handler)))
                 {
-                    std::this_thread::sleep_for(std::chrono::microseconds(1));
-
-                    {
-                        std::unique_lock<LockType> lock{m_dataLock};
-                        typename Responses::iterator iter = std::end(m_responses);
-                        auto waitResult = m_condVar.wait_for(lock, m_timeout,
-                                [this, &requestId, &iter] ()
-                                {
-                                    iter = m_responses.find(requestId);
-                                    return iter != std::end(m_responses) || IsClosed();
-                                }
-                            );
-                        if (IsClosed())
-                        {
-                            throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to send data. "
-                                "Connection was closed by remote server."};
-                        }
-                        if (waitResult)
-                        {
-                            auto deserializer = std::move(iter->second.second);
-                            m_responses.erase(iter);
-
-                            CleanOldResponses();
-
-                            return std::move(deserializer);
-                        }
-
-                        CleanOldResponses();
-                    }
-
-                    std::this_thread::sleep_for(std::chrono::microseconds(5));
+                    throw Detail::ProxyStubException{"[Mif::Remote::PSClient::RegisterCall] Request id " +
+                        std::to_string(requestId) + " not unique."};
                 }
-
-                throw Detail::ProxyStubException{"[Mif::Remote::PSClient::Send] Failed to send data. "
-                    "Expired response timeout from remote server."};
             }
 
             // Client
@@ -320,35 +346,17 @@ namespace Mif
                     if (buffer.empty())
                         throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Empty data."};
                     DeserializerPtr deserializer{new Deserializer(std::move(buffer))};
-                    auto const uuid = deserializer->GetUuid();
-                    if (uuid.empty())
-                        throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Empty package id (no uuid)."};
-                    auto const &instanceId = deserializer->GetInstance();
-                    if (instanceId.empty())
+                    auto const requestId = deserializer->GetRequestId();
+                    auto const instanceId = deserializer->GetInstance();
+                    if (!instanceId)
                         throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Empty instance id."};
-                    auto const &interfaceId = deserializer->GetInterface();
-                    if (interfaceId.empty())
-                    {
-                        throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Empty interface id for instanse "
-                            "\"" + instanceId + "\""};
-                    }
-                    auto const &method = deserializer->GetMethod();
-                    if (method.empty())
-                    {
-                        throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Empty method name of interface "
-                            "\"" + interfaceId  + "\" for instance \"" + instanceId + "\""};
-                    }
                     if (deserializer->IsResponse())
                     {
-                        Response response{GetCurTime(), std::move(deserializer)};
-                        {
-                            LockGuard lock{m_dataLock};
-                            CleanOldResponses();
-                            m_responses.insert(std::make_pair(uuid, std::move(response)));
-                        }
-                        m_condVar.notify_all();
+                        ResponseHandler handler;
+                        if (m_pendingCalls.Extract(requestId, handler))
+                            CallHandler(handler, std::move(deserializer), {});
                     }
-                    else if (m_responses.find(uuid) == std::end(m_responses))
+                    else if (!m_pendingCalls.Contains(requestId))
                     {
                         IStubPtr stub;
                         {
@@ -358,24 +366,28 @@ namespace Mif
                                 stub = iter->second;
                         }
                         if (!stub)
-                            throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Instance \"" + instanceId + "\" not found."};
-                        Serializer serializer(false, uuid, instanceId, interfaceId, method);
+                        {
+                            throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Instance " +
+                                std::to_string(instanceId) + " not found."};
+                        }
+                        Serializer serializer(false, requestId, instanceId, deserializer->GetInterface(),
+                                deserializer->GetMethod());
                         stub->Call(*deserializer, serializer);
                         if (!Post(std::move(serializer.GetBuffer())))
                         {
                             if (!CloseMe())
                             {
-                                throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Failed to post response from instance "
-                                    "\"" + instanceId + "\". No channel for post data and failed to close self."};
+                                throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Failed to post response from instance " +
+                                    std::to_string(instanceId) + ". No channel for post data and failed to close self."};
                             }
-                            throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Failed to post response from instanse "
-                                "\"" + instanceId + "\". No channel for post data."};
+                            throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Failed to post response from instanse " +
+                                std::to_string(instanceId) + ". No channel for post data."};
                         }
                     }
                     else
                     {
-                        throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Response id "
-                            "\"" + uuid + "\" not unique."};
+                        throw Detail::ProxyStubException{"[Mif::Remote::PSClient::ProcessData] Response id " +
+                            std::to_string(requestId) + " not unique."};
                     }
                 }
                 catch (Detail::ProxyStubException const &)
@@ -396,24 +408,54 @@ namespace Mif
 
             virtual void Close() override final
             {
-                m_condVar.notify_all();
+                ResponseHandlers handlers;
+                m_pendingCalls.ExtractAll(handlers);
+                FailCalls(handlers, "Connection was closed by remote server.");
             }
 
-            std::chrono::microseconds GetCurTime() const
+            // The calls are expired by the timer, so they fail in time on an idle connection as well.
+            // The timer holds the client weakly and is started on the first call, when the client
+            // is already owned by a shared pointer.
+            void StartExpiration()
             {
-                return std::chrono::duration_cast<std::chrono::microseconds>(
-                    std::chrono::system_clock::now().time_since_epoch());
+                std::weak_ptr<ThisType> self = std::static_pointer_cast<ThisType>(shared_from_this());
+                auto const period = std::max<std::chrono::microseconds>(m_pendingCalls.GetTick(),
+                        std::chrono::milliseconds{1});
+                m_expirationTimer.reset(new Common::PeriodicTimer{period, [self]
+                        {
+                            if (auto client = self.lock())
+                                client->ExpireCalls();
+                        }
+                    });
             }
 
-            void CleanOldResponses()
+            void ExpireCalls()
             {
-                auto const now = GetCurTime();
-                for (auto i = std::begin(m_responses) ; i != std::end(m_responses) ; )
+                ResponseHandlers expired;
+                m_pendingCalls.ExtractExpired(expired);
+                FailCalls(expired, "Expired response timeout from remote server.");
+            }
+
+            void FailCalls(ResponseHandlers &handlers, std::string const &reason)
+            {
+                for (auto &i : handlers)
                 {
-                    if (i->second.first < now && (now - i->second.first) > m_timeout)
-                        m_responses.erase(i++);
-                    else
-                        ++i;
+                    auto exception = std::make_exception_ptr(Detail::ProxyStubException{
+                            "[Mif::Remote::PSClient] Failed to send data. " + reason});
+                    CallHandler(i, {}, exception);
+                }
+            }
+
+            void CallHandler(ResponseHandler &handler, DeserializerPtr deserializer, std::exception_ptr exception)
+            {
+                try
+                {
+                    handler(std::move(deserializer), exception);
+                }
+                catch (std::exception const &e)
+                {
+                    MIF_LOG(Warning) << "[Mif::Remote::PSClient::CallHandler] "
+                        << "Failed to call response handler. Error: " << e.what();
                 }
             }
 
@@ -423,13 +465,14 @@ namespace Mif
                 try
                 {
                     auto self = std::static_pointer_cast<ThisType>(shared_from_this());
-                    auto sender = std::bind(&ThisType::Send, self, std::placeholders::_1, std::placeholders::_2);
+                    auto sender = std::bind(&ThisType::Send, self, std::placeholders::_1, std::placeholders::_2,
+                            std::placeholders::_3);
                     auto stubCreator = m_stubObjectManager->GetStubCreator();
 
                     using PSType = typename Detail::Registry::Registry<TInterface>::template Type<TSerializer>;
                     using ProxyType = typename PSType::Proxy;
 
-                    return Service::Make<ProxyType>(GetProxyObjectManager(), serviceId, std::string{PSType::InterfaceId},
+                    return Service::Make<ProxyType>(GetProxyObjectManager(), serviceId, PSType::InterfaceId,
                             std::move(sender), std::move(stubCreator));
                 }
                 catch (std::exception const &e)
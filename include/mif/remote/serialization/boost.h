@@ -46,6 +46,7 @@
 #include "mif/common/types.h"
 #include "mif/common/unused.h"
 #include "mif/remote/serialization/detail/tag.h"
+#include "mif/remote/types.h"
 #include "mif/serialization/boost.h"
 
 namespace Mif
@@ -72,11 +73,10 @@ namespace Mif
                 {
                 public:
                     template <typename ... TParams>
-                    Serializer(bool isReques, std::string const &uuid,
-                        std::string const &instanceId, std::string const &interfaceId,
-                        std::string const &methodId, TParams && ... params)
-                        : m_type{isReques ? Detail::Tag::Request::Value : Detail::Tag::Response::Value}
-                        , m_uuid{uuid}
+                    Serializer(bool isRequest, RequestId requestId, InstanceId instanceId,
+                        InterfaceId interfaceId, MethodId methodId, TParams && ... params)
+                        : m_isRequest{isRequest}
+                        , m_requestId{requestId}
                         , m_instanceId{instanceId}
                         , m_interfaceId{interfaceId}
                         , m_methodId{methodId}
@@ -103,8 +103,8 @@ namespace Mif
                             boost::iostreams::filtering_ostream stream(boost::iostreams::back_inserter(result));
                             TArchive archive{stream};
 
-                            archive << boost::serialization::make_nvp(Detail::Tag::Uuid::Value, m_uuid);
-                            archive << boost::serialization::make_nvp(Detail::Tag::Type::Value, m_type);
+                            archive << boost::serialization::make_nvp(Detail::Tag::Id::Value, m_requestId);
+                            archive << boost::serialization::make_nvp(Detail::Tag::Type::Value, m_isRequest);
                             archive << boost::serialization::make_nvp(Detail::Tag::Instsnce::Value, m_instanceId);
                             archive << boost::serialization::make_nvp(Detail::Tag::Interface::Value, m_interfaceId);
                             archive << boost::serialization::make_nvp(Detail::Tag::Method::Value, m_methodId);
@@ -139,11 +139,11 @@ namespace Mif
                     }
 
                 private:
-                    std::string m_type;
-                    std::string m_uuid;
-                    std::string m_instanceId;
-                    std::string m_interfaceId;
-                    std::string m_methodId;
+                    bool m_isRequest;
+                    RequestId m_requestId;
+                    InstanceId m_instanceId;
+                    InterfaceId m_interfaceId;
+                    MethodId m_methodId;
                     std::exception_ptr m_exception{};
 
                     struct IData
@@ -180,7 +180,7 @@ namespace Mif
                         }
 
                         template <typename ... T>
-                        typename std::enable_if<std::tuple_size<std::tuple<T ... >>::value, void>::type
+                        typename std::enable_if<std::tuple_size<std::tuple<T ... >>::value != 0, void>::type
                         SaveParams(std::tuple<T ... > &params, TArchive &archive) const
                         {
                             SaveTupleParams(params, archive,
@@ -188,7 +188,7 @@ namespace Mif
                         }
 
                         template <typename ... T>
-                        typename std::enable_if< !std::tuple_size<std::tuple<T ... >>::value, void>::type
+                        typename std::enable_if<std::tuple_size<std::tuple<T ... >>::value == 0, void>::type
                         SaveParams(std::tuple<T ... > &, TArchive &) const
                         {
                         }
@@ -207,8 +207,8 @@ namespace Mif
                     {
                         if (m_buffer.empty())
                             throw std::invalid_argument{"[Mif::Remote::Serialization::Boost::Deserializer] Empty buffer."};
-                        m_archive >> boost::serialization::make_nvp(Detail::Tag::Uuid::Value, m_uuid);
-                        m_archive >> boost::serialization::make_nvp(Detail::Tag::Type::Value, m_type);
+                        m_archive >> boost::serialization::make_nvp(Detail::Tag::Id::Value, m_requestId);
+                        m_archive >> boost::serialization::make_nvp(Detail::Tag::Type::Value, m_isRequest);
                         m_archive >> boost::serialization::make_nvp(Detail::Tag::Instsnce::Value, m_instance);
                         m_archive >> boost::serialization::make_nvp(Detail::Tag::Interface::Value, m_interface);
                         m_archive >> boost::serialization::make_nvp(Detail::Tag::Method::Value, m_method);
@@ -230,37 +230,32 @@ namespace Mif
                         }
                     }
 
-                    std::string const& GetUuid() const
+                    RequestId GetRequestId() const
                     {
-                        return m_uuid;
+                        return m_requestId;
                     }
 
                     bool IsRequest() const
                     {
-                        return GetType() == Detail::Tag::Request::Value;
+                        return m_isRequest;
                     }
 
                     bool IsResponse() const
                     {
-                        return GetType() == Detail::Tag::Response::Value;
+                        return !m_isRequest;
                     }
 
-                    std::string const& GetType() const
-                    {
-                        return m_type;
-                    }
-
-                    std::string const& GetInstance() const
+                    InstanceId GetInstance() const
                     {
                         return m_instance;
                     }
 
-                    std::string const& GetInterface() const
+                    InterfaceId GetInterface() const
                     {
                         return m_interface;
                     }
 
-                    std::string const& GetMethod() const
+                    MethodId GetMethod() const
                     {
                         return m_method;
                     }
@@ -296,15 +291,15 @@ namespace Mif
                     SourceType m_source;
                     boost::iostreams::stream<SourceType> m_stream;
                     mutable TArchive m_archive;
-                    std::string m_uuid;
-                    std::string m_type;
-                    std::string m_instance;
-                    std::string m_interface;
-                    std::string m_method;
+                    RequestId m_requestId = 0;
+                    bool m_isRequest = false;
+                    InstanceId m_instance = 0;
+                    InterfaceId m_interface = 0;
+                    MethodId m_method = 0;
                     std::exception_ptr m_exception;
 
                     template <std::size_t Index, typename TParams,
-                              typename = typename std::enable_if<Index>::type>
+                              typename = typename std::enable_if<Index != 0>::type>
                     void LoadParams(std::integral_constant<std::size_t, Index> const *,
                                    TParams &params) const
                     {
@@ -23,7 +23,7 @@ namespace Mif
                 {
 
                     using Pack = MIF_STATIC_STR("package");
-                    using Uuid = MIF_STATIC_STR("uuid");
+                    using Id = MIF_STATIC_STR("id");
                     using Type = MIF_STATIC_STR("type");
                     using Request = MIF_STATIC_STR("request");
                     using Response = MIF_STATIC_STR("response");
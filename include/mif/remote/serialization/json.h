@@ -21,6 +21,7 @@
 // MIF
 #include "mif/common/types.h"
 #include "mif/remote/serialization/detail/tag.h"
+#include "mif/remote/types.h"
 #include "mif/serialization/json.h"
 
 namespace Mif
@@ -36,17 +37,16 @@ namespace Mif
                 {
                 public:
                     template <typename ... TParams>
-                    Serializer(bool isReques, std::string const &uuid,
-                        std::string const &instanceId, std::string const &interfaceId,
-                        std::string const &methodId, TParams && ... params)
+                    Serializer(bool isRequest, RequestId requestId, InstanceId instanceId,
+                        InterfaceId interfaceId, MethodId methodId, TParams && ... params)
                     {
-                        m_value[Detail::Tag::Uuid::Value] = uuid;
-                        m_value[Detail::Tag::Type::Value] = isReques ?
+                        m_value[Detail::Tag::Id::Value] = ::Json::UInt64{requestId};
+                        m_value[Detail::Tag::Type::Value] = isRequest ?
                             Detail::Tag::Request::Value :
                             Detail::Tag::Response::Value;
-                        m_value[Detail::Tag::Instsnce::Value] = instanceId;
-                        m_value[Detail::Tag::Interface::Value] = interfaceId;
-                        m_value[Detail::Tag::Method::Value] = methodId;
+                        m_value[Detail::Tag::Instsnce::Value] = ::Json::UInt{instanceId};
+                        m_value[Detail::Tag::Interface::Value] = ::Json::UInt{interfaceId};
+                        m_value[Detail::Tag::Method::Value] = ::Json::UInt{methodId};
 
                         PutParamsIfExists(std::forward<TParams>(params) ... );
                     }
@@ -91,14 +91,14 @@ namespace Mif
                     ::Json::Value m_value{::Json::objectValue};
 
                     template <typename ... TParams>
-                    typename std::enable_if<sizeof ... (TParams), void>::type
+                    typename std::enable_if<sizeof ... (TParams) != 0, void>::type
                     PutParamsIfExists(TParams && ... params)
                     {
                         PutParams(std::forward<TParams> (params) ... );
                     }
 
                     template <typename ... TParams>
-                    typename std::enable_if< !sizeof ... (TParams), void>::type
+                    typename std::enable_if<sizeof ... (TParams) == 0, void>::type
                     PutParamsIfExists(TParams && ...)
                     {
                     }
@@ -123,9 +123,9 @@ namespace Mif
                             throw std::invalid_argument{"[Mif::Remote::Serialization::Json::Deserializer] Json is no object type."};
                     }
 
-                    std::string const GetUuid() const
+                    RequestId GetRequestId() const
                     {
-                        return m_value.get(Detail::Tag::Uuid::Value, "").asString();
+                        return m_value.get(Detail::Tag::Id::Value, 0).asUInt64();
                     }
 
                     bool IsRequest() const
@@ -138,24 +138,19 @@ namespace Mif
                         return GetType() == Detail::Tag::Response::Value;
                     }
 
-                    std::string const GetType() const
+                    InstanceId GetInstance() const
                     {
-                        return m_value.get(Detail::Tag::Type::Value, "").asString();
-                    }
-
-                    std::string const GetInstance() const
-                    {
-                        return m_value.get(Detail::Tag::Instsnce::Value, "").asString();
+                        return m_value.get(Detail::Tag::Instsnce::Value, 0).asUInt();
                     }
 
-                    std::string const GetInterface() const
+                    InterfaceId GetInterface() const
                     {
-                        return m_value.get(Detail::Tag::Interface::Value, "").asString();
+                        return m_value.get(Detail::Tag::Interface::Value, 0).asUInt();
                     }
 
-                    std::string const GetMethod() const
+                    MethodId GetMethod() const
                     {
-                        return m_value.get(Detail::Tag::Method::Value, "").asString();
+                        return m_value.get(Detail::Tag::Method::Value, 0).asUInt();
                     }
 
                     template <typename ... TParams>
@@ -192,8 +187,13 @@ namespace Mif
                 private:
                     ::Json::Value m_value;
 
+                    std::string GetType() const
+                    {
+                        return m_value.get(Detail::Tag::Type::Value, "").asString();
+                    }
+
                     template <typename ... TParams>
-                    typename std::enable_if<sizeof ... (TParams), std::tuple<typename std::decay<TParams>::type ... >>::type
+                    typename std::enable_if<sizeof ... (TParams) != 0, std::tuple<typename std::decay<TParams>::type ... >>::type
                     GetParamsIfExists() const
                     {
                         using TResult = std::tuple<typename std::decay<TParams>::type ... >;
@@ -203,7 +203,7 @@ namespace Mif
                     }
 
                     template <typename ... TParams>
-                    typename std::enable_if< !sizeof ... (TParams), std::tuple<>>::type
+                    typename std::enable_if<sizeof ... (TParams) == 0, std::tuple<>>::type
                     GetParamsIfExists() const
                     {
                         return {};
@@ -27,6 +27,7 @@
 // MIF
 #include "mif/common/types.h"
 #include "mif/remote/serialization/detail/tag.h"
+#include "mif/remote/types.h"
 #include "mif/serialization/xml.h"
 
 namespace Mif
@@ -42,9 +43,8 @@ namespace Mif
                 {
                 public:
                     template <typename ... TParams>
-                    Serializer(bool isReques, std::string const &uuid,
-                        std::string const &instanceId, std::string const &interfaceId,
-                        std::string const &methodId, TParams && ... params)
+                    Serializer(bool isRequest, RequestId requestId, InstanceId instanceId,
+                        InterfaceId interfaceId, MethodId methodId, TParams && ... params)
                     {
                         {
                             auto decl = m_doc.append_child(pugi::xml_node_type::node_declaration);
@@ -54,25 +54,25 @@ namespace Mif
 
                         m_root = m_doc.append_child(Detail::Tag::Pack::Value);
 
-                        m_root.append_child(Detail::Tag::Uuid::Value)
+                        m_root.append_child(Detail::Tag::Id::Value)
                                 .append_child(pugi::xml_node_type::node_pcdata)
-                                .set_value(uuid.c_str());
+                                .set_value(std::to_string(requestId).c_str());
 
                         m_root.append_child(Detail::Tag::Type::Value)
                                 .append_child(pugi::xml_node_type::node_pcdata)
-                                .set_value(isReques ? Detail::Tag::Request::Value : Detail::Tag::Response::Value);
+                                .set_value(isRequest ? Detail::Tag::Request::Value : Detail::Tag::Response::Value);
 
                         m_root.append_child(Detail::Tag::Instsnce::Value)
                                 .append_child(pugi::xml_node_type::node_pcdata)
-                                .set_value(instanceId.c_str());
+                                .set_value(std::to_string(instanceId).c_str());
 
                         m_root.append_child(Detail::Tag::Interface::Value)
                                 .append_child(pugi::xml_node_type::node_pcdata)
-                                .set_value(interfaceId.c_str());
+                                .set_value(std::to_string(interfaceId).c_str());
 
                         m_root.append_child(Detail::Tag::Method::Value)
                                 .append_child(pugi::xml_node_type::node_pcdata)
-                                .set_value(methodId.c_str());
+                                .set_value(std::to_string(methodId).c_str());
 
                         PutParamsIfExists(std::forward<TParams>(params) ... );
                     }
@@ -126,14 +126,14 @@ namespace Mif
                      pugi::xml_node m_root;
 
                     template <typename ... TParams>
-                    typename std::enable_if<sizeof ... (TParams), void>::type
+                    typename std::enable_if<sizeof ... (TParams) != 0, void>::type
                     PutParamsIfExists(TParams && ... params)
                     {
                         PutParams(std::forward<TParams> (params) ... );
                     }
 
                     template <typename ... TParams>
-                    typename std::enable_if< !sizeof ... (TParams), void>::type
+                    typename std::enable_if<sizeof ... (TParams) == 0, void>::type
                     PutParamsIfExists(TParams && ...)
                     {
                     }
@@ -162,9 +162,9 @@ namespace Mif
                         }
                     }
 
-                    std::string const GetUuid() const
+                    RequestId GetRequestId() const
                     {
-                        return m_root.child(Detail::Tag::Uuid::Value).child_value();
+                        return m_root.child(Detail::Tag::Id::Value).text().as_ullong();
                     }
 
                     bool IsRequest() const
@@ -177,24 +177,19 @@ namespace Mif
                         return GetType() == Detail::Tag::Response::Value;
                     }
 
-                    std::string const GetType() const
+                    InstanceId GetInstance() const
                     {
-                        return m_root.child(Detail::Tag::Type::Value).child_value();
-                    }
-
-                    std::string const GetInstance() const
-                    {
-                        return m_root.child(Detail::Tag::Instsnce::Value).child_value();
+                        return m_root.child(Detail::Tag::Instsnce::Value).text().as_uint();
                     }
 
-                    std::string const GetInterface() const
+                    InterfaceId GetInterface() const
                     {
-                        return m_root.child(Detail::Tag::Interface::Value).child_value();
+                        return m_root.child(Detail::Tag::Interface::Value).text().as_uint();
                     }
 
-                    std::string const GetMethod() const
+                    MethodId GetMethod() const
                     {
-                        return m_root.child(Detail::Tag::Method::Value).child_value();
+                        return m_root.child(Detail::Tag::Method::Value).text().as_uint();
                     }
 
                     template <typename ... TParams>
@@ -232,8 +227,13 @@ namespace Mif
                     pugi::xml_document m_doc;
                     pugi::xml_node m_root;
 
+                    std::string GetType() const
+                    {
+                        return m_root.child(Detail::Tag::Type::Value).child_value();
+                    }
+
                     template <typename ... TParams>
-                    typename std::enable_if<sizeof ... (TParams), std::tuple<typename std::decay<TParams>::type ... >>::type
+                    typename std::enable_if<sizeof ... (TParams) != 0, std::tuple<typename std::decay<TParams>::type ... >>::type
                     GetParamsIfExists() const
                     {
                         using TResult = std::tuple<typename std::decay<TParams>::type ... >;
@@ -243,7 +243,7 @@ namespace Mif
                     }
 
                     template <typename ... TParams>
-                    typename std::enable_if< !sizeof ... (TParams), std::tuple<>>::type
+                    typename std::enable_if<sizeof ... (TParams) == 0, std::tuple<>>::type
                     GetParamsIfExists() const
                     {
                         return {};
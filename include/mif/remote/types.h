@@ -0,0 +1,30 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_REMOTE_TYPES_H__
+#define __MIF_REMOTE_TYPES_H__
+
+// STD
+#include <cstdint>
+
+namespace Mif
+{
+    namespace Remote
+    {
+
+        // The ids of a call envelope. Interface and method ids are CRC32 of their names,
+        // so both sides get them at compile time. An instance id is a handle given by
+        // the side which holds the object, 0 is a null reference.
+        using RequestId = std::uint64_t;
+        using InstanceId = std::uint32_t;
+        using InterfaceId = std::uint32_t;
+        using MethodId = std::uint32_t;
+
+    }   // namespace Remote
+}   // namespace Mif
+
+#endif  // !__MIF_REMOTE_TYPES_H__
@@ -0,0 +1,1297 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_SERIALIZATION_JSON_STREAM_H__
+#define __MIF_SERIALIZATION_JSON_STREAM_H__
+
+// STD
+#include <array>
+#include <bitset>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+#include <type_traits>
+#include <utility>
+
+// MIF
+#include "mif/common/crc32.h"
+#include "mif/common/types.h"
+#include "mif/common/index_sequence.h"
+#include "mif/common/static_string.h"
+#include "mif/common/unused.h"
+#include "mif/reflection/reflection.h"
+#include "mif/serialization/traits.h"
+
+// The streaming counterpart of Mif::Serialization::Json. It produces and accepts
+// the same documents, but writes the reflected types directly into the buffer and
+// reads them with a pull parser without building an intermediate DOM.
+namespace Mif
+{
+    namespace Serialization
+    {
+        namespace JsonStream
+        {
+            namespace Detail
+            {
+                namespace Tag
+                {
+
+                    using Id = MIF_STATIC_STR("id");
+                    using Value = MIF_STATIC_STR("val");
+
+                }   // namespace Tag
+
+                struct KeyInfo
+                {
+                    char const *data;
+                    std::size_t length;
+                    std::uint32_t crc;
+                };
+
+                // The length and the checksum of a member name are calculated at compile time,
+                // so a parsed key is compared with the memory only when both of them match.
+                template <typename TName>
+                struct Key
+                {
+                    static constexpr std::size_t Length = TName::Size - 1;
+                    static constexpr std::uint32_t Crc = Common::Crc32(TName::Value);
+
+                    static bool Match(KeyInfo const &key)
+                    {
+                        return key.length == Length && key.crc == Crc && !std::memcmp(key.data, TName::Value, Length);
+                    }
+                };
+
+                class Writer final
+                {
+                public:
+                    explicit Writer(Common::Buffer &buffer)
+                        : m_buffer(buffer)
+                    {
+                    }
+
+                    void Put(char ch)
+                    {
+                        m_buffer.push_back(ch);
+                    }
+
+                    void Put(char const *str, std::size_t size)
+                    {
+                        m_buffer.insert(std::end(m_buffer), str, str + size);
+                    }
+
+                    template <typename TName>
+                    void Name()
+                    {
+                        Put('"');
+                        Put(TName::Value, TName::Size - 1);
+                        Put("\":", 2);
+                    }
+
+                    void Null()
+                    {
+                        Put("null", 4);
+                    }
+
+                    void Bool(bool value)
+                    {
+                        if (value)
+                            Put("true", 4);
+                        else
+                            Put("false", 5);
+                    }
+
+                    template <typename T>
+                    void Integer(T value)
+                    {
+                        using UnsignedType = typename std::make_unsigned<T>::type;
+
+                        char buffer[24];
+                        auto *end = buffer + sizeof(buffer);
+                        auto *pos = end;
+
+                        auto const negative = IsNegative(value);
+                        auto number = static_cast<UnsignedType>(value);
+                        if (negative)
+                            number = static_cast<UnsignedType>(UnsignedType{0} - number);
+
+                        do
+                        {
+                            *--pos = static_cast<char>('0' + number % 10);
+                            number = static_cast<UnsignedType>(number / 10);
+                        }
+                        while (number);
+
+                        if (negative)
+                            *--pos = '-';
+
+                        Put(pos, static_cast<std::size_t>(end - pos));
+                    }
+
+                    void Double(double value)
+                    {
+                        if (!std::isfinite(value))
+                        {
+                            Null();
+                            return;
+                        }
+
+                        char buffer[32];
+                        auto const size = std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+                        if (size <= 0 || static_cast<std::size_t>(size) >= sizeof(buffer))
+                            throw std::runtime_error{"[Mif::Serialization::JsonStream::Detail::Writer::Double] Failed to format number."};
+
+                        // The decimal separator depends on the current locale.
+                        for (auto *i = buffer ; i != buffer + size ; ++i)
+                        {
+                            if (*i == ',')
+                                *i = '.';
+                        }
+
+                        Put(buffer, static_cast<std::size_t>(size));
+                    }
+
+                    void String(std::string const &str)
+                    {
+                        static char const hex[] = "0123456789abcdef";
+
+                        Put('"');
+
+                        auto const *begin = str.data();
+                        auto const *end = begin + str.size();
+                        auto const *from = begin;
+
+                        for (auto const *i = begin ; i != end ; ++i)
+                        {
+                            auto const ch = static_cast<unsigned char>(*i);
+                            if (ch >= 0x20 && ch != '"' && ch != '\\')
+                                continue;
+
+                            Put(from, static_cast<std::size_t>(i - from));
+                            from = i + 1;
+
+                            switch (ch)
+                            {
+                            case '"' :
+                                Put("\\\"", 2);
+                                break;
+                            case '\\' :
+                                Put("\\\\", 2);
+                                break;
+                            case '\b' :
+                                Put("\\b", 2);
+                                break;
+                            case '\f' :
+                                Put("\\f", 2);
+                                break;
+                            case '\n' :
+                                Put("\\n", 2);
+                                break;
+                            case '\r' :
+                                Put("\\r", 2);
+                                break;
+                            case '\t' :
+                                Put("\\t", 2);
+                                break;
+                            default :
+                                {
+                                    char const escaped[] = {'\\', 'u', '0', '0', hex[ch >> 4], hex[ch & 0x0F]};
+                                    Put(escaped, sizeof(escaped));
+                                }
+                                break;
+                            }
+                        }
+
+                        Put(from, static_cast<std::size_t>(end - from));
+                        Put('"');
+                    }
+
+                private:
+                    Common::Buffer &m_buffer;
+
+                    template <typename T>
+                    static typename std::enable_if<std::is_signed<T>::value, bool>::type
+                    IsNegative(T value)
+                    {
+                        return value < 0;
+                    }
+
+                    template <typename T>
+                    static typename std::enable_if<!std::is_signed<T>::value, bool>::type
+                    IsNegative(T)
+                    {
+                        return false;
+                    }
+                };
+
+                class Reader final
+                {
+                public:
+                    Reader(char const *begin, char const *end)
+                        : m_begin{begin}
+                        , m_cur{begin}
+                        , m_end{end}
+                    {
+                    }
+
+                    char Peek()
+                    {
+                        while (m_cur != m_end && (*m_cur == ' ' || *m_cur == '\n' || *m_cur == '\r' || *m_cur == '\t'))
+                            ++m_cur;
+                        return m_cur != m_end ? *m_cur : 0;
+                    }
+
+                    bool Consume(char ch)
+                    {
+                        if (Peek() != ch)
+                            return false;
+                        ++m_cur;
+                        return true;
+                    }
+
+                    void Expect(char ch)
+                    {
+                        if (!Consume(ch))
+                            Fail(std::string{"Expected '"} + ch + "'.");
+                    }
+
+                    bool ConsumeNull()
+                    {
+                        if (Peek() != 'n')
+                            return false;
+                        ExpectLiteral("null", 4);
+                        return true;
+                    }
+
+                    bool ReadBool()
+                    {
+                        auto const ch = Peek();
+                        if (ch == 't')
+                        {
+                            ExpectLiteral("true", 4);
+                            return true;
+                        }
+                        if (ch == 'f')
+                        {
+                            ExpectLiteral("false", 5);
+                            return false;
+                        }
+                        Fail("Expected boolean value.");
+                    }
+
+                    template <typename T>
+                    T ReadInteger()
+                    {
+                        auto const *start = Token();
+
+                        auto const negative = *m_cur == '-';
+                        if (negative)
+                            ++m_cur;
+                        if (m_cur == m_end || !IsDigit(*m_cur))
+                            Fail("Expected number.");
+
+                        auto const max = static_cast<std::uint64_t>(std::numeric_limits<T>::max());
+                        auto const limit = negative ? static_cast<std::uint64_t>(0) - static_cast<std::uint64_t>(std::numeric_limits<T>::min()) : max;
+
+                        std::uint64_t number = 0;
+                        for ( ; m_cur != m_end && IsDigit(*m_cur) ; ++m_cur)
+                        {
+                            auto const digit = static_cast<std::uint64_t>(*m_cur - '0');
+                            if (number > limit / 10 || (number == limit / 10 && digit > limit % 10))
+                                Fail("Number is out of range.");
+                            number = number * 10 + digit;
+                        }
+
+                        if (m_cur != m_end && (*m_cur == '.' || *m_cur == 'e' || *m_cur == 'E'))
+                        {
+                            // A number with a fraction or an exponent is accepted when its value is integral.
+                            m_cur = start;
+                            auto const value = ReadDouble();
+                            if (value != std::floor(value) ||
+                                value < static_cast<double>(std::numeric_limits<T>::min()) ||
+                                value > static_cast<double>(std::numeric_limits<T>::max()))
+                            {
+                                Fail("Number is not an integer or is out of range.");
+                            }
+                            return static_cast<T>(value);
+                        }
+
+                        return negative ? static_cast<T>(static_cast<std::int64_t>(0 - number)) : static_cast<T>(number);
+                    }
+
+                    double ReadDouble()
+                    {
+                        auto const *start = Token();
+                        while (m_cur != m_end && (IsDigit(*m_cur) || *m_cur == '-' || *m_cur == '+' ||
+                                *m_cur == '.' || *m_cur == 'e' || *m_cur == 'E'))
+                        {
+                            ++m_cur;
+                        }
+
+                        auto const size = static_cast<std::size_t>(m_cur - start);
+                        char buffer[128];
+                        if (!size || size >= sizeof(buffer))
+                            Fail("Expected number.");
+
+                        std::memcpy(buffer, start, size);
+                        buffer[size] = 0;
+
+                        char *end = nullptr;
+                        auto const value = std::strtod(buffer, &end);
+                        if (end != buffer + size)
+                            Fail("Bad number.");
+
+                        return value;
+                    }
+
+                    void ReadString(std::string &str)
+                    {
+                        Expect('"');
+
+                        str.clear();
+
+                        for (auto const *from = m_cur ; ; )
+                        {
+                            while (m_cur != m_end && *m_cur != '"' && *m_cur != '\\')
+                                ++m_cur;
+                            if (m_cur == m_end)
+                                Fail("Unterminated string.");
+
+                            str.append(from, m_cur);
+                            if (*m_cur++ == '"')
+                                return;
+
+                            ReadEscaped(str);
+                            from = m_cur;
+                        }
+                    }
+
+                    // Skips a value of any type. It is used for the members unknown to the target type.
+                    void Skip()
+                    {
+                        std::size_t depth = 0;
+                        do
+                        {
+                            switch (Peek())
+                            {
+                            case '{' :
+                            case '[' :
+                                ++m_cur;
+                                ++depth;
+                                break;
+                            case '}' :
+                            case ']' :
+                                if (!depth)
+                                    Fail("Unexpected end of container.");
+                                ++m_cur;
+                                --depth;
+                                break;
+                            case ',' :
+                            case ':' :
+                                if (!depth)
+                                    Fail("Unexpected separator.");
+                                ++m_cur;
+                                break;
+                            case '"' :
+                                SkipString();
+                                break;
+                            case 0 :
+                                Fail("Unexpected end of data.");
+                            default :
+                                SkipLiteral();
+                                break;
+                            }
+                        }
+                        while (depth);
+                    }
+
+                    void Finish()
+                    {
+                        if (Peek() || m_cur != m_end)
+                            Fail("Unexpected data after the end of the document.");
+                    }
+
+                    [[noreturn]]
+                    void Fail(std::string const &message) const
+                    {
+                        throw std::invalid_argument{"[Mif::Serialization::JsonStream::Detail::Reader] Failed to parse json. " +
+                            message + " Position: " + std::to_string(m_cur - m_begin)};
+                    }
+
+                private:
+                    char const *m_begin;
+                    char const *m_cur;
+                    char const *m_end;
+
+                    static bool IsDigit(char ch)
+                    {
+                        return ch >= '0' && ch <= '9';
+                    }
+
+                    char const* Token()
+                    {
+                        if (!Peek())
+                            Fail("Unexpected end of data.");
+                        return m_cur;
+                    }
+
+                    void ExpectLiteral(char const *literal, std::size_t size)
+                    {
+                        if (static_cast<std::size_t>(m_end - m_cur) < size || std::memcmp(m_cur, literal, size))
+                            Fail(std::string{"Expected \""} + literal + "\".");
+                        m_cur += size;
+                    }
+
+                    void SkipString()
+                    {
+                        ++m_cur;
+                        for ( ; m_cur != m_end ; ++m_cur)
+                        {
+                            if (*m_cur == '\\')
+                            {
+                                if (++m_cur == m_end)
+                                    break;
+                            }
+                            else if (*m_cur == '"')
+                            {
+                                ++m_cur;
+                                return;
+                            }
+                        }
+                        Fail("Unterminated string.");
+                    }
+
+                    void SkipLiteral()
+                    {
+                        auto const *start = m_cur;
+                        while (m_cur != m_end && *m_cur != ',' && *m_cur != ':' && *m_cur != ']' && *m_cur != '}' &&
+                                *m_cur != ' ' && *m_cur != '\n' && *m_cur != '\r' && *m_cur != '\t')
+                        {
+                            ++m_cur;
+                        }
+                        if (m_cur == start)
+                            Fail("Unexpected character.");
+                    }
+
+                    std::uint32_t ReadHex4()
+                    {
+                        if (m_end - m_cur < 4)
+                            Fail("Bad unicode escape sequence.");
+
+                        std::uint32_t code = 0;
+                        for (auto const *end = m_cur + 4 ; m_cur != end ; ++m_cur)
+                        {
+                            auto const ch = *m_cur;
+                            code <<= 4;
+                            if (ch >= '0' && ch <= '9')
+                                code |= static_cast<std::uint32_t>(ch - '0');
+                            else if (ch >= 'a' && ch <= 'f')
+                                code |= static_cast<std::uint32_t>(ch - 'a' + 10);
+                            else if (ch >= 'A' && ch <= 'F')
+                                code |= static_cast<std::uint32_t>(ch - 'A' + 10);
+                            else
+                                Fail("Bad unicode escape sequence.");
+                        }
+
+                        return code;
+                    }
+
+                    void ReadEscaped(std::string &str)
+                    {
+                        if (m_cur == m_end)
+                            Fail("Unterminated string.");
+
+                        switch (*m_cur++)
+                        {
+                        case '"' :
+                            str.push_back('"');
+                            break;
+                        case '\\' :
+                            str.push_back('\\');
+                            break;
+                        case '/' :
+                            str.push_back('/');
+                            break;
+                        case 'b' :
+                            str.push_back('\b');
+                            break;
+                        case 'f' :
+                            str.push_back('\f');
+                            break;
+                        case 'n' :
+                            str.push_back('\n');
+                            break;
+                        case 'r' :
+                            str.push_back('\r');
+                            break;
+                        case 't' :
+                            str.push_back('\t');
+                            break;
+                        case 'u' :
+                            {
+                                auto code = ReadHex4();
+                                if (code >= 0xD800 && code <= 0xDBFF)
+                                {
+                                    if (m_end - m_cur < 2 || m_cur[0] != '\\' || m_cur[1] != 'u')
+                                        Fail("Bad unicode surrogate pair.");
+                                    m_cur += 2;
+                                    auto const low = ReadHex4();
+                                    if (low < 0xDC00 || low > 0xDFFF)
+                                        Fail("Bad unicode surrogate pair.");
+                                    code = 0x10000 + ((code - 0xD800) << 10) + (low - 0xDC00);
+                                }
+                                AppendUtf8(str, code);
+                            }
+                            break;
+                        default :
+                            --m_cur;
+                            Fail("Bad escape sequence.");
+                        }
+                    }
+
+                    static void AppendUtf8(std::string &str, std::uint32_t code)
+                    {
+                        if (code < 0x80)
+                        {
+                            str.push_back(static_cast<char>(code));
+                        }
+                        else if (code < 0x800)
+                        {
+                            str.push_back(static_cast<char>(0xC0 | (code >> 6)));
+                            str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                        }
+                        else if (code < 0x10000)
+                        {
+                            str.push_back(static_cast<char>(0xE0 | (code >> 12)));
+                            str.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                            str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                        }
+                        else
+                        {
+                            str.push_back(static_cast<char>(0xF0 | (code >> 18)));
+                            str.push_back(static_cast<char>(0x80 | ((code >> 12) & 0x3F)));
+                            str.push_back(static_cast<char>(0x80 | ((code >> 6) & 0x3F)));
+                            str.push_back(static_cast<char>(0x80 | (code & 0x3F)));
+                        }
+                    }
+                };
+
+                template <typename, std::size_t>
+                struct BasesWriter;
+
+                template <std::size_t, std::size_t>
+                struct FieldsWriter;
+
+                template <typename, std::size_t>
+                struct BasesReader;
+
+                template <std::size_t, std::size_t>
+                struct FieldsReader;
+
+                template <typename T>
+                typename std::enable_if<!Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object);
+
+                template <typename T>
+                typename std::enable_if<Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsSimple<T>()>::type
+                Write(Writer &writer, T const &object);
+
+                template <typename T>
+                typename std::enable_if<Reflection::IsReflectable<T>() && !std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsSmartPointer<T>()>::type
+                Write(Writer &writer, T const &ptr);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsIterable<T>()>::type
+                Write(Writer &writer, T const &array);
+
+                template <typename ... T>
+                void Write(Writer &writer, std::tuple<T ... > const &tuple);
+
+                template <typename TFirst, typename TSecond>
+                void Write(Writer &writer, std::pair<TFirst, TSecond> const &pair);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsSimple<T>()>::type
+                Read(Reader &reader, T &object);
+
+                template <typename T>
+                typename std::enable_if<!Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object);
+
+                template <typename T>
+                typename std::enable_if<Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object);
+
+                template <typename T>
+                typename std::enable_if<Reflection::IsReflectable<T>() && !std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsSmartPointer<T>()>::type
+                Read(Reader &reader, T &object);
+
+                template <typename TFirst, typename TSecond>
+                void Read(Reader &reader, std::pair<TFirst, TSecond> &pair);
+
+                template <typename ... T>
+                void Read(Reader &reader, std::tuple<T ... > &tuple);
+
+                template <typename T, std::size_t N>
+                void Read(Reader &reader, std::array<T, N> &array);
+
+                template <typename T>
+                typename std::enable_if<Traits::IsIterable<T>()>::type
+                Read(Reader &reader, T &object);
+
+                template <typename T>
+                inline typename std::enable_if<std::is_pointer<T>::value>::type
+                Write(Writer &, T const &)
+                {
+                    static_assert(!std::is_pointer<T>::value, "[Mif::Serialization::JsonStream::Detail] You can't serialize the raw pointers.");
+                }
+
+                inline void WriteSimple(Writer &writer, bool value)
+                {
+                    writer.Bool(value);
+                }
+
+                inline void WriteSimple(Writer &writer, std::string const &value)
+                {
+                    writer.String(value);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_floating_point<T>::value>::type
+                WriteSimple(Writer &writer, T value)
+                {
+                    writer.Double(static_cast<double>(value));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+                WriteSimple(Writer &writer, T value)
+                {
+                    writer.Integer(value);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<!Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object)
+                {
+                    Write(writer, static_cast<typename std::underlying_type<T>::type>(object));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object)
+                {
+                    writer.String(Reflection::ToString(object));
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsSimple<T>()>::type
+                Write(Writer &writer, T const &object)
+                {
+                    WriteSimple(writer, object);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Reflection::IsReflectable<T>() && !std::is_enum<T>::value>::type
+                Write(Writer &writer, T const &object)
+                {
+                    using BasesType = typename Reflection::Reflect<T>::Base;
+                    static constexpr auto BasesCount = std::tuple_size<BasesType>::value;
+
+                    writer.Put('{');
+                    BasesWriter<BasesType, BasesCount>::Write(writer, object);
+                    FieldsWriter<BasesCount, Reflection::Reflect<T>::Fields::Count>::Write(writer, object);
+                    writer.Put('}');
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsSmartPointer<T>()>::type
+                Write(Writer &writer, T const &ptr)
+                {
+                    if (!ptr)
+                        writer.Null();
+                    else
+                        Write(writer, *ptr);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsIterable<T>()>::type
+                Write(Writer &writer, T const &array)
+                {
+                    writer.Put('[');
+
+                    auto first = true;
+                    for (auto const &i : array)
+                    {
+                        if (!first)
+                            writer.Put(',');
+                        first = false;
+                        Write(writer, i);
+                    }
+
+                    writer.Put(']');
+                }
+
+                template <typename T, std::size_t I>
+                inline void WriteTupleItem(Writer &writer, T const &tuple)
+                {
+                    if (I)
+                        writer.Put(',');
+                    Write(writer, std::get<I>(tuple));
+                }
+
+                template <typename T, std::size_t ... Indexes>
+                inline void WriteTuple(Writer &writer, T const &tuple, Common::IndexSequence<Indexes ... > const *)
+                {
+                    // The braced list keeps the items in order.
+                    int const items[] = {0, (WriteTupleItem<T, Indexes>(writer, tuple), 0) ... };
+                    Common::Unused(items);
+                }
+
+                template <typename ... T>
+                inline void Write(Writer &writer, std::tuple<T ... > const &tuple)
+                {
+                    writer.Put('[');
+                    WriteTuple(writer, tuple, static_cast<Common::MakeIndexSequence<sizeof ... (T)> const *>(nullptr));
+                    writer.Put(']');
+                }
+
+                template <typename TFirst, typename TSecond>
+                inline void Write(Writer &writer, std::pair<TFirst, TSecond> const &pair)
+                {
+                    writer.Put('{');
+                    writer.Name<Tag::Id>();
+                    Write(writer, pair.first);
+                    writer.Put(',');
+                    writer.Name<Tag::Value>();
+                    Write(writer, pair.second);
+                    writer.Put('}');
+                }
+
+                template <typename TBases, std::size_t I>
+                struct BasesWriter
+                {
+                    template <typename T>
+                    static void Write(Writer &writer, T const &object)
+                    {
+                        BasesWriter<TBases, I - 1>::Write(writer, object);
+                        using BaseType = typename std::tuple_element<I - 1, TBases>::type;
+                        if (I > 1)
+                            writer.Put(',');
+                        writer.Name<typename Reflection::Reflect<BaseType>::Name>();
+                        Detail::Write(writer, static_cast<BaseType const &>(object));
+                    }
+                };
+
+                template <typename TBases>
+                struct BasesWriter<TBases, 0>
+                {
+                    template <typename T>
+                    static void Write(Writer &, T const &)
+                    {
+                    }
+                };
+
+                template <std::size_t Offset, std::size_t I>
+                struct FieldsWriter
+                {
+                    template <typename T>
+                    static void Write(Writer &writer, T const &object)
+                    {
+                        FieldsWriter<Offset, I - 1>::Write(writer, object);
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        if (Offset + I > 1)
+                            writer.Put(',');
+                        writer.Name<typename FieldType::Name>();
+                        Detail::Write(writer, object.*FieldType::Access());
+                    }
+                };
+
+                template <std::size_t Offset>
+                struct FieldsWriter<Offset, 0>
+                {
+                    template <typename T>
+                    static void Write(Writer &, T const &)
+                    {
+                    }
+                };
+
+                // A member absent in the document is an error unless the member is
+                // a smart pointer. It matches the handling of null in Mif::Serialization::Json.
+                template <typename T>
+                inline typename std::enable_if<Traits::IsSmartPointer<T>()>::type
+                CheckMissing(Reader const &, char const *)
+                {
+                }
+
+                template <typename T>
+                inline typename std::enable_if<!Traits::IsSmartPointer<T>()>::type
+                CheckMissing(Reader const &reader, char const *name)
+                {
+                    reader.Fail(std::string{"Member \""} + name + "\" not found.");
+                }
+
+                inline void ReadNotNull(Reader &reader)
+                {
+                    if (reader.ConsumeNull())
+                        reader.Fail("Failed to get value from null.");
+                }
+
+                inline void ReadSimple(Reader &reader, bool &value)
+                {
+                    value = reader.ReadBool();
+                }
+
+                inline void ReadSimple(Reader &reader, std::string &value)
+                {
+                    reader.ReadString(value);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_floating_point<T>::value>::type
+                ReadSimple(Reader &reader, T &value)
+                {
+                    value = static_cast<T>(reader.ReadDouble());
+                }
+
+                template <typename T>
+                inline typename std::enable_if<std::is_integral<T>::value && !std::is_same<T, bool>::value>::type
+                ReadSimple(Reader &reader, T &value)
+                {
+                    value = reader.ReadInteger<T>();
+                }
+
+                inline KeyInfo ReadKey(Reader &reader, std::string &key)
+                {
+                    reader.ReadString(key);
+                    reader.Expect(':');
+                    return {key.data(), key.length(), Common::Crc32(key.data(), static_cast<std::uint32_t>(key.length()))};
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsSimple<T>()>::type
+                Read(Reader &reader, T &object)
+                {
+                    ReadNotNull(reader);
+                    ReadSimple(reader, object);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<!Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object)
+                {
+                    typename std::underlying_type<T>::type value{};
+                    Read(reader, value);
+                    object = static_cast<T>(value);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Reflection::IsReflectable<T>() && std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object)
+                {
+                    std::string value;
+                    Read(reader, value);
+                    object = Reflection::FromString<T>(value);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Reflection::IsReflectable<T>() && !std::is_enum<T>::value>::type
+                Read(Reader &reader, T &object)
+                {
+                    using BasesType = typename Reflection::Reflect<T>::Base;
+                    static constexpr auto BasesCount = std::tuple_size<BasesType>::value;
+                    static constexpr auto FieldsCount = Reflection::Reflect<T>::Fields::Count;
+
+                    using Found = std::bitset<BasesCount + FieldsCount>;
+                    using Bases = BasesReader<BasesType, BasesCount>;
+                    using Fields = FieldsReader<BasesCount, FieldsCount>;
+
+                    ReadNotNull(reader);
+                    reader.Expect('{');
+
+                    Found found;
+
+                    if (!reader.Consume('}'))
+                    {
+                        std::string key;
+                        do
+                        {
+                            auto const info = ReadKey(reader, key);
+                            if (!Fields::Read(reader, info, object, found) && !Bases::Read(reader, info, object, found))
+                                reader.Skip();
+                        }
+                        while (reader.Consume(','));
+
+                        reader.Expect('}');
+                    }
+
+                    if (!found.all())
+                    {
+                        Bases::template Check<T>(reader, found);
+                        Fields::template Check<T>(reader, found);
+                    }
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsSmartPointer<T>()>::type
+                Read(Reader &reader, T &object)
+                {
+                    if (reader.ConsumeNull())
+                        return;
+
+                    using ObjectType = typename T::element_type;
+                    object.reset(new ObjectType{});
+                    Read(reader, *object);
+                }
+
+                template <typename TFirst, typename TSecond>
+                inline void Read(Reader &reader, std::pair<TFirst, TSecond> &pair)
+                {
+                    ReadNotNull(reader);
+                    reader.Expect('{');
+
+                    auto hasId = false;
+                    auto hasValue = false;
+
+                    if (!reader.Consume('}'))
+                    {
+                        std::string key;
+                        do
+                        {
+                            auto const info = ReadKey(reader, key);
+                            if (Key<Tag::Id>::Match(info))
+                            {
+                                Read(reader, const_cast<typename std::remove_const<TFirst>::type &>(pair.first));
+                                hasId = true;
+                            }
+                            else if (Key<Tag::Value>::Match(info))
+                            {
+                                Read(reader, pair.second);
+                                hasValue = true;
+                            }
+                            else
+                            {
+                                reader.Skip();
+                            }
+                        }
+                        while (reader.Consume(','));
+
+                        reader.Expect('}');
+                    }
+
+                    if (!hasId || !hasValue)
+                        reader.Fail("Failed to parse pair. Json has no pair type object.");
+                }
+
+                // Reads the next array item. Returns false when the array is over.
+                inline bool NextItem(Reader &reader, bool first)
+                {
+                    if (first)
+                        return reader.Peek() != ']';
+                    if (reader.Consume(','))
+                        return true;
+                    if (reader.Peek() != ']')
+                        reader.Fail("Expected ',' or ']'.");
+                    return false;
+                }
+
+                inline void SkipItems(Reader &reader, bool first)
+                {
+                    while (NextItem(reader, first))
+                    {
+                        reader.Skip();
+                        first = false;
+                    }
+                    reader.Expect(']');
+                }
+
+                template <typename T, std::size_t I>
+                inline void ReadTupleItem(Reader &reader, T &tuple)
+                {
+                    if (!NextItem(reader, !I))
+                        reader.Fail("Failed to parse tuple. Not enough items.");
+                    Read(reader, std::get<I>(tuple));
+                }
+
+                template <typename T, std::size_t ... Indexes>
+                inline void ReadTuple(Reader &reader, T &tuple, Common::IndexSequence<Indexes ... > const *)
+                {
+                    int const items[] = {0, (ReadTupleItem<T, Indexes>(reader, tuple), 0) ... };
+                    Common::Unused(items);
+                }
+
+                template <typename ... T>
+                inline void Read(Reader &reader, std::tuple<T ... > &tuple)
+                {
+                    ReadNotNull(reader);
+                    reader.Expect('[');
+                    ReadTuple(reader, tuple, static_cast<Common::MakeIndexSequence<sizeof ... (T)> const *>(nullptr));
+                    SkipItems(reader, !sizeof ... (T));
+                }
+
+                template <typename T, std::size_t N>
+                inline void Read(Reader &reader, std::array<T, N> &array)
+                {
+                    ReadNotNull(reader);
+                    reader.Expect('[');
+
+                    std::array<T, N> tmp;
+                    for (std::size_t i = 0 ; i < N ; ++i)
+                    {
+                        if (!NextItem(reader, !i))
+                            reader.Fail("Failed to parse array. Not enough items.");
+                        Read(reader, tmp[i]);
+                    }
+
+                    SkipItems(reader, !N);
+                    std::swap(array, tmp);
+                }
+
+                template <typename T>
+                inline typename std::enable_if<Traits::IsIterable<T>()>::type
+                Read(Reader &reader, T &object)
+                {
+                    ReadNotNull(reader);
+                    reader.Expect('[');
+
+                    T{}.swap(object);
+
+                    using ObjectType = typename T::value_type;
+
+                    for (auto first = true ; NextItem(reader, first) ; first = false)
+                    {
+                        ObjectType item;
+                        Read(reader, item);
+                        *std::inserter(object, std::end(object)) = std::move(item);
+                    }
+
+                    reader.Expect(']');
+                }
+
+                template <typename TBases, std::size_t I>
+                struct BasesReader
+                {
+                    template <typename T, typename TFound>
+                    static bool Read(Reader &reader, KeyInfo const &key, T &object, TFound &found)
+                    {
+                        using BaseType = typename std::tuple_element<I - 1, TBases>::type;
+                        if (!Key<typename Reflection::Reflect<BaseType>::Name>::Match(key))
+                            return BasesReader<TBases, I - 1>::Read(reader, key, object, found);
+                        Detail::Read(reader, static_cast<BaseType &>(object));
+                        found.set(I - 1);
+                        return true;
+                    }
+
+                    template <typename T, typename TFound>
+                    static void Check(Reader const &reader, TFound const &found)
+                    {
+                        BasesReader<TBases, I - 1>::template Check<T>(reader, found);
+                        using BaseType = typename std::tuple_element<I - 1, TBases>::type;
+                        if (!found.test(I - 1))
+                            CheckMissing<BaseType>(reader, Reflection::Reflect<BaseType>::Name::Value);
+                    }
+                };
+
+                template <typename TBases>
+                struct BasesReader<TBases, 0>
+                {
+                    template <typename T, typename TFound>
+                    static bool Read(Reader &, KeyInfo const &, T &, TFound &)
+                    {
+                        return false;
+                    }
+
+                    template <typename T, typename TFound>
+                    static void Check(Reader const &, TFound const &)
+                    {
+                    }
+                };
+
+                template <std::size_t Offset, std::size_t I>
+                struct FieldsReader
+                {
+                    template <typename T, typename TFound>
+                    static bool Read(Reader &reader, KeyInfo const &key, T &object, TFound &found)
+                    {
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        if (!Key<typename FieldType::Name>::Match(key))
+                            return FieldsReader<Offset, I - 1>::Read(reader, key, object, found);
+                        Detail::Read(reader, object.*FieldType::Access());
+                        found.set(Offset + I - 1);
+                        return true;
+                    }
+
+                    template <typename T, typename TFound>
+                    static void Check(Reader const &reader, TFound const &found)
+                    {
+                        FieldsReader<Offset, I - 1>::template Check<T>(reader, found);
+                        using FieldType = typename Reflection::Reflect<T>::Fields::template Field<I - 1>;
+                        if (!found.test(Offset + I - 1))
+                            CheckMissing<typename FieldType::Type>(reader, FieldType::Name::Value);
+                    }
+                };
+
+                template <std::size_t Offset>
+                struct FieldsReader<Offset, 0>
+                {
+                    template <typename T, typename TFound>
+                    static bool Read(Reader &, KeyInfo const &, T &, TFound &)
+                    {
+                        return false;
+                    }
+
+                    template <typename T, typename TFound>
+                    static void Check(Reader const &, TFound const &)
+                    {
+                    }
+                };
+
+                template <typename T>
+                inline void ReadRoot(Reader &reader, T &object, std::string const &rootName)
+                {
+                    if (rootName.empty())
+                    {
+                        Read(reader, object);
+                        return;
+                    }
+
+                    reader.Expect('{');
+
+                    auto found = false;
+
+                    if (!reader.Consume('}'))
+                    {
+                        std::string key;
+                        do
+                        {
+                            ReadKey(reader, key);
+                            if (key == rootName)
+                            {
+                                Read(reader, object);
+                                found = true;
+                            }
+                            else
+                            {
+                                reader.Skip();
+                            }
+                        }
+                        while (reader.Consume(','));
+
+                        reader.Expect('}');
+                    }
+
+                    if (!found)
+                        CheckMissing<T>(reader, rootName.c_str());
+                }
+
+            }   // namespace Detail
+
+            template <typename T>
+            inline typename std::enable_if<Reflection::IsReflectable<T>(), void>::type
+            Serialize(T const &object, Common::Buffer &buffer)
+            {
+                Detail::Writer writer{buffer};
+                Detail::Write(writer, object);
+            }
+
+            template <typename T>
+            inline typename std::enable_if<Reflection::IsReflectable<T>(), Common::Buffer>::type
+            Serialize(T const &object)
+            {
+                Common::Buffer buffer;
+                Serialize(object, buffer);
+                return buffer;
+            }
+
+            template <typename T>
+            inline typename std::enable_if<!Reflection::IsReflectable<T>(), void>::type
+            Serialize(T const &object, Common::Buffer &buffer, std::string const &rootName = {})
+            {
+                Detail::Writer writer{buffer};
+
+                if (!rootName.empty())
+                {
+                    writer.Put('{');
+                    writer.String(rootName);
+                    writer.Put(':');
+                }
+
+                Detail::Write(writer, object);
+
+                if (!rootName.empty())
+                    writer.Put('}');
+            }
+
+            template <typename T>
+            inline typename std::enable_if<!Reflection::IsReflectable<T>(), Common::Buffer>::type
+            Serialize(T const &object, std::string const &rootName = {})
+            {
+                Common::Buffer buffer;
+                Serialize(object, buffer, rootName);
+                return buffer;
+            }
+
+            template <typename T>
+            inline typename std::enable_if<Reflection::IsReflectable<T>(), T>::type
+            Deserialize(char const *data, std::size_t size)
+            {
+                Detail::Reader reader{data, data + size};
+                T object;
+                Detail::Read(reader, object);
+                reader.Finish();
+                return object;
+            }
+
+            template <typename T>
+            inline typename std::enable_if<Reflection::IsReflectable<T>(), T>::type
+            Deserialize(Common::Buffer const &buffer)
+            {
+                return Deserialize<T>(buffer.data(), buffer.size());
+            }
+
+            template <typename T>
+            inline typename std::enable_if<!Reflection::IsReflectable<T>(), T>::type
+            Deserialize(char const *data, std::size_t size, std::string const &rootName = {})
+            {
+                Detail::Reader reader{data, data + size};
+                T object{};
+                Detail::ReadRoot(reader, object, rootName);
+                reader.Finish();
+                return object;
+            }
+
+            template <typename T>
+            inline typename std::enable_if<!Reflection::IsReflectable<T>(), T>::type
+            Deserialize(Common::Buffer const &buffer, std::string const &rootName = {})
+            {
+                return Deserialize<T>(buffer.data(), buffer.size(), rootName);
+            }
+
+        }   // namespace JsonStream
+    }   // namespace Serialization
+}   // namespace Mif
+
+#endif  // !__MIF_SERIALIZATION_JSON_STREAM_H__
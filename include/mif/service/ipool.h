@@ -8,6 +8,10 @@
 #ifndef __MIF_SERVICE_IPOOL_H__
 #define __MIF_SERVICE_IPOOL_H__
 
+// STD
+#include <chrono>
+#include <cstdint>
+
 // MIF
 #include "mif/service/iservice.h"
 #include "mif/service/make.h"
@@ -31,6 +35,46 @@ namespace Mif
 
         using IPoolPtr = Service::TServicePtr<IPool>;
 
+        struct PoolParams
+        {
+            // The maximum number of the objects.
+            std::uint32_t limit = 10;
+            // The number of the objects which are not released on idle timeout.
+            std::uint32_t minSize = 0;
+            // How long GetService waits for a free object when the limit is reached (0 - fail at once).
+            std::chrono::milliseconds waitTimeout{0};
+            // An object which was idle longer is checked by ICheckable before it is given out (0 - never).
+            std::chrono::milliseconds validateAfter{30000};
+            // The period of the background work: the idle objects are checked and the expired ones
+            // are released (0 - there is no background work).
+            std::chrono::milliseconds checkInterval{0};
+            // An object above minSize which was idle longer is released in the background (0 - never).
+            std::chrono::milliseconds idleTimeout{0};
+        };
+
+        struct PoolCounters
+        {
+            std::uint64_t checkouts;
+            // The checkouts which waited for a free object and the total and maximum time of waiting.
+            std::uint64_t waits;
+            std::chrono::microseconds waitTime;
+            std::chrono::microseconds maxWaitTime;
+            std::uint64_t timeouts;
+            std::uint64_t created;
+            // The objects released because they failed the check or were idle too long.
+            std::uint64_t evictions;
+            std::uint32_t size;
+            std::uint32_t idle;
+        };
+
+        struct IPoolMetrics
+            : public Inherit<IService>
+        {
+            virtual PoolCounters GetCounters() const = 0;
+        };
+
+        using IPoolMetricsPtr = Service::TServicePtr<IPoolMetrics>;
+
     }   // namespace Service
 }   // namespace Mif
 
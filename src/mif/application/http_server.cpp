@@ -8,6 +8,7 @@
 // MIF
 #include "mif/application/http_server.h"
 #include "mif/common/log.h"
+#include "mif/common/static_string.h"
 #include "mif/common/unused.h"
 
 namespace Mif
@@ -15,10 +16,28 @@ namespace Mif
     namespace Application
     {
 
+        namespace
+        {
+            namespace Detail
+            {
+                namespace Config
+                {
+
+                    using ServerHandlerWorkers = MIF_STATIC_STR("handlerworkers");
+
+                }   // namespace Config
+            }   // namespace Detail
+        }   // namespace
+
         HttpServer::HttpServer(int argc, char const **argv, Net::Http::Methods const &methods)
             : NetBaseApplication{argc, argv}
             , m_methods{methods}
         {
+            boost::program_options::options_description options{"HTTP server options"};
+            options.add_options()
+                    (Detail::Config::ServerHandlerWorkers::Value, boost::program_options::value<std::uint16_t>(&m_handlerWorkers)->default_value(0), "Handler thread count (0 - handlers run in the I/O threads)");
+
+            AddCustomOptions(options);
         }
 
         void HttpServer::Init(Net::Http::ServerHandlers &handlers)
@@ -26,6 +45,11 @@ namespace Mif
             Common::Unused(handlers);
         }
 
+        void HttpServer::InitAsync(Net::Http::ServerAsyncHandlers &handlers)
+        {
+            Common::Unused(handlers);
+        }
+
         void HttpServer::Done()
         {
         }
@@ -39,11 +63,23 @@ namespace Mif
 
             MIF_LOG(Info) << "Starting server on " << host << ":" << port;
 
+            if (auto serverConfig = GetServerConfig())
+            {
+                if (serverConfig->Exists(Detail::Config::ServerHandlerWorkers::Value))
+                    m_handlerWorkers = serverConfig->GetValue<std::uint16_t>(Detail::Config::ServerHandlerWorkers::Value);
+            }
+
             Net::Http::ServerHandlers handlers;
+            Net::Http::ServerAsyncHandlers asyncHandlers;
 
             Init(handlers);
+            InitAsync(asyncHandlers);
+
+            if (m_handlerWorkers)
+                m_handlersPool = Common::CreateThreadPool(m_handlerWorkers);
 
-            m_server.reset(new Net::Http::Server{host, port, workers, m_methods, handlers});
+            m_server.reset(new Net::Http::Server{host, port, workers, m_methods, handlers,
+                    asyncHandlers, m_handlersPool});
 
             MIF_LOG(Info) << "Server is successfully started.";
         }
@@ -53,6 +89,7 @@ namespace Mif
             MIF_LOG(Info) << "Stopping server ...";
 
             m_server.reset();
+            m_handlersPool.reset();
 
             try
             {
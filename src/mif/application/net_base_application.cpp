@@ -73,6 +73,14 @@ namespace Mif
             return std::chrono::microseconds{m_timeout};
         }
 
+        IConfigPtr NetBaseApplication::GetServerConfig() const
+        {
+            auto config = GetConfig();
+            if (!config || !config->Exists(Detail::Config::ServerBranch::Value))
+                return {};
+            return config->GetConfig(Detail::Config::ServerBranch::Value);
+        }
+
         void NetBaseApplication::OnStart()
         {
             if (auto config = GetConfig())
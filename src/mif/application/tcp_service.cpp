@@ -8,6 +8,7 @@
 // MIF
 #include "mif/application/tcp_service.h"
 #include "mif/common/log.h"
+#include "mif/common/static_string.h"
 #include "mif/common/unused.h"
 #include "mif/service/make.h"
 
@@ -16,10 +17,30 @@ namespace Mif
     namespace Application
     {
 
+        namespace
+        {
+            namespace Detail
+            {
+                namespace Config
+                {
+
+                    using ServerIoWorkers = MIF_STATIC_STR("ioworkers");
+                    using ServerReusePort = MIF_STATIC_STR("reuseport");
+
+                }   // namespace Config
+            }   // namespace Detail
+        }   // namespace
+
         TcpService::TcpService(int argc, char const **argv, ClientFactory const &clientFactory)
             : NetBaseApplication{argc, argv}
             , m_clientFactory{clientFactory}
         {
+            boost::program_options::options_description options{"TCP server options"};
+            options.add_options()
+                    (Detail::Config::ServerIoWorkers::Value, boost::program_options::value<std::uint16_t>(&m_ioWorkers)->default_value(1), "I/O thread count")
+                    (Detail::Config::ServerReusePort::Value, boost::program_options::value<bool>(&m_reusePort)->default_value(false), "Listener per I/O thread with SO_REUSEPORT");
+
+            AddCustomOptions(options);
         }
 
         void TcpService::Init(Service::FactoryPtr factory)
@@ -38,6 +59,14 @@ namespace Mif
             auto const workers = GetWorkers();
             auto const timeout = GetTimeout();
 
+            if (auto serverConfig = GetServerConfig())
+            {
+                if (serverConfig->Exists(Detail::Config::ServerIoWorkers::Value))
+                    m_ioWorkers = serverConfig->GetValue<std::uint16_t>(Detail::Config::ServerIoWorkers::Value);
+                if (serverConfig->Exists(Detail::Config::ServerReusePort::Value))
+                    m_reusePort = serverConfig->GetValue<bool>(Detail::Config::ServerReusePort::Value);
+            }
+
             MIF_LOG(Info) << "Starting server on " << host << ":" << port;
 
             auto factory = Service::Make<Service::Factory, Service::Factory>();
@@ -46,7 +75,8 @@ namespace Mif
 
             auto clientFactory = m_clientFactory(workers, timeout, factory);
 
-            m_server.reset(new Net::Tcp::Server{host, port, clientFactory});
+            m_server.reset(new Net::Tcp::Server{host, port, clientFactory, m_ioWorkers,
+                    Net::Tcp::Server::Balancing::LeastLoad, m_reusePort});
 
             MIF_LOG(Info) << "Server is successfully started.";
         }
@@ -0,0 +1,31 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <random>
+
+// MIF
+#include "mif/common/id_generator.h"
+
+namespace Mif
+{
+    namespace Common
+    {
+
+        IdGenerator::IdGenerator()
+        {
+            std::random_device device;
+            m_next = (static_cast<std::uint64_t>(device()) << 32) | device();
+        }
+
+        std::uint64_t IdGenerator::Generate()
+        {
+            return m_next++;
+        }
+
+    }   // namespace Common
+}   // namespace Mif
@@ -6,13 +6,21 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
 #include <cstdint>
+#include <cstdlib>
 #include <iostream>
 #include <memory>
 #include <mutex>
 #include <ostream>
 #include <stdexcept>
+#include <streambuf>
 #include <string>
+#include <thread>
+#include <vector>
 
 // BOOST
 #include <boost/log/attributes.hpp>
@@ -23,6 +31,8 @@
 #include <boost/log/trivial.hpp>
 #include <boost/log/utility/setup/console.hpp>
 #include <boost/log/utility/setup/file.hpp>
+#include <boost/date_time/c_local_time_adjustor.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
 
 // MIF
 #include "mif/common/log.h"
@@ -72,16 +82,205 @@ namespace Mif
 
                 BOOST_LOG_ATTRIBUTE_KEYWORD(CustomSeverity, "Severity", MifCommonLogLevel)
 
-                class Logger final
+                struct Record
+                {
+                    Log::Level level;
+                    std::chrono::system_clock::time_point time;
+                    std::string message;
+                };
+
+                // Bounded multi-producer queue. Every cell has a sequence number which tells
+                // the producers and the consumer whose turn it is, so no lock is taken.
+                class RecordQueue final
                 {
                 public:
-                    using Level = Log::Level;
+                    explicit RecordQueue(std::size_t capacity)
+                        : m_cells{new Cell[capacity]}
+                        , m_mask{capacity - 1}
+                    {
+                        if (!capacity || (capacity & m_mask))
+                            throw std::invalid_argument{"[Mif::Common::Detail::RecordQueue] Capacity must be a power of 2."};
+
+                        for (std::size_t i = 0 ; i < capacity ; ++i)
+                            m_cells[i].sequence.store(i, std::memory_order_relaxed);
+                    }
+
+                    RecordQueue(RecordQueue const &) = delete;
+                    RecordQueue& operator = (RecordQueue const &) = delete;
+                    RecordQueue(RecordQueue &&) = delete;
+                    RecordQueue& operator = (RecordQueue &&) = delete;
 
-                    
+                    bool TryPush(Record &record)
+                    {
+                        auto pos = m_enqueuePos.load(std::memory_order_relaxed);
+                        for (;;)
+                        {
+                            auto &cell = m_cells[pos & m_mask];
+                            auto const sequence = cell.sequence.load(std::memory_order_acquire);
+                            auto const diff = static_cast<std::intptr_t>(sequence) - static_cast<std::intptr_t>(pos);
+                            if (!diff)
+                            {
+                                if (m_enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                                {
+                                    cell.record = std::move(record);
+                                    cell.sequence.store(pos + 1, std::memory_order_release);
+                                    return true;
+                                }
+                            }
+                            else if (diff < 0)
+                            {
+                                return false;
+                            }
+                            else
+                            {
+                                pos = m_enqueuePos.load(std::memory_order_relaxed);
+                            }
+                        }
+                    }
+
+                    // The queue has the only consumer, so the position is not contended.
+                    bool TryPop(Record &record)
+                    {
+                        auto const pos = m_dequeuePos.load(std::memory_order_relaxed);
+                        auto &cell = m_cells[pos & m_mask];
+                        if (cell.sequence.load(std::memory_order_acquire) != pos + 1)
+                            return false;
+                        record = std::move(cell.record);
+                        cell.record.message.clear();
+                        m_dequeuePos.store(pos + 1, std::memory_order_relaxed);
+                        cell.sequence.store(pos + m_mask + 1, std::memory_order_release);
+                        return true;
+                    }
+
+                    bool IsEmpty() const
+                    {
+                        auto const pos = m_dequeuePos.load(std::memory_order_relaxed);
+                        return m_cells[pos & m_mask].sequence.load(std::memory_order_acquire) != pos + 1;
+                    }
 
+                private:
+                    struct Cell
+                    {
+                        std::atomic<std::size_t> sequence;
+                        Record record;
+                    };
+
+                    std::unique_ptr<Cell[]> m_cells;
+                    std::size_t const m_mask;
+
+                    // The positions are kept on different cache lines, so the producers and the consumer
+                    // do not slow down each other (alignas is not honored by new in C++11).
+                    char m_padding1[64];
+                    std::atomic<std::size_t> m_enqueuePos{0};
+                    char m_padding2[64];
+                    std::atomic<std::size_t> m_dequeuePos{0};
+                    char m_padding3[64];
+                };
+
+                class LogStreamBuffer final
+                    : public std::streambuf
+                {
+                public:
+                    std::string& GetData()
+                    {
+                        return m_data;
+                    }
+
+                private:
+                    std::string m_data;
+
+                    virtual int_type overflow(int_type ch) override final
+                    {
+                        if (!traits_type::eq_int_type(ch, traits_type::eof()))
+                            m_data.push_back(traits_type::to_char_type(ch));
+                        return traits_type::not_eof(ch);
+                    }
+
+                    virtual std::streamsize xsputn(char const *str, std::streamsize count) override final
+                    {
+                        m_data.append(str, static_cast<std::size_t>(count));
+                        return count;
+                    }
+                };
+
+                class LogStream final
+                    : public std::ostream
+                {
+                public:
+                    LogStream()
+                        : std::ostream{nullptr}
+                    {
+                        rdbuf(&m_buffer);
+                        m_flags = flags();
+                    }
+
+                    std::string TakeMessage()
+                    {
+                        auto &data = m_buffer.GetData();
+                        std::string message{data};
+
+                        // The buffer keeps its memory for the next record, unless the record was too large.
+                        data.clear();
+                        if (data.capacity() > MaxKeptCapacity)
+                            std::string{}.swap(data);
+
+                        clear();
+                        flags(m_flags);
+                        precision(6);
+                        width(0);
+                        fill(' ');
+
+                        return message;
+                    }
+
+                private:
+                    static constexpr std::size_t MaxKeptCapacity = 64 * 1024;
+
+                    LogStreamBuffer m_buffer;
+                    std::ios_base::fmtflags m_flags;
+                };
+
+                // Every thread keeps its own formatting buffers. There is a stack of them,
+                // because a record can be logged while the arguments of another one are calculated.
+                class LogStreams final
+                {
+                public:
+                    static LogStream* Acquire()
+                    {
+                        auto &self = Get();
+                        if (self.m_depth == self.m_streams.size())
+                            self.m_streams.emplace_back(new LogStream);
+                        return self.m_streams[self.m_depth++].get();
+                    }
+
+                    static void Release()
+                    {
+                        auto &self = Get();
+                        if (self.m_depth)
+                            --self.m_depth;
+                    }
+
+                private:
+                    std::vector<std::unique_ptr<LogStream>> m_streams;
+                    std::size_t m_depth = 0;
+
+                    static LogStreams& Get()
+                    {
+                        static thread_local LogStreams streams;
+                        return streams;
+                    }
+                };
+
+                class Logger final
+                {
+                public:
+                    using Level = Log::Level;
 
                     static Logger& Get()
                     {
+                        if (auto *instance = m_current.load(std::memory_order_acquire))
+                            return *instance;
+
                         std::lock_guard<std::mutex> lock(m_mutex);
                         auto *instance = m_instance.get();
                         if (!instance)
@@ -107,7 +306,7 @@ namespace Mif
                         if (m_instance)
                             throw std::runtime_error{"[Mif::Common::Detail::Logger::Init] Already initialized."};
 
-                        m_instance.reset(new Logger(level, logDir, filePattern, maxSize, maxCount));
+                        SetInstance(std::unique_ptr<Logger>{new Logger(level, logDir, filePattern, maxSize, maxCount)});
                     }
 
                     Logger(Logger const &) = delete;
@@ -115,24 +314,108 @@ namespace Mif
                     Logger(Logger &&) = delete;
                     Logger& operator = (Logger &&) = delete;
 
-                    void PutMessage(Level const &level, std::string const &message)
+                    ~Logger()
                     {
-                        auto logLevel = static_cast<MifCommonLogLevel>(static_cast<std::uint32_t>(level));
-                        BOOST_LOG_SEV(m_logger, logLevel) << message;
+                        m_current.store(nullptr, std::memory_order_release);
+                        Stop();
+                    }
+
+                    void PutMessage(Level const &level, std::string &&message)
+                    {
+                        if (m_stop)
+                        {
+                            ++m_dropped;
+                            return;
+                        }
+
+                        Record record{level, std::chrono::system_clock::now(), std::move(message)};
+
+                        // The records which can not be lost wait for the free space in the queue.
+                        auto const mustWait = level <= Level::Error || m_overflow.load(std::memory_order_relaxed) == LogOverflow::Block;
+
+                        while (!m_queue.TryPush(record))
+                        {
+                            if (!mustWait)
+                            {
+                                ++m_dropped;
+                                return;
+                            }
+                            WakeUp();
+                            std::this_thread::yield();
+                        }
+
+                        auto const ticket = ++m_pushed;
+
+                        std::atomic_thread_fence(std::memory_order_seq_cst);
+                        if (m_sleeping.load(std::memory_order_relaxed))
+                            WakeUp();
+
+                        if (level == Level::Fatal)
+                            Flush(ticket);
+                    }
+
+                    void SetOverflow(LogOverflow overflow)
+                    {
+                        m_overflow = overflow;
+                    }
+
+                    LogCounters GetCounters() const
+                    {
+                        return {m_written, m_dropped};
+                    }
+
+                    void Flush()
+                    {
+                        Flush(m_pushed);
                     }
 
                 private:
-                    boost::log::sources::severity_logger_mt<MifCommonLogLevel> m_logger;
+                    // The capacity of the queue of the records (must be a power of 2).
+                    static constexpr std::size_t QueueCapacity = 8192;
+
+                    boost::log::sources::severity_logger<MifCommonLogLevel> m_logger;
+
+                    RecordQueue m_queue{QueueCapacity};
+                    std::atomic<LogOverflow> m_overflow{LogOverflow::Drop};
+
+                    std::atomic<std::uint64_t> m_pushed{0};
+                    std::atomic<std::uint64_t> m_written{0};
+                    std::atomic<std::uint64_t> m_dropped{0};
+
+                    std::mutex m_waitLock;
+                    std::condition_variable m_wakeup;
+                    std::atomic<bool> m_sleeping{false};
+                    std::atomic<bool> m_stop{false};
+                    std::thread m_thread;
 
                     static std::mutex m_mutex;
                     static std::unique_ptr<Logger> m_instance;
+                    static std::atomic<Logger *> m_current;
+
+                    static void SetInstance(std::unique_ptr<Logger> instance)
+                    {
+                        m_instance = std::move(instance);
+                        m_current.store(m_instance.get(), std::memory_order_release);
+
+                        // The writer must be stopped before the Boost.Log core is destroyed.
+                        // The core is already created by the sink, so this handler is called earlier.
+                        static bool const registered = std::atexit(&Logger::Shutdown) == 0;
+                        (void)registered;
+                    }
+
+                    static void Shutdown()
+                    {
+                        std::lock_guard<std::mutex> lock(m_mutex);
+                        if (m_instance)
+                            m_instance->Stop();
+                    }
 
                     static void InitConsoleLogInternal(Log::Level const &level)
                     {
                         if (m_instance)
                             throw std::runtime_error{"[Mif::Common::Detail::Logger::Init] Already initialized."};
 
-                        m_instance.reset(new Logger(level));
+                        SetInstance(std::unique_ptr<Logger>{new Logger(level)});
                     }
 
 #define MIF_LOG_RECORD_FORMAT \
@@ -147,6 +430,7 @@ namespace Mif
                         Init(level);
                         boost::log::add_console_log(std::clog,
                             boost::log::keywords::format = MIF_LOG_RECORD_FORMAT);
+                        Start();
                     }
 
                     Logger(Log::Level const &level, std::string const &logDir, std::string const &filePattern,
@@ -165,25 +449,115 @@ namespace Mif
                                 keywords::auto_flush = true,
                                 keywords::format = MIF_LOG_RECORD_FORMAT
                             );
+                        Start();
                     }
 
 #undef MIF_LOG_RECORD_FORMAT
 
                     void Init(Log::Level const &level)
                     {
-                        using namespace boost::log;
-                        auto core = core::get();
-                        core->set_filter(CustomSeverity <= level);
-                        core->add_global_attribute("TimeStamp", attributes::local_clock());
+                        // The records are filtered by Log before they are formatted.
+                        Log::SetLevel(level);
+                    }
+
+                    void Start()
+                    {
+                        m_thread = std::thread{&Logger::Run, this};
+                    }
+
+                    void Stop()
+                    {
+                        m_stop = true;
+                        WakeUp();
+
+                        try
+                        {
+                            if (m_thread.joinable() && std::this_thread::get_id() != m_thread.get_id())
+                                m_thread.join();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            std::clog << "[Mif::Common::Detail::Logger::Stop] Failed to stop log writer. Error: " << e.what() << std::endl;
+                        }
+                    }
+
+                    void WakeUp()
+                    {
+                        std::lock_guard<std::mutex> lock{m_waitLock};
+                        m_wakeup.notify_one();
+                    }
+
+                    void Flush(std::uint64_t ticket)
+                    {
+                        if (std::this_thread::get_id() == m_thread.get_id())
+                            return;
+
+                        auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{1};
+                        while (m_written < ticket && !m_stop && std::chrono::steady_clock::now() < deadline)
+                        {
+                            WakeUp();
+                            std::this_thread::yield();
+                        }
+                    }
+
+                    void Run()
+                    {
+                        Record record;
+
+                        for (;;)
+                        {
+                            while (m_queue.TryPop(record))
+                                Write(record);
+
+                            if (m_stop)
+                                break;
+
+                            std::unique_lock<std::mutex> lock{m_waitLock};
+                            m_sleeping = true;
+                            std::atomic_thread_fence(std::memory_order_seq_cst);
+                            if (m_queue.IsEmpty() && !m_stop)
+                                m_wakeup.wait_for(lock, std::chrono::milliseconds{100});
+                            m_sleeping = false;
+                        }
+
+                        while (m_queue.TryPop(record))
+                            Write(record);
+                    }
+
+                    void Write(Record &record)
+                    {
+                        try
+                        {
+                            auto const time = boost::posix_time::from_time_t(0) + boost::posix_time::microseconds{
+                                    std::chrono::duration_cast<std::chrono::microseconds>(record.time.time_since_epoch()).count()};
+                            auto const localTime = boost::date_time::c_local_adjustor<boost::posix_time::ptime>::utc_to_local(time);
+
+                            auto const attr = m_logger.add_attribute("TimeStamp",
+                                    boost::log::attributes::constant<boost::posix_time::ptime>{localTime});
+
+                            auto logLevel = static_cast<MifCommonLogLevel>(static_cast<std::uint32_t>(record.level));
+                            BOOST_LOG_SEV(m_logger, logLevel) << record.message;
+
+                            m_logger.remove_attribute(attr.first);
+                        }
+                        catch (std::exception const &e)
+                        {
+                            std::clog << "[Mif::Common::Detail::Logger::Write] Failed to write message. Error: " << e.what() << std::endl;
+                        }
+
+                        ++m_written;
                     }
                 };
 
                 std::mutex Logger::m_mutex;
                 std::unique_ptr<Logger> Logger::m_instance;
+                std::atomic<Logger *> Logger::m_current{nullptr};
 
             }   // namespace
         }   // namespace Detail
         
+        std::atomic<Log::Level> Log::m_maxLevel{Log::Level::Trace};
+
         Log Logger(Log::Level const &level)
         {
             return Log{level};
@@ -203,9 +577,9 @@ namespace Mif
             Impl(Impl &&) = delete;
             Impl& operator = (Impl &&) = delete;
 
-            void PutMessage(Log::Level const &level, std::string const &message)
+            void PutMessage(Log::Level const &level, std::string &&message)
             {
-                Detail::Logger::Get().PutMessage(level, message);
+                Detail::Logger::Get().PutMessage(level, std::move(message));
             }
 
         private:
@@ -216,13 +590,28 @@ namespace Mif
             : m_impl(Impl::Get())
             , m_level(level)
         {
+            if (IsEnabled(level))
+                m_stream = Detail::LogStreams::Acquire();
+        }
+
+        Log::Log(Log &&other) noexcept
+            : m_impl(other.m_impl)
+            , m_level(other.m_level)
+            , m_stream(other.m_stream)
+        {
+            other.m_stream = nullptr;
         }
 
         Log::~Log() noexcept
         {
+            if (!m_stream)
+                return;
+
             try
             {
-                m_impl.PutMessage(m_level, m_stream.str());
+                auto message = static_cast<Detail::LogStream *>(m_stream)->TakeMessage();
+                Detail::LogStreams::Release();
+                m_impl.PutMessage(m_level, std::move(message));
             }
             catch (std::exception const &e)
             {
@@ -230,6 +619,11 @@ namespace Mif
             }
         }
 
+        void Log::SetLevel(Level const &level)
+        {
+            m_maxLevel = level;
+        }
+
         void InitConsoleLog(Log::Level const &level)
         {
             Detail::Logger::InitConsoleLog(level);
@@ -242,5 +636,20 @@ namespace Mif
             Detail::Logger::InitFileLog(level, logDir, filePattern, maxSize, maxCount);
         }
 
+        void SetLogOverflow(LogOverflow overflow)
+        {
+            Detail::Logger::Get().SetOverflow(overflow);
+        }
+
+        LogCounters GetLogCounters()
+        {
+            return Detail::Logger::Get().GetCounters();
+        }
+
+        void FlushLog()
+        {
+            Detail::Logger::Get().Flush();
+        }
+
     }   // namespace Common
 }   // namespace Mif
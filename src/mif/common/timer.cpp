@@ -0,0 +1,199 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <exception>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+
+// BOOST
+#include <boost/asio/io_service.hpp>
+#include <boost/asio/steady_timer.hpp>
+
+// MIF
+#include "mif/common/log.h"
+#include "mif/common/timer.h"
+
+namespace Mif
+{
+    namespace Common
+    {
+        namespace Detail
+        {
+            namespace
+            {
+
+                class TimerService final
+                {
+                public:
+                    TimerService(TimerService const &) = delete;
+                    TimerService(TimerService &&) = delete;
+                    TimerService& operator = (TimerService const &) = delete;
+                    TimerService& operator = (TimerService &&) = delete;
+
+                    // The service lives while someone holds it.
+                    static std::shared_ptr<TimerService> GetInstance()
+                    {
+                        static std::mutex lock;
+                        static std::weak_ptr<TimerService> instance;
+
+                        std::lock_guard<std::mutex> guard{lock};
+
+                        auto service = instance.lock();
+                        if (!service)
+                        {
+                            service.reset(new TimerService, &TimerService::Delete);
+                            instance = service;
+                        }
+
+                        return service;
+                    }
+
+                    boost::asio::io_service& GetIoService()
+                    {
+                        return m_ioService;
+                    }
+
+                private:
+                    boost::asio::io_service m_ioService;
+                    std::unique_ptr<boost::asio::io_service::work> m_work;
+                    std::thread m_thread;
+
+                    TimerService()
+                        : m_work{new boost::asio::io_service::work{m_ioService}}
+                    {
+                        m_thread = std::thread{[this] ()
+                                {
+                                    try
+                                    {
+                                        m_ioService.run();
+                                    }
+                                    catch (std::exception const &e)
+                                    {
+                                        MIF_LOG(Error) << "[Mif::Common::TimerService] Failed to run io_service. "
+                                                << "Error: " << e.what();
+                                    }
+                                }
+                            };
+                    }
+
+                    ~TimerService()
+                    {
+                        try
+                        {
+                            m_work.reset();
+                            m_ioService.stop();
+                            m_thread.join();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Common::TimerService::~TimerService] Failed to stop timer thread. "
+                                << "Error: " << e.what();
+                        }
+                    }
+
+                    static void Delete(TimerService *service)
+                    {
+                        // The last timer can be released in the timer thread, which can not wait for itself.
+                        if (service->m_thread.get_id() == std::this_thread::get_id())
+                            std::thread{[service] { delete service; }}.detach();
+                        else
+                            delete service;
+                    }
+                };
+
+            }   // namespace
+        }   // namespace Detail
+
+        class PeriodicTimer::Impl final
+            : public std::enable_shared_from_this<Impl>
+        {
+        public:
+            Impl(std::chrono::microseconds const &period, Task task)
+                : m_service{Detail::TimerService::GetInstance()}
+                , m_timer{m_service->GetIoService()}
+                , m_period{period}
+                , m_task{std::move(task)}
+            {
+            }
+
+            void Start()
+            {
+                auto self = shared_from_this();
+                m_service->GetIoService().post([self] { self->Schedule(); });
+            }
+
+            void Stop()
+            {
+                // The lock is recursive for the timer can be destroyed by its own task.
+                std::lock_guard<std::recursive_mutex> lock{m_lock};
+                m_stopped = true;
+                auto self = shared_from_this();
+                m_service->GetIoService().post([self] { self->m_timer.cancel(); });
+            }
+
+        private:
+            std::shared_ptr<Detail::TimerService> m_service;
+            boost::asio::steady_timer m_timer;
+            std::chrono::microseconds const m_period;
+            Task m_task;
+
+            std::recursive_mutex m_lock;
+            bool m_stopped = false;
+
+            void Schedule()
+            {
+                m_timer.expires_from_now(m_period);
+                auto self = shared_from_this();
+                m_timer.async_wait([self] (boost::system::error_code const &error)
+                        {
+                            if (!error)
+                                self->OnTimer();
+                        }
+                    );
+            }
+
+            void OnTimer()
+            {
+                std::lock_guard<std::recursive_mutex> lock{m_lock};
+
+                if (m_stopped)
+                    return;
+
+                try
+                {
+                    m_task();
+                }
+                catch (std::exception const &e)
+                {
+                    MIF_LOG(Warning) << "[Mif::Common::PeriodicTimer::OnTimer] Failed to call task. Error: " << e.what();
+                }
+
+                if (!m_stopped)
+                    Schedule();
+            }
+        };
+
+        PeriodicTimer::PeriodicTimer(std::chrono::microseconds const &period, Task task)
+        {
+            if (period.count() <= 0)
+                throw std::invalid_argument{"[Mif::Common::PeriodicTimer] Period must be more than 0."};
+            if (!task)
+                throw std::invalid_argument{"[Mif::Common::PeriodicTimer] Task must not be empty."};
+
+            m_impl = std::make_shared<Impl>(period, std::move(task));
+            m_impl->Start();
+        }
+
+        PeriodicTimer::~PeriodicTimer()
+        {
+            m_impl->Stop();
+        }
+
+    }   // namespace Common
+}   // namespace Mif
@@ -0,0 +1,254 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <algorithm>
+#include <cstring>
+#include <iterator>
+#include <stdexcept>
+
+// MIF
+#include "mif/db/parameters.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+
+        Parameter::Parameter(char const *text)
+        {
+            if (text && *text)
+            {
+                m_type = Type::Text;
+                m_data = text;
+                m_size = std::strlen(text);
+            }
+        }
+
+        Parameter::Parameter(std::string const &text)
+        {
+            if (!text.empty())
+            {
+                m_type = Type::Text;
+                m_data = text.c_str();
+                m_size = text.length();
+            }
+        }
+
+        Parameter::Parameter(Type type, char const *data, std::size_t size)
+            : m_type{type}
+            , m_data{data}
+            , m_size{size}
+        {
+        }
+
+        Parameter Parameter::Text(char const *data, std::size_t size)
+        {
+            if (!data && size)
+                throw std::invalid_argument{"[Mif::Db::Parameter::Text] Empty data pointer."};
+
+            return {Type::Text, data, size};
+        }
+
+        Parameter Parameter::Blob(void const *data, std::size_t size)
+        {
+            if (!data && size)
+                throw std::invalid_argument{"[Mif::Db::Parameter::Blob] Empty data pointer."};
+
+            return {Type::Blob, static_cast<char const *>(data), size};
+        }
+
+        Parameter::Type Parameter::GetType() const
+        {
+            return m_type;
+        }
+
+        bool Parameter::IsNull() const
+        {
+            return m_type == Type::Null;
+        }
+
+        std::int32_t Parameter::GetInt32() const
+        {
+            if (m_type != Type::Int32)
+                throw std::logic_error{"[Mif::Db::Parameter::GetInt32] The parameter is not a 32-bit integer."};
+
+            return m_int32;
+        }
+
+        std::int64_t Parameter::GetInt64() const
+        {
+            if (m_type == Type::Int32)
+                return m_int32;
+
+            if (m_type != Type::Int64)
+                throw std::logic_error{"[Mif::Db::Parameter::GetInt64] The parameter is not an integer."};
+
+            return m_int64;
+        }
+
+        double Parameter::GetDouble() const
+        {
+            if (m_type != Type::Double)
+                throw std::logic_error{"[Mif::Db::Parameter::GetDouble] The parameter is not a double."};
+
+            return m_double;
+        }
+
+        char const* Parameter::GetData() const
+        {
+            if (m_type != Type::Text && m_type != Type::Blob)
+                throw std::logic_error{"[Mif::Db::Parameter::GetData] The parameter is neither a text nor a blob."};
+
+            return m_data;
+        }
+
+        std::size_t Parameter::GetSize() const
+        {
+            if (m_type != Type::Text && m_type != Type::Blob)
+                throw std::logic_error{"[Mif::Db::Parameter::GetSize] The parameter is neither a text nor a blob."};
+
+            return m_size;
+        }
+
+        Parameters::Parameters(std::initializer_list<Parameter> parameters)
+        {
+            for (auto const &i : parameters)
+                push_back(i);
+        }
+
+        Parameters::Parameters(Parameters const &other)
+        {
+            *this = other;
+        }
+
+        Parameters& Parameters::operator = (Parameters const &other)
+        {
+            if (this == &other)
+                return *this;
+
+            // Only the used part of the buffers is copied and the allocated memory is reused.
+            m_count = other.m_count;
+            if (other.m_entries.empty())
+            {
+                std::copy(other.m_inlineEntries, other.m_inlineEntries + m_count, m_inlineEntries);
+                m_entries.clear();
+            }
+            else
+            {
+                m_entries = other.m_entries;
+            }
+
+            m_dataSize = other.m_dataSize;
+            if (other.m_data.empty())
+            {
+                std::memcpy(m_inlineData, other.m_inlineData, m_dataSize);
+                m_data.clear();
+            }
+            else
+            {
+                m_data.assign(std::begin(other.m_data), std::begin(other.m_data) + m_dataSize);
+            }
+
+            return *this;
+        }
+
+        void Parameters::push_back(Parameter const &parameter)
+        {
+            Entry entry{parameter, 0};
+
+            auto const type = parameter.GetType();
+            if (type == Parameter::Type::Text || type == Parameter::Type::Blob)
+            {
+                entry.offset = Append(parameter.m_data, parameter.m_size, type == Parameter::Type::Text);
+                entry.value.m_data = nullptr;
+            }
+
+            if (m_entries.empty() && m_count < InlineCount)
+            {
+                m_inlineEntries[m_count] = entry;
+            }
+            else
+            {
+                if (m_entries.empty())
+                    m_entries.assign(m_inlineEntries, m_inlineEntries + m_count);
+                m_entries.push_back(entry);
+            }
+
+            ++m_count;
+        }
+
+        void Parameters::clear()
+        {
+            m_count = 0;
+            m_entries.clear();
+            m_dataSize = 0;
+            m_data.clear();
+        }
+
+        std::size_t Parameters::size() const
+        {
+            return m_count;
+        }
+
+        bool Parameters::empty() const
+        {
+            return !m_count;
+        }
+
+        Parameter Parameters::operator [] (std::size_t index) const
+        {
+            if (index >= m_count)
+            {
+                throw std::out_of_range{"[Mif::Db::Parameters::operator []] Index " + std::to_string(index) +
+                        " is out of range [0 ... " + std::to_string(m_count) + ")."};
+            }
+
+            auto const &entry = m_entries.empty() ? m_inlineEntries[index] : m_entries[index];
+
+            auto value = entry.value;
+            if (value.m_type == Parameter::Type::Text || value.m_type == Parameter::Type::Blob)
+                value.m_data = GetDataBuffer() + entry.offset;
+
+            return value;
+        }
+
+        std::size_t Parameters::Append(char const *data, std::size_t size, bool terminate)
+        {
+            auto const offset = m_dataSize;
+            auto const required = m_dataSize + size + (terminate ? 1 : 0);
+
+            char *buffer = nullptr;
+            if (m_data.empty() && required <= InlineDataSize)
+            {
+                buffer = m_inlineData;
+            }
+            else
+            {
+                if (m_data.empty())
+                    m_data.assign(m_inlineData, m_inlineData + m_dataSize);
+                m_data.resize(required);
+                buffer = m_data.data();
+            }
+
+            if (size)
+                std::memcpy(buffer + offset, data, size);
+            if (terminate)
+                buffer[offset + size] = 0;
+
+            m_dataSize = required;
+
+            return offset;
+        }
+
+        char const* Parameters::GetDataBuffer() const
+        {
+            return m_data.empty() ? m_inlineData : m_data.data();
+        }
+
+    }   // namespace Db
+}   // namespace Mif
@@ -0,0 +1,806 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+// BOOST
+#include <boost/asio.hpp>
+#include <boost/date_time/posix_time/posix_time.hpp>
+
+// LIBPR
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/application/iconfig.h"
+#include "mif/common/log.h"
+#include "mif/db/iasync_connection.h"
+#include "mif/db/id/service.h"
+#include "mif/service/creator.h"
+#include "mif/service/make.h"
+
+// THIS
+#include "detail/parameters.h"
+#include "detail/recordset.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace
+            {
+
+                // The queries are multiplexed over a few non-blocking connections by a single reactor thread.
+                // A connection is opened when there is a query for it and no free connection, and every query
+                // is prepared once per connection and then executed by the statement name. The connect_timeout
+                // of the connection string is kept while connecting, and the failed attempts are backed off.
+                class AsyncConnection
+                    : public Service::Inherit<IAsyncConnection>
+                {
+                public:
+                    AsyncConnection(std::string const &connectionString, std::uint32_t connections)
+                        : m_connectionString{connectionString}
+                        , m_connectTimeout{GetConnectTimeout(connectionString)}
+                        , m_work{new boost::asio::io_service::work{m_ioService}}
+                        , m_retryTimer{m_ioService}
+                    {
+                        if (m_connectionString.empty())
+                            throw std::invalid_argument{"[Mif::Db::PostgreSql::AsyncConnection] Empty connection string."};
+
+                        if (!connections)
+                        {
+                            throw std::invalid_argument{"[Mif::Db::PostgreSql::AsyncConnection] "
+                                    "The number of connections must be greater than 0."};
+                        }
+
+                        m_sessions.reserve(connections);
+                        for (std::uint32_t i = 0 ; i < connections ; ++i)
+                            m_sessions.emplace_back(new Session);
+
+                        m_thread = std::thread{[this] ()
+                                {
+                                    try
+                                    {
+                                        m_ioService.run();
+                                    }
+                                    catch (std::exception const &e)
+                                    {
+                                        MIF_LOG(Fatal) << "[Mif::Db::PostgreSql::AsyncConnection] Failed to run io_service. "
+                                                << "Error: " << e.what();
+                                        std::exit(EXIT_FAILURE);
+                                    }
+                                }
+                            };
+                    }
+
+                    AsyncConnection(std::string const &host, std::uint16_t port, std::string const &user,
+                            std::string const &password, std::string const &db, std::uint32_t connectionTimeout,
+                            std::uint32_t connections)
+                        : AsyncConnection{
+                                "host='" + host +  "' "
+                                "port='" + std::to_string(port) + "' "
+                                "user='" + user + "' "
+                                "password='" + password + "' "
+                                "dbname='" + db + "' "
+                                "connect_timeout='" + std::to_string(connectionTimeout) + "' "
+                                "sslmode='disable'",
+                                connections
+                            }
+                    {
+                    }
+
+                    // The number of connections is read from the optional "maxsize" key.
+                    AsyncConnection(Application::IConfigPtr config)
+                        : AsyncConnection{
+                                CheckConfig(config)->GetValue("host"),
+                                config->GetValue<std::uint16_t>("port"),
+                                config->GetValue("user"),
+                                config->GetValue("password"),
+                                config->GetValue("dbname"),
+                                config->GetValue<std::uint32_t>("connectiontimeout"),
+                                config->Exists("maxsize") ? config->GetValue<std::uint32_t>("maxsize") : DefaultConnections
+                            }
+                    {
+                    }
+
+                    ~AsyncConnection()
+                    {
+                        try
+                        {
+                            m_ioService.post([this] () { Shutdown(); });
+                            m_work.reset();
+                            m_thread.join();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Db::PostgreSql::AsyncConnection::~AsyncConnection] "
+                                    << "Failed to stop. Error: " << e.what();
+                        }
+                    }
+
+                private:
+                    static constexpr std::uint32_t DefaultConnections = 8;
+                    // The queries over this limit are run as the unnamed statement and are not kept.
+                    static constexpr std::size_t MaxStatements = 256;
+                    // The delay before the next connection attempt is doubled by every failed one up to the max (ms).
+                    static constexpr std::uint32_t MinRetryDelay = 100;
+                    static constexpr std::uint32_t MaxRetryDelay = 5000;
+
+                    using ConnectionPtr = std::unique_ptr<PGconn, decltype(&PQfinish)>;
+                    using ResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+                    using Descriptor = boost::asio::posix::stream_descriptor;
+
+                    struct Task
+                    {
+                        std::string query;
+                        Parameters parameters;
+                        ResultFormat format;
+                        Callback callback;
+                    };
+
+                    using TaskPtr = std::unique_ptr<Task>;
+
+                    struct Statement
+                    {
+                        std::string name;
+                        Detail::ParameterBinder parameters;
+                    };
+
+                    using StatementPtr = std::unique_ptr<Statement>;
+
+                    enum class State
+                    {
+                        Disconnected,
+                        Connecting,
+                        Idle,
+                        Busy
+                    };
+
+                    enum class Stage
+                    {
+                        Prepare,
+                        Describe,
+                        Execute
+                    };
+
+                    struct Session
+                    {
+                        State state = State::Disconnected;
+                        ConnectionPtr connection{nullptr, [] (PGconn *conn) { if (conn) PQfinish(conn); } };
+                        std::unique_ptr<Descriptor> socket;
+                        std::unique_ptr<boost::asio::deadline_timer> timer;
+                        std::uint64_t attempt = 0;
+                        std::unordered_map<std::string/*query*/, StatementPtr> statements;
+                        std::uint64_t statementId = 0;
+
+                        TaskPtr task;
+                        Stage stage = Stage::Prepare;
+                        Statement *statement = nullptr;
+                        // Only the unnamed statement is owned here.
+                        StatementPtr unnamed;
+                        ResultPtr result{nullptr, [] (PGresult *res) { if (res) PQclear(res); } };
+                    };
+
+                    using SessionPtr = std::unique_ptr<Session>;
+
+                    std::string const m_connectionString;
+                    // In seconds, 0 is no limit.
+                    std::uint32_t const m_connectTimeout;
+
+                    boost::asio::io_service m_ioService;
+                    std::unique_ptr<boost::asio::io_service::work> m_work;
+                    std::thread m_thread;
+
+                    // The state below is used only by the reactor thread.
+                    bool m_stopped = false;
+                    boost::asio::deadline_timer m_retryTimer;
+                    std::uint32_t m_retryDelay = 0;
+                    bool m_backedOff = false;
+                    std::vector<SessionPtr> m_sessions;
+                    std::deque<TaskPtr> m_queue;
+
+                    static Application::IConfigPtr CheckConfig(Application::IConfigPtr config)
+                    {
+                        if (!config)
+                        {
+                            throw std::invalid_argument{"[Mif::Db::PostgreSql::AsyncConnection] "
+                                    "Empty config ptr."};
+                        }
+                        return config;
+                    }
+
+                    // libpq does not keep connect_timeout for the non-blocking connection, so it is read here.
+                    // Like libpq does, a timeout less than 2 seconds is increased to 2.
+                    static std::uint32_t GetConnectTimeout(std::string const &connectionString)
+                    {
+                        char *error = nullptr;
+                        std::unique_ptr<PQconninfoOption, decltype(&PQconninfoFree)> options{
+                                PQconninfoParse(connectionString.c_str(), &error), &PQconninfoFree};
+                        if (error)
+                            PQfreemem(error);
+
+                        // The broken string is reported by the connection attempts.
+                        if (!options)
+                            return 0;
+
+                        for (auto const *i = options.get() ; i->keyword ; ++i)
+                        {
+                            if (std::strcmp(i->keyword, "connect_timeout") || !i->val || !*i->val)
+                                continue;
+
+                            auto const timeout = std::strtol(i->val, nullptr, 10);
+                            return timeout > 0 ? static_cast<std::uint32_t>(std::max<long>(timeout, 2)) : 0;
+                        }
+
+                        return 0;
+                    }
+
+                    static std::string GetError(PGconn *connection)
+                    {
+                        auto const *message = connection ? PQerrorMessage(connection) : nullptr;
+                        return message && *message ? message : "unknown";
+                    }
+
+                    // IAsyncConnection
+                    virtual void Execute(std::string const &query, Parameters const &parameters,
+                            ResultFormat format, Callback callback) override final
+                    {
+                        if (query.empty())
+                            throw std::invalid_argument{"[Mif::Db::PostgreSql::AsyncConnection::Execute] Empty query."};
+
+                        if (!callback)
+                            throw std::invalid_argument{"[Mif::Db::PostgreSql::AsyncConnection::Execute] Empty callback."};
+
+                        std::shared_ptr<Task> task{new Task{query, parameters, format, std::move(callback)}};
+
+                        m_ioService.post([this, task] ()
+                                {
+                                    m_queue.emplace_back(new Task{std::move(*task)});
+                                    Dispatch();
+                                }
+                            );
+                    }
+
+                    void Dispatch()
+                    {
+                        if (m_stopped)
+                            return;
+
+                        std::size_t connecting = 0;
+
+                        for (auto &session : m_sessions)
+                        {
+                            if (m_queue.empty())
+                                return;
+
+                            if (session->state == State::Idle)
+                            {
+                                auto task = std::move(m_queue.front());
+                                m_queue.pop_front();
+                                Start(*session, std::move(task));
+                            }
+                            else if (session->state == State::Connecting)
+                            {
+                                ++connecting;
+                            }
+                        }
+
+                        // The new connections are not opened till the delay after the failed attempt is expired.
+                        if (m_backedOff)
+                            return;
+
+                        // The new connections are opened only for the queries which the connecting ones will not take.
+                        for (auto &session : m_sessions)
+                        {
+                            if (m_queue.size() <= connecting)
+                                return;
+
+                            if (session->state == State::Disconnected)
+                            {
+                                ++connecting;
+                                Connect(*session);
+                            }
+                        }
+                    }
+
+                    void Connect(Session &session)
+                    {
+                        session.connection.reset(PQconnectStart(m_connectionString.c_str()));
+
+                        if (!session.connection || PQstatus(session.connection.get()) == CONNECTION_BAD)
+                        {
+                            OnConnectFailed(session);
+                            return;
+                        }
+
+                        session.state = State::Connecting;
+
+                        if (m_connectTimeout)
+                        {
+                            if (!session.timer)
+                                session.timer.reset(new boost::asio::deadline_timer{m_ioService});
+
+                            auto const attempt = ++session.attempt;
+                            session.timer->expires_from_now(boost::posix_time::seconds{m_connectTimeout});
+                            session.timer->async_wait([this, &session, attempt] (boost::system::error_code const &error)
+                                    {
+                                        if (error || m_stopped || session.state != State::Connecting || session.attempt != attempt)
+                                            return;
+                                        OnConnectFailed(session, "Timeout expired.");
+                                    }
+                                );
+                        }
+
+                        ContinueConnect(session, PGRES_POLLING_WRITING);
+                    }
+
+                    void ContinueConnect(Session &session, PostgresPollingStatusType status)
+                    {
+                        switch (status)
+                        {
+                        case PGRES_POLLING_OK :
+                            if (PQsetnonblocking(session.connection.get(), 1))
+                            {
+                                OnConnectFailed(session);
+                                return;
+                            }
+                            if (session.timer)
+                                session.timer->cancel();
+                            session.state = State::Idle;
+                            ResetBackOff();
+                            Dispatch();
+                            return;
+                        case PGRES_POLLING_READING :
+                        case PGRES_POLLING_WRITING :
+                            break;
+                        default :
+                            OnConnectFailed(session);
+                            return;
+                        }
+
+                        // The socket may be changed by libpq while connecting.
+                        ResetSocket(session);
+                        if (!session.socket)
+                        {
+                            OnConnectFailed(session);
+                            return;
+                        }
+
+                        session.socket->async_wait(status == PGRES_POLLING_READING ? Descriptor::wait_read : Descriptor::wait_write,
+                                [this, &session] (boost::system::error_code const &error)
+                                {
+                                    if (error || m_stopped)
+                                        return;
+                                    ContinueConnect(session, PQconnectPoll(session.connection.get()));
+                                }
+                            );
+                    }
+
+                    // If there is no other connection to take the waiting queries, all of them are failed,
+                    // so the queue is not kept while the server is unavailable.
+                    void OnConnectFailed(Session &session, std::string message = {})
+                    {
+                        if (message.empty())
+                            message = GetError(session.connection.get());
+
+                        Close(session);
+                        BackOff();
+
+                        auto const alive = std::any_of(std::begin(m_sessions), std::end(m_sessions),
+                                [] (SessionPtr const &item) { return item->state != State::Disconnected; } );
+
+                        if (!alive && !m_queue.empty())
+                        {
+                            MIF_LOG(Warning) << "[Mif::Db::PostgreSql::AsyncConnection::OnConnectFailed] "
+                                    << "Failed to open connection. " << m_queue.size() << " query(ies) will be failed. "
+                                    << "Error: " << message;
+
+                            auto const error = std::make_exception_ptr(std::runtime_error{
+                                    "[Mif::Db::PostgreSql::AsyncConnection] Failed to open connection. Error: " + message});
+
+                            std::deque<TaskPtr> queue;
+                            queue.swap(m_queue);
+                            for (auto &task : queue)
+                                Complete(*task, {}, error);
+                        }
+
+                        PostDispatch();
+                    }
+
+                    void BackOff()
+                    {
+                        m_retryDelay = m_retryDelay ? std::min(m_retryDelay * 2, MaxRetryDelay) : MinRetryDelay;
+                        m_backedOff = true;
+
+                        // The previous wait, if any, is cancelled, so only the last one opens the connections again.
+                        m_retryTimer.expires_from_now(boost::posix_time::milliseconds{m_retryDelay});
+                        m_retryTimer.async_wait([this] (boost::system::error_code const &error)
+                                {
+                                    if (error || m_stopped)
+                                        return;
+                                    m_backedOff = false;
+                                    Dispatch();
+                                }
+                            );
+                    }
+
+                    void ResetBackOff()
+                    {
+                        if (!m_retryDelay)
+                            return;
+
+                        m_retryDelay = 0;
+                        m_backedOff = false;
+                        m_retryTimer.cancel();
+                    }
+
+                    void ResetSocket(Session &session)
+                    {
+                        if (session.socket)
+                        {
+                            session.socket->release();
+                            session.socket.reset();
+                        }
+
+                        auto const socket = PQsocket(session.connection.get());
+                        if (socket >= 0)
+                            session.socket.reset(new Descriptor{m_ioService, socket});
+                    }
+
+                    void Close(Session &session)
+                    {
+                        if (session.timer)
+                            session.timer->cancel();
+
+                        if (session.socket)
+                        {
+                            // The socket is owned by libpq.
+                            session.socket->release();
+                            session.socket.reset();
+                        }
+
+                        session.connection.reset();
+                        session.statements.clear();
+                        session.statement = nullptr;
+                        session.unnamed.reset();
+                        session.result.reset();
+                        session.state = State::Disconnected;
+                    }
+
+                    void Start(Session &session, TaskPtr task)
+                    {
+                        session.state = State::Busy;
+                        session.task = std::move(task);
+
+                        auto const &query = session.task->query;
+                        auto iter = session.statements.find(query);
+                        if (iter != std::end(session.statements))
+                        {
+                            session.statement = iter->second.get();
+                            Send(session, Stage::Execute);
+                            return;
+                        }
+
+                        StatementPtr statement{new Statement};
+
+                        if (session.statements.size() < MaxStatements)
+                        {
+                            statement->name = "mif_async_ps_" + std::to_string(++session.statementId);
+                            session.statement = statement.get();
+                            session.statements.emplace(query, std::move(statement));
+                        }
+                        else
+                        {
+                            session.statement = statement.get();
+                            session.unnamed = std::move(statement);
+                        }
+
+                        Send(session, Stage::Prepare);
+                    }
+
+                    void Send(Session &session, Stage stage)
+                    {
+                        session.stage = stage;
+
+                        auto *connection = session.connection.get();
+                        auto &statement = *session.statement;
+                        auto &task = *session.task;
+
+                        int sent = 0;
+
+                        switch (stage)
+                        {
+                        case Stage::Prepare :
+                            sent = PQsendPrepare(connection, statement.name.c_str(), task.query.c_str(), 0, nullptr);
+                            break;
+                        case Stage::Describe :
+                            sent = PQsendDescribePrepared(connection, statement.name.c_str());
+                            break;
+                        case Stage::Execute :
+                            try
+                            {
+                                statement.parameters.Bind(task.parameters);
+                            }
+                            catch (...)
+                            {
+                                Finish(session, {}, std::current_exception());
+                                return;
+                            }
+                            sent = PQsendQueryPrepared(connection, statement.name.c_str(), statement.parameters.GetCount(),
+                                    statement.parameters.GetValues(), statement.parameters.GetLengths(),
+                                    statement.parameters.GetFormats(), task.format == ResultFormat::Binary ? 1 : 0);
+                            break;
+                        }
+
+                        if (!sent)
+                        {
+                            Fail(session, "Failed to send query. Error: " + GetError(connection));
+                            return;
+                        }
+
+                        Flush(session);
+                    }
+
+                    void Flush(Session &session)
+                    {
+                        auto const res = PQflush(session.connection.get());
+
+                        if (res < 0)
+                        {
+                            Fail(session, "Failed to send query. Error: " + GetError(session.connection.get()));
+                            return;
+                        }
+
+                        if (!res)
+                        {
+                            Receive(session);
+                            return;
+                        }
+
+                        session.socket->async_wait(Descriptor::wait_write,
+                                [this, &session] (boost::system::error_code const &error)
+                                {
+                                    if (error || m_stopped)
+                                        return;
+                                    Flush(session);
+                                }
+                            );
+                    }
+
+                    void Receive(Session &session)
+                    {
+                        session.socket->async_wait(Descriptor::wait_read,
+                                [this, &session] (boost::system::error_code const &error)
+                                {
+                                    if (error || m_stopped)
+                                        return;
+
+                                    auto *connection = session.connection.get();
+
+                                    if (!PQconsumeInput(connection))
+                                    {
+                                        Fail(session, "Failed to receive result. Error: " + GetError(connection));
+                                        return;
+                                    }
+
+                                    while (!PQisBusy(connection))
+                                    {
+                                        ResultPtr result{PQgetResult(connection), [] (PGresult *res) { if (res) PQclear(res); } };
+
+                                        if (!result)
+                                        {
+                                            OnResult(session);
+                                            return;
+                                        }
+
+                                        // The first error is kept if the query yields several results.
+                                        if (!session.result || IsSucceeded(session.result.get()))
+                                            session.result = std::move(result);
+                                    }
+
+                                    Receive(session);
+                                }
+                            );
+                    }
+
+                    static bool IsSucceeded(PGresult const *result)
+                    {
+                        auto const status = PQresultStatus(result);
+                        return status == PGRES_COMMAND_OK || status == PGRES_TUPLES_OK;
+                    }
+
+                    void OnResult(Session &session)
+                    {
+                        auto result = std::move(session.result);
+
+                        if (session.stage != Stage::Execute && (!result || !IsSucceeded(result.get())))
+                        {
+                            auto const *message = result ? PQresultErrorMessage(result.get()) : nullptr;
+                            // The query is prepared again by the next call.
+                            auto const error = std::make_exception_ptr(std::runtime_error{
+                                    "[Mif::Db::PostgreSql::AsyncConnection] Failed to prepare query \"" + session.task->query + "\". "
+                                    "Error: " + std::string{message && *message ? message : "unknown"}});
+                            session.statement = nullptr;
+                            session.statements.erase(session.task->query);
+                            Finish(session, {}, error);
+                            return;
+                        }
+
+                        switch (session.stage)
+                        {
+                        case Stage::Prepare :
+                            Send(session, Stage::Describe);
+                            return;
+                        case Stage::Describe :
+                            {
+                                // The parameter types are needed to send the typed values in the binary format.
+                                std::vector<Oid> types;
+                                auto const count = PQnparams(result.get());
+                                types.reserve(count);
+                                for (int i = 0 ; i < count ; ++i)
+                                    types.push_back(PQparamtype(result.get(), i));
+                                session.statement->parameters.SetTypes(std::move(types));
+                            }
+                            Send(session, Stage::Execute);
+                            return;
+                        case Stage::Execute :
+                            break;
+                        }
+
+                        if (!result)
+                        {
+                            Fail(session, "Failed to receive result.");
+                            return;
+                        }
+
+                        if (!IsSucceeded(result.get()))
+                        {
+                            auto const *message = PQresultErrorMessage(result.get());
+                            auto const error = std::make_exception_ptr(std::runtime_error{
+                                    "[Mif::Db::PostgreSql::AsyncConnection] Failed to execute query \"" + session.task->query + "\". "
+                                    "Error: " + std::string{message && *message ? message : "unknown"}});
+                            Finish(session, {}, error);
+                            return;
+                        }
+
+                        IRecordsetPtr recordset;
+                        try
+                        {
+                            // The recordset owns the result from the start and frees it if it fails.
+                            recordset = Service::Make<Detail::Recordset, IRecordset>(result.release(), session.task->format);
+                        }
+                        catch (...)
+                        {
+                            Finish(session, {}, std::current_exception());
+                            return;
+                        }
+
+                        Finish(session, recordset, {});
+                    }
+
+                    // The connection is closed and the query is failed. The rest of the queries are not touched.
+                    void Fail(Session &session, std::string const &message)
+                    {
+                        auto task = std::move(session.task);
+                        Close(session);
+                        Complete(*task, {}, std::make_exception_ptr(std::runtime_error{
+                                "[Mif::Db::PostgreSql::AsyncConnection] " + message}));
+                        PostDispatch();
+                    }
+
+                    void Finish(Session &session, IRecordsetPtr recordset, std::exception_ptr error)
+                    {
+                        auto task = std::move(session.task);
+
+                        session.statement = nullptr;
+                        session.unnamed.reset();
+                        session.result.reset();
+
+                        if (PQstatus(session.connection.get()) == CONNECTION_OK)
+                            session.state = State::Idle;
+                        else
+                            Close(session);
+
+                        Complete(*task, std::move(recordset), std::move(error));
+                        PostDispatch();
+                    }
+
+                    // The next queries are started out of the call chain which has completed the previous one.
+                    void PostDispatch()
+                    {
+                        m_ioService.post([this] () { Dispatch(); });
+                    }
+
+                    static void Complete(Task &task, IRecordsetPtr recordset, std::exception_ptr error)
+                    {
+                        try
+                        {
+                            task.callback(std::move(recordset), std::move(error));
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Db::PostgreSql::AsyncConnection::Complete] "
+                                    << "Failed to call query callback. Error: " << e.what();
+                        }
+                        catch (...)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Db::PostgreSql::AsyncConnection::Complete] "
+                                    << "Failed to call query callback. Error: unknown.";
+                        }
+                    }
+
+                    void Shutdown()
+                    {
+                        m_stopped = true;
+                        m_retryTimer.cancel();
+
+                        auto const error = std::make_exception_ptr(std::runtime_error{
+                                "[Mif::Db::PostgreSql::AsyncConnection] The connection is closed."});
+
+                        for (auto &session : m_sessions)
+                        {
+                            auto task = std::move(session->task);
+                            Close(*session);
+                            if (task)
+                                Complete(*task, {}, error);
+                        }
+
+                        while (!m_queue.empty())
+                        {
+                            auto task = std::move(m_queue.front());
+                            m_queue.pop_front();
+                            Complete(*task, {}, error);
+                        }
+                    }
+                };
+
+            }   // namespace
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+MIF_SERVICE_CREATOR
+(
+    Mif::Db::Id::Service::PostgresAsyncConnection,
+    Mif::Db::PostgreSql::AsyncConnection,
+    std::string,
+    std::uint16_t,
+    std::string,
+    std::string,
+    std::string,
+    std::uint32_t,
+    std::uint32_t
+)
+
+MIF_SERVICE_CREATOR
+(
+    Mif::Db::Id::Service::PostgresAsyncConnection,
+    Mif::Db::PostgreSql::AsyncConnection,
+    std::string,
+    std::uint32_t
+)
+
+MIF_SERVICE_CREATOR
+(
+    Mif::Db::Id::Service::PostgresAsyncConnection,
+    Mif::Db::PostgreSql::AsyncConnection,
+    Mif::Application::IConfigPtr
+)
@@ -10,6 +10,8 @@
 #include <memory>
 #include <stdexcept>
 #include <sstream>
+#include <string>
+#include <vector>
 
 // LIBPQ
 #include <libpq-fe.h>
@@ -21,6 +23,8 @@
 #include "mif/service/icheckable.h"
 
 // THIS
+#include "detail/copy.h"
+#include "detail/iconnection_handle.h"
 #include "detail/statement.h"
 
 namespace Mif
@@ -36,7 +40,8 @@ namespace Mif
                     : public Service::Inherit
                         <
                             IConnection,
-                            Service::ICheckable
+                            Service::ICheckable,
+                            Detail::IConnectionHandle
                         >
                 {
                 public:
@@ -97,20 +102,38 @@ namespace Mif
                                 Query<Service::IService>().get(), query);
                     }
 
+                    virtual IBulkWriterPtr CreateBulkWriter(std::string const &table,
+                            std::vector<std::string> const &columns) override final
+                    {
+                        return Service::Make<Detail::CopyWriter, IBulkWriter>(m_connection.get(),
+                                Query<Service::IService>().get(), table, columns);
+                    }
+
+                    virtual IRecordsetPtr CreateBulkReader(std::string const &query) override final
+                    {
+                        return Service::Make<Detail::CopyReader, IRecordset>(m_connection.get(),
+                                Query<Service::IService>().get(), query);
+                    }
+
                     // Service::ICheckable
+                    // An empty query costs a single round trip and does not touch the server-side statements.
                     virtual bool IsGood() const override final
                     {
-                        try
-                        {
-                            auto *self = const_cast<Connection *>(this);
-                            auto statement = self->CreateStatement("select 1;");
-                            statement->Execute();
-                        }
-                        catch (std::exception const &)
-                        {
+                        auto *connection = m_connection.get();
+
+                        if (PQstatus(connection) != CONNECTION_OK || PQtransactionStatus(connection) != PQTRANS_IDLE)
                             return false;
-                        }
-                        return true;
+
+                        Detail::Statement::ResultPtr result{PQexec(connection, ""),
+                                [] (PGresult *res) { if (res) PQclear(res); } };
+
+                        return PQresultStatus(result.get()) == PGRES_EMPTY_QUERY;
+                    }
+
+                    // Detail::IConnectionHandle
+                    virtual PGconn* GetHandle() override final
+                    {
+                        return m_connection.get();
                     }
                 };
 
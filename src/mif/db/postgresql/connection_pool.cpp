@@ -6,12 +6,20 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <chrono>
 #include <cstdint>
 #include <exception>
+#include <limits>
+#include <stdexcept>
 #include <string>
+#include <vector>
+
+// LIBPR
+#include <libpq-fe.h>
 
 // MIF
 #include "mif/application/iconfig.h"
+#include "mif/common/log.h"
 #include "mif/db/iconnection_pool.h"
 #include "mif/db/id/service.h"
 #include "mif/service/creator.h"
@@ -20,6 +28,11 @@
 #include "mif/service/ipool.h"
 #include "mif/service/make.h"
 
+// THIS
+#include "detail/copy.h"
+#include "detail/iconnection_handle.h"
+#include "detail/statement.h"
+
 namespace Mif
 {
     namespace Db
@@ -29,16 +42,105 @@ namespace Mif
             namespace
             {
 
+                // A checked out connection. The pooled connection goes back to the pool
+                // when this object and all the statements and recordsets made from it are released.
+                class PooledConnection
+                    : public Service::Inherit<IConnection>
+                {
+                public:
+                    PooledConnection(Service::IServicePtr holder)
+                        : m_holder{holder}
+                        , m_connection{Service::Cast<IConnection>(holder)}
+                        , m_handle{Service::Cast<Detail::IConnectionHandle>(holder)->GetHandle()}
+                    {
+                        // The checkout validation costs nothing while the connection is alive.
+                        // The idle connections are pinged by the pool in background.
+                        if (PQstatus(m_handle) == CONNECTION_OK)
+                            return;
+
+                        PQreset(m_handle);
+
+                        if (PQstatus(m_handle) == CONNECTION_OK)
+                            return;
+
+                        auto const *message = PQerrorMessage(m_handle);
+
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::PooledConnection] Failed to restore connection. "
+                                "Error: " + std::string{message ? message : "unknown"}};
+                    }
+
+                    ~PooledConnection()
+                    {
+                        // A transaction left open must not leak to the next user of the connection.
+                        auto const status = PQtransactionStatus(m_handle);
+                        if (status != PQTRANS_INTRANS && status != PQTRANS_INERROR)
+                            return;
+
+                        Detail::Statement::ResultPtr result{PQexec(m_handle, "rollback;"),
+                                [] (PGresult *res) { if (res) PQclear(res); } };
+
+                        if (PQresultStatus(result.get()) != PGRES_COMMAND_OK)
+                        {
+                            auto const *message = PQerrorMessage(m_handle);
+                            MIF_LOG(Warning) << "[Mif::Db::PostgreSql::~PooledConnection] Failed to rollback transaction. "
+                                    << "Error: " << (message ? message : "unknown");
+                        }
+                    }
+
+                private:
+                    Service::IServicePtr m_holder;
+                    IConnectionPtr m_connection;
+                    PGconn *m_handle;
+
+                    // IConnection
+                    virtual void ExecuteDirect(std::string const &query) override final
+                    {
+                        m_connection->ExecuteDirect(query);
+                    }
+
+                    virtual IStatementPtr CreateStatement(std::string const &query) override final
+                    {
+                        return Service::Make<Detail::Statement, IStatement>(m_handle,
+                                Query<Service::IService>().get(), query);
+                    }
+
+                    virtual IBulkWriterPtr CreateBulkWriter(std::string const &table,
+                            std::vector<std::string> const &columns) override final
+                    {
+                        return Service::Make<Detail::CopyWriter, IBulkWriter>(m_handle,
+                                Query<Service::IService>().get(), table, columns);
+                    }
+
+                    virtual IRecordsetPtr CreateBulkReader(std::string const &query) override final
+                    {
+                        return Service::Make<Detail::CopyReader, IRecordset>(m_handle,
+                                Query<Service::IService>().get(), query);
+                    }
+                };
+
                 class ConnectionPool
-                    : public Service::Inherit<IConnectionPool>
+                    : public Service::Inherit
+                        <
+                            IConnectionPool,
+                            Service::IPoolMetrics
+                        >
                 {
                 public:
                     ConnectionPool(std::string const &host, std::uint16_t port, std::string const &user, std::string const &password,
                             std::string const &db, std::uint32_t connectionTimeout)
+                        : ConnectionPool{host, port, user, password, db, connectionTimeout, MakeParams()}
                     {
-                        Init(host, port, user, password, db, connectionTimeout);
                     }
 
+                    ConnectionPool(std::string const &host, std::uint16_t port, std::string const &user, std::string const &password,
+                            std::string const &db, std::uint32_t connectionTimeout, Service::PoolParams const &params)
+                    {
+                        Init(host, port, user, password, db, connectionTimeout, params);
+                    }
+
+                    // Besides the connection settings the optional pool settings are read:
+                    // minsize, maxsize and the timeouts in seconds idletimeout, pinginterval and waittimeout.
+                    // Without maxsize the number of the connections is not limited.
                     ConnectionPool(Application::IConfigPtr config)
                     {
                         if (!config)
@@ -47,27 +149,75 @@ namespace Mif
                                     "Empty config ptr."};
                         }
 
+                        auto params = MakeParams();
+
+                        params.limit = GetValue(config, "maxsize", params.limit);
+                        params.minSize = GetValue(config, "minsize", params.minSize);
+                        params.idleTimeout = GetValue(config, "idletimeout", params.idleTimeout);
+                        params.checkInterval = GetValue(config, "pinginterval", params.checkInterval);
+                        params.waitTimeout = GetValue(config, "waittimeout", params.waitTimeout);
+
                         Init(config->GetValue("host"),
                              config->GetValue<std::uint16_t>("port"),
                              config->GetValue("user"),
                              config->GetValue("password"),
                              config->GetValue("dbname"),
-                             config->GetValue<std::uint32_t>("connectiontimeout")
+                             config->GetValue<std::uint32_t>("connectiontimeout"),
+                             params
                             );
                     }
 
                 private:
                     Service::IPoolPtr m_pool;
+                    Service::IPoolMetricsPtr m_metrics;
+
+                    static Service::PoolParams MakeParams()
+                    {
+                        Service::PoolParams params;
+
+                        // As before, a connection is opened for every concurrent user. The limit is opt-in,
+                        // and waitTimeout is how long GetConnection waits when it is reached.
+                        params.limit = std::numeric_limits<std::uint32_t>::max();
+                        params.minSize = 1;
+                        params.waitTimeout = std::chrono::seconds{10};
+                        // No round trip on checkout. The broken connections are found by PQstatus
+                        // and the idle ones are pinged in background.
+                        params.validateAfter = std::chrono::milliseconds{0};
+                        params.checkInterval = std::chrono::seconds{30};
+                        params.idleTimeout = std::chrono::seconds{60};
+
+                        return params;
+                    }
+
+                    static std::uint32_t GetValue(Application::IConfigPtr config, std::string const &path,
+                            std::uint32_t defaultValue)
+                    {
+                        return config->Exists(path) ? config->GetValue<std::uint32_t>(path) : defaultValue;
+                    }
+
+                    static std::chrono::milliseconds GetValue(Application::IConfigPtr config, std::string const &path,
+                            std::chrono::milliseconds const &defaultValue)
+                    {
+                        if (!config->Exists(path))
+                            return defaultValue;
+                        return std::chrono::seconds{config->GetValue<std::uint32_t>(path)};
+                    }
 
                     // IConnectionPool
                     virtual IConnectionPtr GetConnection() const override final
                     {
-                        return m_pool->GetService<IConnection>();
+                        return Service::Make<PooledConnection, IConnection>(m_pool->GetService());
+                    }
+
+                    // Service::IPoolMetrics
+                    virtual Service::PoolCounters GetCounters() const override final
+                    {
+                        return m_metrics->GetCounters();
                     }
 
                     void Init(std::string const &host, std::uint16_t port, std::string const &user,
                             std::string const &password, std::string const &db,
-                            std::uint32_t connectionTimeout)
+                            std::uint32_t connectionTimeout, Service::PoolParams const &params)
                     {
                         auto factory = Service::Make<Service::Factory, Service::Factory>();
 
@@ -80,10 +230,14 @@ namespace Mif
                                 std::uint32_t{connectionTimeout}
                             );
 
-                        m_pool = Service::Create<Service::Id::PerThreadPool, Service::IPool>(
+                        // The connections are opened on demand and shared by all the threads.
+                        m_pool = Service::Create<Service::Id::Pool, Service::IPool>(
+                                Service::PoolParams{params},
                                 Service::IFactoryPtr{factory},
                                 Service::ServiceId{Db::Id::Service::PostgreSQL}
                             );
+
+                        m_metrics = Service::Cast<Service::IPoolMetrics>(m_pool);
                     }
                 };
 
@@ -104,6 +258,19 @@ MIF_SERVICE_CREATOR
     std::uint32_t
 )
 
+MIF_SERVICE_CREATOR
+(
+    Mif::Db::Id::Service::PostgresConnectionPool,
+    Mif::Db::PostgreSql::ConnectionPool,
+    std::string,
+    std::uint16_t,
+    std::string,
+    std::string,
+    std::string,
+    std::uint32_t,
+    Mif::Service::PoolParams
+)
+
 MIF_SERVICE_CREATOR
 (
     Mif::Db::Id::Service::PostgresConnectionPool,
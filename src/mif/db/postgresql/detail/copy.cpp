@@ -0,0 +1,955 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <algorithm>
+#include <cctype>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <utility>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "copy.h"
+#include "types.h"
+#include "values.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+                namespace
+                {
+
+                    using ResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
+
+                    // The signature, the flags and the header extension length.
+                    char const BinaryHeader[] = "PGCOPY\n\377\r\n\0\0\0\0\0\0\0\0\0";
+                    constexpr std::size_t SignatureSize = 11;
+                    constexpr std::size_t BinaryHeaderSize = 19;
+
+                    ResultPtr Exec(PGconn *connection, std::string const &query)
+                    {
+                        return ResultPtr{PQexec(connection, query.c_str()), [] (PGresult *res) { if (res) PQclear(res); } };
+                    }
+
+                    std::string GetError(PGconn *connection, PGresult const *result = nullptr)
+                    {
+                        auto const *message = result ? PQresultErrorMessage(result) : nullptr;
+                        if (!message || !*message)
+                            message = PQerrorMessage(connection);
+                        return message && *message ? message : "unknown";
+                    }
+
+                    // Reads the results of the completed COPY. Returns the error of the first failed one.
+                    std::string CompleteCopy(PGconn *connection, std::uint64_t *rows)
+                    {
+                        std::string error;
+
+                        while (auto *received = PQgetResult(connection))
+                        {
+                            ResultPtr result{received, [] (PGresult *res) { if (res) PQclear(res); } };
+
+                            if (PQresultStatus(result.get()) == PGRES_COMMAND_OK)
+                            {
+                                if (rows)
+                                    *rows = std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+                            }
+                            else if (error.empty())
+                            {
+                                error = GetError(connection, result.get());
+                            }
+                        }
+
+                        return error;
+                    }
+
+                    bool IsString(Oid type)
+                    {
+                        switch (type)
+                        {
+                        case Types::Bool :
+                        case Types::Int2 :
+                        case Types::Int4 :
+                        case Types::Int8 :
+                        case Types::Float4 :
+                        case Types::Float8 :
+                            return false;
+                        default :
+                            break;
+                        }
+
+                        return true;
+                    }
+
+                    template <typename T>
+                    void CheckRange(std::int64_t value)
+                    {
+                        if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max())
+                        {
+                            throw std::out_of_range{"Value " + std::to_string(value) + " is out of range "
+                                    "of the column type."};
+                        }
+                    }
+
+                    std::string ToText(double value)
+                    {
+                        // The shortest form which is read back to the same value.
+                        char buffer[32];
+                        std::snprintf(buffer, sizeof(buffer), "%.15g", value);
+                        if (std::strtod(buffer, nullptr) != value)
+                            std::snprintf(buffer, sizeof(buffer), "%.17g", value);
+                        return buffer;
+                    }
+
+                    std::string ToText(std::int64_t value)
+                    {
+                        char buffer[32];
+                        std::snprintf(buffer, sizeof(buffer), "%" PRId64, value);
+                        return buffer;
+                    }
+
+                    std::string JoinColumns(std::vector<std::string> const &columns)
+                    {
+                        std::string list;
+                        for (auto const &column : columns)
+                        {
+                            if (column.empty())
+                                throw std::invalid_argument{"Empty column name."};
+                            if (!list.empty())
+                                list += ", ";
+                            list += column;
+                        }
+                        return list;
+                    }
+
+                }   // namespace
+
+                CopyWriter::CopyWriter(PGconn *connection, Service::IService *holder, std::string const &table,
+                        std::vector<std::string> const &columns)
+                try
+                    : m_connection{connection}
+                    , m_holder{holder}
+                {
+                    if (!m_connection)
+                        throw std::invalid_argument{"Empty connection pointer."};
+
+                    if (!m_holder)
+                        throw std::invalid_argument{"Empty connection holder pointer."};
+
+                    if (table.empty())
+                        throw std::invalid_argument{"Empty table name."};
+
+                    if (columns.empty())
+                        throw std::invalid_argument{"No columns."};
+
+                    auto const list = JoinColumns(columns);
+
+                    // The column types are needed to choose the format and to encode the binary values.
+                    auto description = Exec(m_connection, "select " + list + " from " + table + " limit 0;");
+                    if (!description || PQresultStatus(description.get()) != PGRES_TUPLES_OK)
+                        throw std::runtime_error{"Failed to get column types. Error: " + GetError(m_connection, description.get())};
+
+                    m_types.reserve(columns.size());
+                    for (int i = 0 ; i < PQnfields(description.get()) ; ++i)
+                        m_types.push_back(PQftype(description.get(), i));
+
+                    m_binary = std::all_of(std::begin(m_types), std::end(m_types), &Values::HasBinaryForm);
+
+                    auto copy = Exec(m_connection, "copy " + table + " (" + list + ") from stdin" +
+                            (m_binary ? " with (format binary);" : ";"));
+                    if (!copy || PQresultStatus(copy.get()) != PGRES_COPY_IN)
+                        throw std::runtime_error{"Failed to start copy. Error: " + GetError(m_connection, copy.get())};
+
+                    m_buffer.reserve(ChunkSize + ChunkSize / 4);
+
+                    if (m_binary)
+                        Append(BinaryHeader, BinaryHeaderSize);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyWriter] "
+                            "Failed to create bulk writer for table \"" + table + "\". Error: " + std::string{e.what()}};
+                }
+
+                CopyWriter::~CopyWriter()
+                {
+                    if (m_finished)
+                        return;
+
+                    // The server rolls back the rows which are already sent.
+                    if (PQputCopyEnd(m_connection, "The bulk load is canceled.") != 1)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Db::PostgreSql::Detail::~CopyWriter] "
+                                << "Failed to cancel copy. Error: " << GetError(m_connection);
+                    }
+
+                    CompleteCopy(m_connection, nullptr);
+                }
+
+                void CopyWriter::Write(Parameters const &row)
+                {
+                    if (m_finished)
+                        throw std::logic_error{"[Mif::Db::PostgreSql::Detail::CopyWriter::Write] The writer is finished."};
+
+                    if (row.size() != m_types.size())
+                    {
+                        throw std::invalid_argument{"[Mif::Db::PostgreSql::Detail::CopyWriter::Write] "
+                                "The row has " + std::to_string(row.size()) + " values instead of " +
+                                std::to_string(m_types.size()) + "."};
+                    }
+
+                    auto const size = m_buffer.size();
+
+                    try
+                    {
+                        if (m_binary)
+                        {
+                            AppendInteger(row.size(), sizeof(std::int16_t));
+                            for (std::size_t i = 0 ; i < row.size() ; ++i)
+                                WriteBinary(row[i], m_types[i]);
+                        }
+                        else
+                        {
+                            for (std::size_t i = 0 ; i < row.size() ; ++i)
+                            {
+                                if (i)
+                                    Append("\t", 1);
+                                WriteText(row[i], m_types[i]);
+                            }
+                            Append("\n", 1);
+                        }
+                    }
+                    catch (std::exception const &e)
+                    {
+                        // The rows before are kept, so the writer can go on.
+                        m_buffer.resize(size);
+                        throw std::invalid_argument{"[Mif::Db::PostgreSql::Detail::CopyWriter::Write] "
+                                "Failed to write row. Error: " + std::string{e.what()}};
+                    }
+
+                    if (m_buffer.size() >= ChunkSize)
+                        Flush();
+                }
+
+                std::uint64_t CopyWriter::Finish()
+                {
+                    if (m_finished)
+                        throw std::logic_error{"[Mif::Db::PostgreSql::Detail::CopyWriter::Finish] The writer is finished."};
+
+                    if (m_binary)
+                        AppendInteger(static_cast<std::uint16_t>(-1), sizeof(std::int16_t));
+
+                    Flush();
+
+                    if (PQputCopyEnd(m_connection, nullptr) != 1)
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyWriter::Finish] "
+                                "Failed to complete copy. Error: " + GetError(m_connection)};
+                    }
+
+                    m_finished = true;
+
+                    std::uint64_t rows = 0;
+                    auto const error = CompleteCopy(m_connection, &rows);
+                    if (!error.empty())
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyWriter::Finish] "
+                                "Failed to copy rows. Error: " + error};
+                    }
+
+                    return rows;
+                }
+
+                void CopyWriter::WriteBinary(Parameter const &value, Oid type)
+                {
+                    switch (value.GetType())
+                    {
+                    case Parameter::Type::Null :
+                        AppendInteger(static_cast<std::uint32_t>(-1), sizeof(std::int32_t));
+                        return;
+                    case Parameter::Type::Int32 :
+                    case Parameter::Type::Int64 :
+                        {
+                            auto const number = value.GetInt64();
+                            switch (type)
+                            {
+                            case Types::Bool :
+                                AppendInteger(1, sizeof(std::int32_t));
+                                AppendInteger(number ? 1 : 0, 1);
+                                return;
+                            case Types::Int2 :
+                                CheckRange<std::int16_t>(number);
+                                AppendInteger(sizeof(std::int16_t), sizeof(std::int32_t));
+                                AppendInteger(static_cast<std::uint16_t>(number), sizeof(std::int16_t));
+                                return;
+                            case Types::Int4 :
+                                CheckRange<std::int32_t>(number);
+                                AppendInteger(sizeof(std::int32_t), sizeof(std::int32_t));
+                                AppendInteger(static_cast<std::uint32_t>(number), sizeof(std::int32_t));
+                                return;
+                            case Types::Int8 :
+                                AppendInteger(sizeof(std::int64_t), sizeof(std::int32_t));
+                                AppendInteger(static_cast<std::uint64_t>(number), sizeof(std::int64_t));
+                                return;
+                            case Types::Float4 :
+                            case Types::Float8 :
+                                WriteBinary(Parameter{static_cast<double>(number)}, type);
+                                return;
+                            default :
+                                break;
+                            }
+
+                            auto const text = ToText(number);
+                            AppendInteger(text.length(), sizeof(std::int32_t));
+                            Append(text.c_str(), text.length());
+                            return;
+                        }
+                    case Parameter::Type::Double :
+                        {
+                            auto const number = value.GetDouble();
+                            switch (type)
+                            {
+                            case Types::Float4 :
+                                {
+                                    auto const real = static_cast<float>(number);
+                                    std::uint32_t raw = 0;
+                                    std::memcpy(&raw, &real, sizeof(raw));
+                                    AppendInteger(sizeof(float), sizeof(std::int32_t));
+                                    AppendInteger(raw, sizeof(float));
+                                    return;
+                                }
+                            case Types::Float8 :
+                                {
+                                    std::uint64_t raw = 0;
+                                    std::memcpy(&raw, &number, sizeof(raw));
+                                    AppendInteger(sizeof(double), sizeof(std::int32_t));
+                                    AppendInteger(raw, sizeof(double));
+                                    return;
+                                }
+                            default :
+                                break;
+                            }
+
+                            if (!IsString(type))
+                                throw std::invalid_argument{"A real number can not be written into an integer column."};
+
+                            auto const text = ToText(number);
+                            AppendInteger(text.length(), sizeof(std::int32_t));
+                            Append(text.c_str(), text.length());
+                            return;
+                        }
+                    case Parameter::Type::Text :
+                    case Parameter::Type::Blob :
+                        break;
+                    }
+
+                    // The strings are not parsed here, so a numeric column takes only numbers in the binary format.
+                    if (!IsString(type))
+                        throw std::invalid_argument{"A string can not be written into a numeric column in the binary format."};
+
+                    if (value.GetSize() > static_cast<std::size_t>(std::numeric_limits<std::int32_t>::max()))
+                        throw std::length_error{"The value is too long."};
+
+                    AppendInteger(value.GetSize(), sizeof(std::int32_t));
+                    Append(value.GetData(), value.GetSize());
+                }
+
+                void CopyWriter::WriteText(Parameter const &value, Oid type)
+                {
+                    switch (value.GetType())
+                    {
+                    case Parameter::Type::Null :
+                        Append("\\N", 2);
+                        return;
+                    case Parameter::Type::Int32 :
+                    case Parameter::Type::Int64 :
+                        {
+                            auto const text = ToText(value.GetInt64());
+                            Append(text.c_str(), text.length());
+                            return;
+                        }
+                    case Parameter::Type::Double :
+                        {
+                            auto const text = ToText(value.GetDouble());
+                            Append(text.c_str(), text.length());
+                            return;
+                        }
+                    case Parameter::Type::Blob :
+                        if (type == Types::Bytea)
+                        {
+                            // The hex form of bytea with the escaped backslash.
+                            static char const digits[] = "0123456789abcdef";
+                            Append("\\\\x", 3);
+                            auto const *data = reinterpret_cast<unsigned char const *>(value.GetData());
+                            for (std::size_t i = 0 ; i < value.GetSize() ; ++i)
+                            {
+                                char const hex[] = {digits[data[i] >> 4], digits[data[i] & 0x0F]};
+                                Append(hex, sizeof(hex));
+                            }
+                            return;
+                        }
+                        break;
+                    case Parameter::Type::Text :
+                        break;
+                    }
+
+                    auto const *data = value.GetData();
+                    auto const size = value.GetSize();
+
+                    for (std::size_t i = 0 ; i < size ; ++i)
+                    {
+                        switch (data[i])
+                        {
+                        case '\\' :
+                            Append("\\\\", 2);
+                            break;
+                        case '\t' :
+                            Append("\\t", 2);
+                            break;
+                        case '\n' :
+                            Append("\\n", 2);
+                            break;
+                        case '\r' :
+                            Append("\\r", 2);
+                            break;
+                        default :
+                            m_buffer.push_back(data[i]);
+                            break;
+                        }
+                    }
+                }
+
+                void CopyWriter::Append(char const *data, std::size_t size)
+                {
+                    m_buffer.insert(std::end(m_buffer), data, data + size);
+                }
+
+                void CopyWriter::AppendInteger(std::uint64_t value, std::size_t size)
+                {
+                    char buffer[sizeof(value)];
+                    Types::WriteBigEndian(value, buffer, size);
+                    Append(buffer, size);
+                }
+
+                void CopyWriter::Flush()
+                {
+                    if (m_buffer.empty())
+                        return;
+
+                    if (PQputCopyData(m_connection, m_buffer.data(), static_cast<int>(m_buffer.size())) != 1)
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyWriter::Flush] "
+                                "Failed to send rows. Error: " + GetError(m_connection)};
+                    }
+
+                    m_buffer.clear();
+                }
+
+                CopyReader::CopyReader(PGconn *connection, Service::IService *holder, std::string const &query)
+                try
+                    : m_connection{connection}
+                    , m_holder{holder}
+                {
+                    if (!m_connection)
+                        throw std::invalid_argument{"Empty connection pointer."};
+
+                    if (!m_holder)
+                        throw std::invalid_argument{"Empty connection holder pointer."};
+
+                    if (query.empty())
+                        throw std::invalid_argument{"Empty query."};
+
+                    // The query is only described to get the field names and types.
+                    ResultPtr prepared{PQprepare(m_connection, "", query.c_str(), 0, nullptr),
+                            [] (PGresult *res) { if (res) PQclear(res); } };
+                    if (!prepared || PQresultStatus(prepared.get()) != PGRES_COMMAND_OK)
+                        throw std::runtime_error{"Failed to prepare query. Error: " + GetError(m_connection, prepared.get())};
+
+                    ResultPtr description{PQdescribePrepared(m_connection, ""),
+                            [] (PGresult *res) { if (res) PQclear(res); } };
+                    if (!description || PQresultStatus(description.get()) != PGRES_COMMAND_OK)
+                        throw std::runtime_error{"Failed to describe query. Error: " + GetError(m_connection, description.get())};
+
+                    auto const count = PQnfields(description.get());
+                    m_names.reserve(count);
+                    m_types.reserve(count);
+                    for (int i = 0 ; i < count ; ++i)
+                    {
+                        auto const *name = PQfname(description.get(), i);
+                        m_names.emplace_back(name ? name : "");
+                        m_types.push_back(PQftype(description.get(), i));
+                    }
+
+                    m_binary = std::all_of(std::begin(m_types), std::end(m_types), &Values::HasBinaryForm);
+
+                    auto copy = Exec(m_connection, "copy (" + query + ") to stdout" + (m_binary ? " with (format binary);" : ";"));
+                    if (!copy || PQresultStatus(copy.get()) != PGRES_COPY_OUT)
+                        throw std::runtime_error{"Failed to start copy. Error: " + GetError(m_connection, copy.get())};
+
+                    m_active = true;
+                    m_fields.resize(m_types.size());
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader] "
+                            "Failed to create bulk reader for query \"" + query + "\". Error: " + std::string{e.what()}};
+                }
+
+                CopyReader::~CopyReader()
+                {
+                    if (!m_active)
+                        return;
+
+                    // The rest of the rows is read out to leave the connection ready for the next query.
+                    char *buffer = nullptr;
+                    while (PQgetCopyData(m_connection, &buffer, 0) > 0)
+                        PQfreemem(buffer);
+
+                    CompleteCopy(m_connection, nullptr);
+                }
+
+                void CopyReader::Complete()
+                {
+                    m_active = false;
+
+                    auto const error = CompleteCopy(m_connection, nullptr);
+                    if (!error.empty())
+                        throw std::runtime_error{"Failed to copy rows. Error: " + error};
+                }
+
+                bool CopyReader::ParseBinary(char const *data, std::size_t size)
+                {
+                    std::size_t pos = 0;
+
+                    auto const read = [&data, &size, &pos] (std::size_t length) -> std::uint64_t
+                        {
+                            if (size - pos < length)
+                                throw std::runtime_error{"Unexpected end of the row."};
+                            auto const value = Types::ReadBigEndian(data + pos, length);
+                            pos += length;
+                            return value;
+                        };
+
+                    // The header comes with the first row.
+                    if (!m_headerRead)
+                    {
+                        if (size < BinaryHeaderSize || std::memcmp(data, BinaryHeader, SignatureSize))
+                            throw std::runtime_error{"Bad header of the binary copy."};
+                        pos = BinaryHeaderSize - sizeof(std::int32_t);
+                        pos += static_cast<std::size_t>(read(sizeof(std::int32_t)));
+                        m_headerRead = true;
+                    }
+
+                    if (pos == size)
+                        return false;
+
+                    auto const count = static_cast<std::int16_t>(static_cast<std::uint16_t>(read(sizeof(std::int16_t))));
+
+                    // The trailer.
+                    if (count < 0)
+                        return false;
+
+                    if (static_cast<std::size_t>(count) != m_fields.size())
+                        throw std::runtime_error{"Bad number of the fields in the row."};
+
+                    for (auto &field : m_fields)
+                    {
+                        auto const length = static_cast<std::int32_t>(static_cast<std::uint32_t>(read(sizeof(std::int32_t))));
+
+                        if (length < 0)
+                        {
+                            field = {nullptr, 0, true};
+                            continue;
+                        }
+
+                        if (size - pos < static_cast<std::size_t>(length))
+                            throw std::runtime_error{"Unexpected end of the row."};
+
+                        field = {data + pos, static_cast<std::size_t>(length), false};
+                        pos += length;
+                    }
+
+                    return true;
+                }
+
+                void CopyReader::ParseText(char const *data, std::size_t size)
+                {
+                    if (size && data[size - 1] == '\n')
+                        --size;
+
+                    m_text.clear();
+                    m_text.reserve(size + m_fields.size());
+
+                    std::vector<std::size_t> offsets;
+                    offsets.reserve(m_fields.size());
+
+                    std::size_t index = 0;
+                    std::size_t start = 0;
+
+                    for (std::size_t i = 0 ; i <= size ; ++i)
+                    {
+                        if (i < size && data[i] != '\t')
+                            continue;
+
+                        if (index >= m_fields.size())
+                            throw std::runtime_error{"Bad number of the fields in the row."};
+
+                        auto const *value = data + start;
+                        auto const length = i - start;
+                        start = i + 1;
+
+                        if (length == 2 && value[0] == '\\' && value[1] == 'N')
+                        {
+                            m_fields[index++] = {nullptr, 0, true};
+                            offsets.push_back(0);
+                            continue;
+                        }
+
+                        offsets.push_back(m_text.size());
+
+                        for (std::size_t j = 0 ; j < length ; ++j)
+                        {
+                            auto c = value[j];
+                            if (c == '\\' && j + 1 < length)
+                            {
+                                c = value[++j];
+                                switch (c)
+                                {
+                                case 'b' :
+                                    c = '\b';
+                                    break;
+                                case 'f' :
+                                    c = '\f';
+                                    break;
+                                case 'n' :
+                                    c = '\n';
+                                    break;
+                                case 'r' :
+                                    c = '\r';
+                                    break;
+                                case 't' :
+                                    c = '\t';
+                                    break;
+                                case 'v' :
+                                    c = '\v';
+                                    break;
+                                case 'x' :
+                                    {
+                                        int code = 0;
+                                        int digits = 0;
+                                        for ( ; digits < 2 && j + 1 < length && std::isxdigit(static_cast<unsigned char>(value[j + 1])) ; ++digits)
+                                        {
+                                            auto const d = value[++j];
+                                            code = code * 16 + (std::isdigit(static_cast<unsigned char>(d)) ? d - '0' : (std::tolower(d) - 'a' + 10));
+                                        }
+                                        if (digits)
+                                            c = static_cast<char>(code);
+                                    }
+                                    break;
+                                default :
+                                    if (c >= '0' && c <= '7')
+                                    {
+                                        int code = c - '0';
+                                        for (int digits = 1 ; digits < 3 && j + 1 < length && value[j + 1] >= '0' && value[j + 1] <= '7' ; ++digits)
+                                            code = code * 8 + (value[++j] - '0');
+                                        c = static_cast<char>(code);
+                                    }
+                                    break;
+                                }
+                            }
+                            m_text.push_back(c);
+                        }
+
+                        m_fields[index] = {nullptr, m_text.size() - offsets.back(), false};
+                        m_text.push_back('\0');
+                        ++index;
+                    }
+
+                    if (index != m_fields.size())
+                        throw std::runtime_error{"Bad number of the fields in the row."};
+
+                    // The pointers are set when the buffer is not going to grow anymore.
+                    for (std::size_t i = 0 ; i < m_fields.size() ; ++i)
+                    {
+                        if (!m_fields[i].isNull)
+                            m_fields[i].data = m_text.data() + offsets[i];
+                    }
+                }
+
+                bool CopyReader::Read()
+                try
+                {
+                    if (!m_active)
+                        return false;
+
+                    if (m_retain)
+                    {
+                        if (m_row)
+                            m_retainedRows.push_back(std::move(m_row));
+                        if (!m_binary && !m_text.empty())
+                            m_retainedText.push_back(std::move(m_text));
+                    }
+
+                    for (;;)
+                    {
+                        char *buffer = nullptr;
+                        auto const size = PQgetCopyData(m_connection, &buffer, 0);
+
+                        if (size == -1)
+                        {
+                            Complete();
+                            return false;
+                        }
+
+                        if (size < 0)
+                            throw std::runtime_error{"Failed to receive row. Error: " + GetError(m_connection)};
+
+                        m_row.reset(buffer);
+
+                        if (!m_binary)
+                        {
+                            ParseText(buffer, static_cast<std::size_t>(size));
+                            return true;
+                        }
+
+                        if (ParseBinary(buffer, static_cast<std::size_t>(size)))
+                            return true;
+                    }
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::Read] "
+                            "Failed to read row. Error: " + std::string{e.what()}};
+                }
+
+                std::size_t CopyReader::GetFieldsCount() const
+                {
+                    return m_fields.size();
+                }
+
+                void CopyReader::CheckIndex(std::size_t index) const
+                {
+                    if (index >= m_fields.size())
+                    {
+                        throw std::invalid_argument{"[Mif::Db::PostgreSql::Detail::CopyReader::CheckIndex] "
+                            "Failed to get value. Index " + std::to_string(index) + " is out of range "
+                            "[0 ... " + std::to_string(m_fields.size()) + "]."};
+                    }
+                }
+
+                CopyReader::Field const& CopyReader::GetField(std::size_t index) const
+                {
+                    CheckIndex(index);
+
+                    auto const &field = m_fields[index];
+                    if (field.isNull)
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    return field;
+                }
+
+                bool CopyReader::IsNull(std::size_t index) const
+                {
+                    CheckIndex(index);
+                    return m_fields[index].isNull;
+                }
+
+                std::string CopyReader::GetFieldName(std::size_t index) const
+                {
+                    CheckIndex(index);
+                    return m_names[index];
+                }
+
+                std::size_t CopyReader::GetFieldIndex(std::string const &name) const
+                {
+                    auto const iter = std::find(std::begin(m_names), std::end(m_names), name);
+                    if (iter == std::end(m_names))
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetFieldIndex] "
+                                "Failed to get field index for the field name \"" + name + "\""};
+                    }
+
+                    return static_cast<std::size_t>(std::distance(std::begin(m_names), iter));
+                }
+
+                std::string CopyReader::GetAsString(std::size_t index) const
+                try
+                {
+                    auto const &field = GetField(index);
+                    return Values::GetString(m_types[index], field.data, field.size, m_binary);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetAsString] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                std::int32_t CopyReader::GetAsInt32(std::size_t index) const
+                try
+                {
+                    auto const &field = GetField(index);
+                    auto const value = Values::GetInteger(m_types[index], field.data, field.size, m_binary);
+                    CheckRange<std::int32_t>(value);
+                    return static_cast<std::int32_t>(value);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetAsInt32] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                std::int64_t CopyReader::GetAsInt64(std::size_t index) const
+                try
+                {
+                    auto const &field = GetField(index);
+                    return Values::GetInteger(m_types[index], field.data, field.size, m_binary);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetAsInt64] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                double CopyReader::GetAsDouble(std::size_t index) const
+                try
+                {
+                    auto const &field = GetField(index);
+                    return Values::GetReal(m_types[index], field.data, field.size, m_binary);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetAsDouble] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                Common::Buffer CopyReader::GetAsBuffer(std::size_t index) const
+                try
+                {
+                    // ParseText removes only the COPY escapes, bytea still has its own escaped text form.
+                    auto const &field = GetField(index);
+                    return Values::GetBuffer(m_types[index], field.data, field.size, m_binary);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::GetAsBuffer] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                std::size_t CopyReader::Fetch(Columns &columns, std::size_t maxRows)
+                {
+                    m_retainedRows.clear();
+                    m_retainedText.clear();
+
+                    for (auto const &column : columns.Get())
+                        CheckIndex(column.field);
+
+                    Columns::Rollback rollback{columns};
+
+                    // The rows come one by one, so the columns are filled row by row.
+                    m_retain = true;
+
+                    std::size_t count = 0;
+
+                    try
+                    {
+                        for ( ; count < maxRows && Read() ; ++count)
+                        {
+                            for (auto const &column : columns.Get())
+                            {
+                                auto const &field = m_fields[column.field];
+
+                                if (column.nulls)
+                                    column.nulls->push_back(field.isNull);
+                                else if (field.isNull)
+                                    throw std::logic_error{"Failed to get field value from null."};
+
+                                auto const type = m_types[column.field];
+
+                                switch (column.type)
+                                {
+                                case Columns::Type::Int32 :
+                                    {
+                                        auto &values = *static_cast<std::vector<std::int32_t> *>(column.values);
+                                        if (field.isNull)
+                                        {
+                                            values.emplace_back();
+                                            break;
+                                        }
+                                        auto const value = Values::GetInteger(type, field.data, field.size, m_binary);
+                                        CheckRange<std::int32_t>(value);
+                                        values.push_back(static_cast<std::int32_t>(value));
+                                    }
+                                    break;
+                                case Columns::Type::Int64 :
+                                    {
+                                        auto &values = *static_cast<std::vector<std::int64_t> *>(column.values);
+                                        if (field.isNull)
+                                            values.emplace_back();
+                                        else
+                                            values.push_back(Values::GetInteger(type, field.data, field.size, m_binary));
+                                    }
+                                    break;
+                                case Columns::Type::Double :
+                                    {
+                                        auto &values = *static_cast<std::vector<double> *>(column.values);
+                                        if (field.isNull)
+                                            values.emplace_back();
+                                        else
+                                            values.push_back(Values::GetReal(type, field.data, field.size, m_binary));
+                                    }
+                                    break;
+                                case Columns::Type::String :
+                                    {
+                                        auto &values = *static_cast<std::vector<std::string> *>(column.values);
+                                        if (field.isNull)
+                                            values.emplace_back();
+                                        else
+                                            values.push_back(Values::GetString(type, field.data, field.size, m_binary));
+                                    }
+                                    break;
+                                case Columns::Type::StringView :
+                                    {
+                                        auto &values = *static_cast<std::vector<StringView> *>(column.values);
+                                        if (field.isNull)
+                                            values.push_back({nullptr, 0});
+                                        else
+                                            values.push_back(Values::GetView(type, field.data, field.size, m_binary));
+                                    }
+                                    break;
+                                }
+                            }
+                        }
+                    }
+                    catch (std::exception const &e)
+                    {
+                        m_retain = false;
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::CopyReader::Fetch] "
+                            "Failed to fetch rows. Error: " + std::string{e.what()}};
+                    }
+
+                    m_retain = false;
+                    rollback.Release();
+
+                    return count;
+                }
+
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
@@ -0,0 +1,130 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_POSTGRESQL_DETAIL_COPY_H__
+#define __MIF_DB_POSTGRESQL_DETAIL_COPY_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+// LIBPR
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/db/ibulk_writer.h"
+#include "mif/db/irecordset.h"
+#include "mif/service/iservice.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+
+                // The rows are sent by COPY FROM STDIN. The binary format is used when all the columns
+                // are numbers, booleans or strings, otherwise the server parses the text format.
+                class CopyWriter
+                    : public Service::Inherit<IBulkWriter>
+                {
+                public:
+                    CopyWriter(PGconn *connection, Service::IService *holder, std::string const &table,
+                            std::vector<std::string> const &columns);
+
+                    virtual ~CopyWriter();
+
+                private:
+                    static constexpr std::size_t ChunkSize = 64 * 1024;
+
+                    PGconn *m_connection;
+                    Service::IServicePtr m_holder;
+                    std::vector<Oid> m_types;
+                    bool m_binary = false;
+                    bool m_finished = false;
+                    std::vector<char> m_buffer;
+
+                    void WriteBinary(Parameter const &value, Oid type);
+                    void WriteText(Parameter const &value, Oid type);
+                    void Append(char const *data, std::size_t size);
+                    void AppendInteger(std::uint64_t value, std::size_t size);
+                    void Flush();
+
+                    // IBulkWriter
+                    virtual void Write(Parameters const &row) override final;
+                    virtual std::uint64_t Finish() override final;
+                };
+
+                // The rows of the query are received by COPY TO STDOUT one by one. As the writer,
+                // it uses the binary format when all the fields can be decoded from it.
+                class CopyReader
+                    : public Service::Inherit<IRecordset>
+                {
+                public:
+                    CopyReader(PGconn *connection, Service::IService *holder, std::string const &query);
+
+                    virtual ~CopyReader();
+
+                private:
+                    using BufferPtr = std::unique_ptr<char, decltype(&PQfreemem)>;
+
+                    struct Field
+                    {
+                        char const *data;
+                        std::size_t size;
+                        bool isNull;
+                    };
+
+                    PGconn *m_connection;
+                    Service::IServicePtr m_holder;
+                    std::vector<std::string> m_names;
+                    std::vector<Oid> m_types;
+                    bool m_binary = false;
+                    bool m_active = false;
+                    bool m_headerRead = false;
+
+                    BufferPtr m_row{nullptr, &PQfreemem};
+                    // The unescaped values of a text row, each one is terminated by zero.
+                    std::vector<char> m_text;
+                    std::vector<Field> m_fields;
+
+                    // The rows read by Fetch are kept until its next call, because the string views refer to them.
+                    bool m_retain = false;
+                    std::vector<BufferPtr> m_retainedRows;
+                    std::vector<std::vector<char>> m_retainedText;
+
+                    void Complete();
+                    bool ParseBinary(char const *data, std::size_t size);
+                    void ParseText(char const *data, std::size_t size);
+                    Field const& GetField(std::size_t index) const;
+                    void CheckIndex(std::size_t index) const;
+
+                    // IRecordset
+                    virtual bool Read() override final;
+                    virtual std::size_t GetFieldsCount() const override final;
+                    virtual bool IsNull(std::size_t index) const override final;
+                    virtual std::string GetFieldName(std::size_t index) const override final;
+                    virtual std::size_t GetFieldIndex(std::string const &name) const override final;
+                    virtual std::string GetAsString(std::size_t index) const override final;
+                    virtual std::int32_t GetAsInt32(std::size_t index) const override final;
+                    virtual std::int64_t GetAsInt64(std::size_t index) const override final;
+                    virtual double GetAsDouble(std::size_t index) const override final;
+                    virtual Common::Buffer GetAsBuffer(std::size_t index) const override final;
+                    virtual std::size_t Fetch(Columns &columns, std::size_t maxRows) override final;
+                };
+
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_POSTGRESQL_DETAIL_COPY_H__
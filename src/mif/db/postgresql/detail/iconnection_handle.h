@@ -0,0 +1,41 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_POSTGRESQL_DETAIL_ICONNECTION_HANDLE_H__
+#define __MIF_DB_POSTGRESQL_DETAIL_ICONNECTION_HANDLE_H__
+
+// LIBPR
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/service/iservice.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+
+                // Gives the connection pool access to the native connection,
+                // so the pooled connections can be checked without a round trip.
+                struct IConnectionHandle
+                    : public Service::Inherit<Service::IService>
+                {
+                    virtual PGconn* GetHandle() = 0;
+                };
+
+                using IConnectionHandlePtr = Service::TServicePtr<IConnectionHandle>;
+
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_POSTGRESQL_DETAIL_ICONNECTION_HANDLE_H__
@@ -0,0 +1,199 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// THIS
+#include "parameters.h"
+#include "types.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+                namespace
+                {
+
+                    enum Format
+                    {
+                        Text = 0,
+                        Binary = 1
+                    };
+
+                    template <typename T>
+                    void CheckRange(std::int64_t value, std::size_t index)
+                    {
+                        if (value < std::numeric_limits<T>::min() || value > std::numeric_limits<T>::max())
+                        {
+                            throw std::out_of_range{"[Mif::Db::PostgreSql::Detail::ParameterBinder::Bind] "
+                                    "Value " + std::to_string(value) + " of the parameter with index " +
+                                    std::to_string(index + 1) + " is out of range of the parameter type."};
+                        }
+                    }
+
+                    template <typename TTo, typename TFrom>
+                    TTo BitCast(TFrom from)
+                    {
+                        static_assert(sizeof(TTo) == sizeof(TFrom), "Different sizes.");
+                        TTo to;
+                        std::memcpy(&to, &from, sizeof(to));
+                        return to;
+                    }
+
+                }   // namespace
+
+                void ParameterBinder::SetTypes(std::vector<Oid> types)
+                {
+                    m_types = std::move(types);
+                }
+
+                void ParameterBinder::Bind(IStatement::Parameters const &parameters)
+                {
+                    auto const count = parameters.size();
+
+                    m_values.resize(count);
+                    m_lengths.resize(count);
+                    m_formats.resize(count);
+                    m_scratch.resize(count * ScratchSize);
+
+                    for (std::size_t i = 0 ; i < count ; ++i)
+                    {
+                        auto const prm = parameters[i];
+                        auto const type = i < m_types.size() ? m_types[i] : InvalidOid;
+
+                        switch (prm.GetType())
+                        {
+                        case Parameter::Type::Null :
+                            m_values[i] = nullptr;
+                            m_lengths[i] = 0;
+                            m_formats[i] = Format::Text;
+                            break;
+                        case Parameter::Type::Int32 :
+                        case Parameter::Type::Int64 :
+                            BindInteger(i, prm.GetInt64(), type);
+                            break;
+                        case Parameter::Type::Double :
+                            BindDouble(i, prm.GetDouble(), type);
+                            break;
+                        case Parameter::Type::Text :
+                            m_values[i] = prm.GetData();
+                            m_lengths[i] = static_cast<int>(prm.GetSize());
+                            m_formats[i] = Format::Text;
+                            break;
+                        case Parameter::Type::Blob :
+                            m_values[i] = prm.GetData();
+                            m_lengths[i] = static_cast<int>(prm.GetSize());
+                            m_formats[i] = Format::Binary;
+                            break;
+                        }
+                    }
+                }
+
+                int ParameterBinder::GetCount() const
+                {
+                    return static_cast<int>(m_values.size());
+                }
+
+                char const* const* ParameterBinder::GetValues() const
+                {
+                    return m_values.empty() ? nullptr : m_values.data();
+                }
+
+                int const* ParameterBinder::GetLengths() const
+                {
+                    return m_lengths.empty() ? nullptr : m_lengths.data();
+                }
+
+                int const* ParameterBinder::GetFormats() const
+                {
+                    return m_formats.empty() ? nullptr : m_formats.data();
+                }
+
+                void ParameterBinder::BindInteger(std::size_t index, std::int64_t value, Oid type)
+                {
+                    switch (type)
+                    {
+                    case Types::Bool :
+                        SetBinary(index, value ? 1 : 0, 1);
+                        break;
+                    case Types::Int2 :
+                        CheckRange<std::int16_t>(value, index);
+                        SetBinary(index, static_cast<std::uint16_t>(value), sizeof(std::int16_t));
+                        break;
+                    case Types::Int4 :
+                        CheckRange<std::int32_t>(value, index);
+                        SetBinary(index, static_cast<std::uint32_t>(value), sizeof(std::int32_t));
+                        break;
+                    case Types::Int8 :
+                        SetBinary(index, static_cast<std::uint64_t>(value), sizeof(std::int64_t));
+                        break;
+                    case Types::Float4 :
+                    case Types::Float8 :
+                        BindDouble(index, static_cast<double>(value), type);
+                        break;
+                    default :
+                        SetText(index, std::snprintf(&m_scratch[index * ScratchSize], ScratchSize, "%" PRId64, value));
+                        break;
+                    }
+                }
+
+                void ParameterBinder::BindDouble(std::size_t index, double value, Oid type)
+                {
+                    switch (type)
+                    {
+                    case Types::Float4 :
+                        SetBinary(index, BitCast<std::uint32_t>(static_cast<float>(value)), sizeof(float));
+                        break;
+                    case Types::Float8 :
+                        SetBinary(index, BitCast<std::uint64_t>(value), sizeof(double));
+                        break;
+                    default :
+                        {
+                            // The shortest form which is read back to the same value.
+                            auto *buffer = &m_scratch[index * ScratchSize];
+                            auto length = std::snprintf(buffer, ScratchSize, "%.15g", value);
+                            if (std::strtod(buffer, nullptr) != value)
+                                length = std::snprintf(buffer, ScratchSize, "%.17g", value);
+                            SetText(index, length);
+                        }
+                        break;
+                    }
+                }
+
+                void ParameterBinder::SetBinary(std::size_t index, std::uint64_t value, std::size_t size)
+                {
+                    auto *buffer = &m_scratch[index * ScratchSize];
+                    Types::WriteBigEndian(value, buffer, size);
+
+                    m_values[index] = buffer;
+                    m_lengths[index] = static_cast<int>(size);
+                    m_formats[index] = Format::Binary;
+                }
+
+                void ParameterBinder::SetText(std::size_t index, int length)
+                {
+                    m_values[index] = &m_scratch[index * ScratchSize];
+                    m_lengths[index] = length;
+                    m_formats[index] = Format::Text;
+                }
+
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
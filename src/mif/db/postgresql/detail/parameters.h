@@ -0,0 +1,75 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_POSTGRESQL_DETAIL_PARAMETERS_H__
+#define __MIF_DB_POSTGRESQL_DETAIL_PARAMETERS_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// LIBPR
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/db/istatement.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+
+                // Converts the typed parameters into the libpq arrays. The numbers are sent in the binary format
+                // of the parameter type reported by the server, and as text when there is no binary form for it.
+                // The arrays keep their memory between executions. The text and blob values are not copied,
+                // so the parameters must live until the statement is executed.
+                class ParameterBinder final
+                {
+                public:
+                    ParameterBinder() = default;
+
+                    ParameterBinder(ParameterBinder const &) = delete;
+                    ParameterBinder(ParameterBinder &&) = delete;
+                    ParameterBinder& operator = (ParameterBinder const &) = delete;
+                    ParameterBinder& operator = (ParameterBinder &&) = delete;
+
+                    void SetTypes(std::vector<Oid> types);
+                    void Bind(IStatement::Parameters const &parameters);
+
+                    int GetCount() const;
+                    char const* const* GetValues() const;
+                    int const* GetLengths() const;
+                    int const* GetFormats() const;
+
+                private:
+                    // Enough for any number in the binary or the text form.
+                    static constexpr std::size_t ScratchSize = 32;
+
+                    std::vector<Oid> m_types;
+
+                    std::vector<char const *> m_values;
+                    std::vector<int> m_lengths;
+                    std::vector<int> m_formats;
+                    std::vector<char> m_scratch;
+
+                    void BindInteger(std::size_t index, std::int64_t value, Oid type);
+                    void BindDouble(std::size_t index, double value, Oid type);
+                    void SetBinary(std::size_t index, std::uint64_t value, std::size_t size);
+                    void SetText(std::size_t index, int length);
+                };
+
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_POSTGRESQL_DETAIL_PARAMETERS_H__
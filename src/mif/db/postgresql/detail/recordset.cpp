@@ -6,15 +6,17 @@
 //-------------------------------------------------------------------
 
 // STD
-#include <cstring>
+#include <algorithm>
+#include <limits>
 #include <stdexcept>
+#include <vector>
 
-// BOOST
-#include <boost/scoped_array.hpp>
-#include <boost/shared_array.hpp>
+// MIF
+#include "mif/common/log.h"
 
 // THIS
 #include "recordset.h"
+#include "values.h"
 
 namespace Mif
 {
@@ -26,9 +28,12 @@ namespace Mif
             {
 
                 Recordset::Recordset(PGconn *connection, Service::IService *holder,
-                        std::string const &statementName, Parameters const &parameters)
+                        std::string const &statementName, ParameterBinder const &parameters,
+                        IStatement::ExecuteOptions const &options)
                     : m_connection{connection}
                     , m_holder{holder}
+                    , m_binary{options.format == IStatement::ResultFormat::Binary}
+                    , m_streaming{options.fetchSize != 0}
                 {
                     if (!m_connection)
                         throw std::invalid_argument{"[Mif::Db::PostgreSql::Detail::Recordset] Empty connection pointer."};
@@ -39,56 +44,164 @@ namespace Mif
                     if (statementName.empty())
                         throw std::invalid_argument{"[Mif::Db::PostgreSql::Detail::Recordset] Empty query."};
 
-                    using ParamHolder = boost::shared_array<char>;
-                    std::list<ParamHolder> paramHolders;
-                    boost::scoped_array<char *> paramValues;
+                    if (!m_streaming)
+                    {
+                        m_result.reset(PQexecPrepared(m_connection, statementName.c_str(), parameters.GetCount(),
+                                parameters.GetValues(), parameters.GetLengths(), parameters.GetFormats(), m_binary ? 1 : 0));
 
-                    if (!parameters.empty())
+                        CheckResult("[Mif::Db::PostgreSql::Detail::Recordset]");
+                    }
+                    else
                     {
-                        paramValues.reset(new char * [parameters.size()]);
-                        std::size_t index = 0;
-                        for (auto const &prm : parameters)
+                        // A cancel aborts the transaction of the caller, so inside of it the rest is read out.
+                        m_cancelOnClose = PQtransactionStatus(m_connection) == PQTRANS_IDLE;
+
+                        if (!PQsendQueryPrepared(m_connection, statementName.c_str(), parameters.GetCount(),
+                                parameters.GetValues(), parameters.GetLengths(), parameters.GetFormats(), m_binary ? 1 : 0))
                         {
-                            if (prm.empty())
-                            {
-                                paramValues[index] = nullptr;
-                            }
-                            else
-                            {
-                                auto const &value = prm;
-                                auto const length = value.length();
-                                ParamHolder holder{new char [length + 1]};
-                                std::strncpy(holder.get(), value.c_str(), length + 1);
-                                paramHolders.push_back(holder);
-                                paramValues[index] = holder.get();
-                            }
-
-                            ++index;
+                            auto const *message = PQerrorMessage(m_connection);
+                            throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] Failed to send query. "
+                                    "Error: " + std::string{message ? message : "unknown"}};
                         }
+
+#ifdef LIBPQ_HAS_CHUNK_MODE
+                        auto const res = PQsetChunkedRowsMode(m_connection, static_cast<int>(options.fetchSize));
+#else
+                        // The libpq before 17 can receive the rows only one by one.
+                        auto const res = PQsetSingleRowMode(m_connection);
+#endif
+                        if (!res)
+                        {
+                            DropRows();
+                            throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] "
+                                    "Failed to switch connection to streaming mode."};
+                        }
+
+                        // The first rows are waited for here to report the query errors from Execute.
+                        ReceiveRows();
                     }
 
-                    m_result.reset(PQexecPrepared(m_connection, statementName.c_str(), parameters.size(),
-                            paramValues.get(), nullptr, nullptr, 0));
+                    auto const count = PQnfields(m_result.get());
+                    if (count < 0)
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] "
+                                "Failed to get fields count."};
+                    }
+
+                    m_fieldsCount = static_cast<std::size_t>(count);
+                }
+
+                Recordset::Recordset(PGresult *result, IStatement::ResultFormat format)
+                    : m_connection{nullptr}
+                    , m_binary{format == IStatement::ResultFormat::Binary}
+                {
+                    m_result.reset(result);
+
+                    CheckResult("[Mif::Db::PostgreSql::Detail::Recordset]");
+
+                    auto const count = PQnfields(m_result.get());
+                    if (count < 0)
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] "
+                                "Failed to get fields count."};
+                    }
 
+                    m_fieldsCount = static_cast<std::size_t>(count);
+                }
+
+                Recordset::~Recordset()
+                {
+                    // The rest of the streamed result is dropped to leave the connection ready for the next query.
+                    // The query is cancelled first, so the server does not send the rows nobody reads.
+                    if (m_streaming && !m_streamFinished)
+                    {
+                        if (m_cancelOnClose)
+                            Cancel();
+                        DropRows();
+                    }
+                }
+
+                void Recordset::Cancel()
+                {
+                    std::unique_ptr<PGcancel, decltype(&PQfreeCancel)> cancel{PQgetCancel(m_connection), &PQfreeCancel};
+                    char error[256] = {0};
+                    if (!cancel || !PQcancel(cancel.get(), error, sizeof(error)))
+                    {
+                        MIF_LOG(Warning) << "[Mif::Db::PostgreSql::Detail::Recordset::Cancel] "
+                            << "Failed to cancel query. The rest of the result is read out. "
+                            << "Error: " << (*error ? error : "unknown");
+                    }
+                }
+
+                void Recordset::CheckResult(char const *method) const
+                {
                     if (!m_result)
-                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] Failed to open recordset."};
+                        throw std::runtime_error{std::string{method} + " Failed to open recordset."};
 
                     auto const status = PQresultStatus(m_result.get());
-                    if (status != PGRES_TUPLES_OK && status != PGRES_COMMAND_OK)
+                    switch (status)
                     {
-                        auto const *message = PQresultErrorMessage(m_result.get());
-                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] Failed to open recordset. "
-                                "Error: " + std::string{message ? message : "unknown"}};
+                    case PGRES_TUPLES_OK :
+                    case PGRES_COMMAND_OK :
+                    case PGRES_SINGLE_TUPLE :
+#ifdef LIBPQ_HAS_CHUNK_MODE
+                    case PGRES_TUPLES_CHUNK :
+#endif
+                        return;
+                    default :
+                        break;
                     }
 
-                     auto const count = PQnfields(m_result.get());
-                     if (count < 0)
-                     {
-                         throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset] "
-                                 "Failed to get fields count."};
-                     }
+                    auto const *message = PQresultErrorMessage(m_result.get());
+                    throw std::runtime_error{std::string{method} + " Failed to open recordset. "
+                            "Error: " + std::string{message ? message : "unknown"}};
+                }
+
+                void Recordset::ReceiveRows()
+                {
+                    m_currentRow = -1;
+                    m_result.reset(PQgetResult(m_connection));
 
-                     m_fieldsCount = static_cast<std::size_t>(count);
+                    if (!m_result)
+                    {
+                        m_streamFinished = true;
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset::ReceiveRows] "
+                                "Unexpected end of the result."};
+                    }
+
+                    auto const status = PQresultStatus(m_result.get());
+                    if (status == PGRES_SINGLE_TUPLE)
+                        return;
+#ifdef LIBPQ_HAS_CHUNK_MODE
+                    if (status == PGRES_TUPLES_CHUNK)
+                        return;
+#endif
+
+                    // The last result of the query has no rows, only the status.
+                    ResultPtr last{m_result.release(), [] (PGresult *res) { if (res) PQclear(res); } };
+                    DropRows();
+                    m_result = std::move(last);
+
+                    CheckResult("[Mif::Db::PostgreSql::Detail::Recordset::ReceiveRows]");
+                }
+
+                void Recordset::DropRows()
+                {
+                    m_streamFinished = true;
+                    while (auto *result = PQgetResult(m_connection))
+                        PQclear(result);
+                }
+
+                bool Recordset::HasRows()
+                {
+                    while (PQntuples(m_result.get()) <= m_currentRow + 1)
+                    {
+                        if (!m_streaming || m_streamFinished)
+                            return false;
+                        ReceiveRows();
+                    }
+
+                    return true;
                 }
 
                 void Recordset::CheckIndex(std::size_t index) const
@@ -112,7 +225,7 @@ namespace Mif
                     if (!m_hasNext)
                         return false;
 
-                    if (PQntuples(m_result.get()) <= m_currentRow + 1)
+                    if (!HasRows())
                     {
                         m_hasNext = false;
                         return false;
@@ -166,29 +279,74 @@ namespace Mif
                     return index;
                 }
 
-                std::string Recordset::GetAsString(std::size_t index) const
+                StringView Recordset::GetView(int row, std::size_t index) const
                 {
-                    if (IsNull(index))
-                    {
-                        throw std::logic_error{"[Mif::Db::PostgreSql::Detail::Recordset::GetAsString] "
-                            "Failed to get " + std::to_string(index) + " field value from null."};
-                    }
+                    auto const field = static_cast<int>(index);
+                    return Values::GetView(PQftype(m_result.get(), field), GetValue(row, field),
+                            static_cast<std::size_t>(PQgetlength(m_result.get(), row, field)), m_binary);
+                }
 
-                    auto const *value = PQgetvalue(m_result.get(), m_currentRow, static_cast<int>(index));
+                std::string Recordset::GetString(int row, std::size_t index) const
+                {
+                    auto const field = static_cast<int>(index);
+                    return Values::GetString(PQftype(m_result.get(), field), GetValue(row, field),
+                            static_cast<std::size_t>(PQgetlength(m_result.get(), row, field)), m_binary);
+                }
 
-                    if (!value)
-                    {
-                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset::GetAsString] "
-                            "Failed to get " + std::to_string(index) + " field value."};
-                    }
+                std::int64_t Recordset::GetInteger(int row, std::size_t index) const
+                {
+                    auto const field = static_cast<int>(index);
+                    return Values::GetInteger(PQftype(m_result.get(), field), GetValue(row, field),
+                            static_cast<std::size_t>(PQgetlength(m_result.get(), row, field)), m_binary);
+                }
+
+                double Recordset::GetReal(int row, std::size_t index) const
+                {
+                    auto const field = static_cast<int>(index);
+                    return Values::GetReal(PQftype(m_result.get(), field), GetValue(row, field),
+                            static_cast<std::size_t>(PQgetlength(m_result.get(), row, field)), m_binary);
+                }
+
+                Common::Buffer Recordset::GetBuffer(int row, std::size_t index) const
+                {
+                    auto const field = static_cast<int>(index);
+                    return Values::GetBuffer(PQftype(m_result.get(), field), GetValue(row, field),
+                            static_cast<std::size_t>(PQgetlength(m_result.get(), row, field)), m_binary);
+                }
 
+                char const* Recordset::GetValue(int row, int field) const
+                {
+                    auto const *value = PQgetvalue(m_result.get(), row, field);
+                    if (!value)
+                        throw std::runtime_error{"Failed to get field value."};
                     return value;
                 }
 
+                std::string Recordset::GetAsString(std::size_t index) const
+                try
+                {
+                    if (IsNull(index))
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    return GetString(m_currentRow, index);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset::GetAsString] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
                 std::int32_t Recordset::GetAsInt32(std::size_t index) const
                 try
                 {
-                    return static_cast<std::int32_t>(std::stoi(GetAsString(index)));
+                    if (IsNull(index))
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    auto const value = GetInteger(m_currentRow, index);
+                    if (value < std::numeric_limits<std::int32_t>::min() || value > std::numeric_limits<std::int32_t>::max())
+                        throw std::out_of_range{"The value is out of range of 32-bit integer."};
+
+                    return static_cast<std::int32_t>(value);
                 }
                 catch (std::exception const &e)
                 {
@@ -199,7 +357,10 @@ namespace Mif
                 std::int64_t Recordset::GetAsInt64(std::size_t index) const
                 try
                 {
-                    return static_cast<std::int64_t>(std::stoll(GetAsString(index)));
+                    if (IsNull(index))
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    return GetInteger(m_currentRow, index);
                 }
                 catch (std::exception const &e)
                 {
@@ -210,7 +371,10 @@ namespace Mif
                 double Recordset::GetAsDouble(std::size_t index) const
                 try
                 {
-                    return (std::stod(GetAsString(index)));
+                    if (IsNull(index))
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    return GetReal(m_currentRow, index);
                 }
                 catch (std::exception const &e)
                 {
@@ -218,6 +382,122 @@ namespace Mif
                         "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
                 }
 
+                Common::Buffer Recordset::GetAsBuffer(std::size_t index) const
+                try
+                {
+                    if (IsNull(index))
+                        throw std::logic_error{"Failed to get field value from null."};
+
+                    return GetBuffer(m_currentRow, index);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset::GetAsBuffer] "
+                        "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
+                }
+
+                template <typename T, typename TGetter>
+                void Recordset::FetchColumn(Columns::Column const &column, int first, int count, TGetter getter) const
+                {
+                    auto &values = *static_cast<std::vector<T> *>(column.values);
+                    values.reserve(values.size() + count);
+                    if (column.nulls)
+                        column.nulls->reserve(column.nulls->size() + count);
+
+                    auto const field = static_cast<int>(column.field);
+
+                    for (auto row = first ; row < first + count ; ++row)
+                    {
+                        auto const isNull = !!PQgetisnull(m_result.get(), row, field);
+
+                        if (column.nulls)
+                            column.nulls->push_back(isNull);
+                        else if (isNull)
+                            throw std::logic_error{"Failed to get field value from null in row " + std::to_string(row) + "."};
+
+                        if (isNull)
+                            values.emplace_back();
+                        else
+                            values.push_back(getter(row));
+                    }
+                }
+
+                std::size_t Recordset::Fetch(Columns &columns, std::size_t maxRows)
+                try
+                {
+                    if (!m_hasNext)
+                        return 0;
+
+                    if (!maxRows)
+                        return 0;
+
+                    if (!HasRows())
+                    {
+                        m_hasNext = false;
+                        return 0;
+                    }
+
+                    // In the streaming mode only the rows of the current portion are taken,
+                    // because the next portion releases the memory of the previous one.
+                    auto const first = m_currentRow + 1;
+                    auto const total = PQntuples(m_result.get());
+
+                    auto const count = static_cast<int>(std::min<std::size_t>(maxRows, total - first));
+
+                    Columns::Rollback rollback{columns};
+
+                    // The columns are filled one by one, so every vector is written sequentially.
+                    for (auto const &column : columns.Get())
+                    {
+                        CheckIndex(column.field);
+
+                        auto const index = column.field;
+
+                        switch (column.type)
+                        {
+                        case Columns::Type::Int32 :
+                            FetchColumn<std::int32_t>(column, first, count, [this, index] (int row)
+                                    {
+                                        auto const value = GetInteger(row, index);
+                                        if (value < std::numeric_limits<std::int32_t>::min() ||
+                                                value > std::numeric_limits<std::int32_t>::max())
+                                        {
+                                            throw std::out_of_range{"The value is out of range of 32-bit integer."};
+                                        }
+                                        return static_cast<std::int32_t>(value);
+                                    }
+                                );
+                            break;
+                        case Columns::Type::Int64 :
+                            FetchColumn<std::int64_t>(column, first, count, [this, index] (int row)
+                                    { return GetInteger(row, index); } );
+                            break;
+                        case Columns::Type::Double :
+                            FetchColumn<double>(column, first, count, [this, index] (int row)
+                                    { return GetReal(row, index); } );
+                            break;
+                        case Columns::Type::String :
+                            FetchColumn<std::string>(column, first, count, [this, index] (int row)
+                                    { return GetString(row, index); } );
+                            break;
+                        case Columns::Type::StringView :
+                            FetchColumn<StringView>(column, first, count, [this, index] (int row)
+                                    { return GetView(row, index); } );
+                            break;
+                        }
+                    }
+
+                    rollback.Release();
+                    m_currentRow = first + count - 1;
+
+                    return static_cast<std::size_t>(count);
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Recordset::Fetch] "
+                        "Failed to fetch rows. Error: " + std::string{e.what()}};
+                }
+
             }   // namespace Detail
         }   // namespace PostgreSql
     }   // namespace Db
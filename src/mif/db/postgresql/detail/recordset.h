@@ -9,7 +9,6 @@
 #define __MIF_DB_POSTGRESQL_DETAIL_RECORDSET_H__
 
 // STD
-#include <list>
 #include <memory>
 #include <string>
 
@@ -18,8 +17,12 @@
 
 // MIF
 #include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
 #include "mif/service/iservice.h"
 
+// THIS
+#include "parameters.h"
+
 namespace Mif
 {
     namespace Db
@@ -33,10 +36,12 @@ namespace Mif
                     : public Service::Inherit<IRecordset>
                 {
                 public:
-                    using Parameters = std::list<std::string/*value*/>;
-
                     Recordset(PGconn *connection, Service::IService *holder, std::string const &statementName,
-                            Parameters const &parameters);
+                            ParameterBinder const &parameters, IStatement::ExecuteOptions const &options);
+                    // Takes the ownership of the already received result.
+                    Recordset(PGresult *result, IStatement::ResultFormat format);
+
+                    virtual ~Recordset();
 
                 private:
                     PGconn *m_connection;
@@ -44,11 +49,31 @@ namespace Mif
                     bool m_hasNext = true;
                     int m_currentRow = -1;
                     std::size_t m_fieldsCount = 0;
+                    bool m_binary = false;
+                    // In the streaming mode m_result holds only the last received rows.
+                    bool m_streaming = false;
+                    bool m_streamFinished = false;
+                    bool m_cancelOnClose = false;
 
                     using ResultPtr = std::unique_ptr<PGresult, decltype(&PQclear)>;
                     ResultPtr m_result{nullptr, [] (PGresult *res) { if (res) PQclear(res); } };
 
                     void CheckIndex(std::size_t index) const;
+                    void CheckResult(char const *method) const;
+                    void ReceiveRows();
+                    void DropRows();
+                    void Cancel();
+                    bool HasRows();
+
+                    StringView GetView(int row, std::size_t index) const;
+                    std::string GetString(int row, std::size_t index) const;
+                    std::int64_t GetInteger(int row, std::size_t index) const;
+                    double GetReal(int row, std::size_t index) const;
+                    Common::Buffer GetBuffer(int row, std::size_t index) const;
+                    char const* GetValue(int row, int field) const;
+
+                    template <typename T, typename TGetter>
+                    void FetchColumn(Columns::Column const &column, int first, int count, TGetter getter) const;
 
                     // IRecordset
                     virtual bool Read() override final;
@@ -60,6 +85,8 @@ namespace Mif
                     virtual std::int32_t GetAsInt32(std::size_t index) const override final;
                     virtual std::int64_t GetAsInt64(std::size_t index) const override final;
                     virtual double GetAsDouble(std::size_t index) const override final;
+                    virtual Common::Buffer GetAsBuffer(std::size_t index) const override final;
+                    virtual std::size_t Fetch(Columns &columns, std::size_t maxRows) override final;
                 };
 
             }   // namespace Detail
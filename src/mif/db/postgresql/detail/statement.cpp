@@ -6,13 +6,18 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <algorithm>
+#include <cstdlib>
 #include <stdexcept>
+#include <utility>
+#include <vector>
 
 // BOOST
 #include <boost/algorithm/string.hpp>
 
 // MIF
 #include "mif/common/log.h"
+#include "mif/common/unused.h"
 #include "mif/common/uuid_generator.h"
 #include "mif/service/make.h"
 
@@ -63,6 +68,26 @@ namespace Mif
                                 "Failed to create prepared statement for query \"" + query + "\". "
                                 "Erro: " + std::string{message ? message : "unknown"}};
                     }
+
+                    // The parameter types are needed to send the typed values in the binary format.
+                    ResultPtr description{PQdescribePrepared(m_connection, m_name.c_str()),
+                            [] (PGresult *res) { if (res) PQclear(res); } };
+
+                    if (!description || PQresultStatus(description.get()) != PGRES_COMMAND_OK)
+                    {
+                        auto const *message = description ? PQresultErrorMessage(description.get()) : nullptr;
+
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Statement] "
+                                "Failed to get parameters of prepared statement for query \"" + query + "\". "
+                                "Error: " + std::string{message ? message : "unknown"}};
+                    }
+
+                    std::vector<Oid> types;
+                    auto const count = PQnparams(description.get());
+                    types.reserve(count);
+                    for (int i = 0 ; i < count ; ++i)
+                        types.push_back(PQparamtype(description.get(), i));
+                    m_parameters.SetTypes(std::move(types));
                 }
 
                 Statement::~Statement()
@@ -89,7 +114,147 @@ namespace Mif
 
                 IRecordsetPtr Statement::Execute(Parameters const &parameters)
                 {
-                    return Service::Make<Recordset, IRecordset>(m_connection, this, m_name, parameters);
+                    return Execute(parameters, ExecuteOptions{});
+                }
+
+                IRecordsetPtr Statement::Execute(Parameters const &parameters, ExecuteOptions const &options)
+                {
+                    m_parameters.Bind(parameters);
+                    return Service::Make<Recordset, IRecordset>(m_connection, this, m_name, m_parameters, options);
+                }
+
+                std::uint64_t Statement::ExecuteBatch(std::vector<Parameters> const &batch)
+                {
+                    if (batch.empty())
+                        return 0;
+
+                    std::uint64_t rows = 0;
+                    std::string error;
+
+#ifdef LIBPQ_HAS_PIPELINING
+                    if (!PQenterPipelineMode(m_connection))
+                    {
+                        auto const *message = PQerrorMessage(m_connection);
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Statement::ExecuteBatch] "
+                                "Failed to enter pipeline mode. Error: " + std::string{message ? message : "unknown"}};
+                    }
+
+                    for (std::size_t first = 0 ; first < batch.size() && error.empty() ; first += BatchPortion)
+                    {
+                        auto const last = std::min(batch.size(), first + BatchPortion);
+                        auto sent = first;
+
+                        try
+                        {
+                            for ( ; sent < last ; ++sent)
+                            {
+                                m_parameters.Bind(batch[sent]);
+
+                                if (!PQsendQueryPrepared(m_connection, m_name.c_str(), m_parameters.GetCount(),
+                                        m_parameters.GetValues(), m_parameters.GetLengths(), m_parameters.GetFormats(), 0))
+                                {
+                                    auto const *message = PQerrorMessage(m_connection);
+                                    throw std::runtime_error{"Failed to send query. "
+                                            "Error: " + std::string{message ? message : "unknown"}};
+                                }
+                            }
+                        }
+                        catch (std::exception const &e)
+                        {
+                            error = e.what();
+                        }
+
+                        // The sent executions are always completed to leave the connection ready for the next query.
+                        if (!PQpipelineSync(m_connection))
+                        {
+                            auto const *message = PQerrorMessage(m_connection);
+                            throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Statement::ExecuteBatch] "
+                                    "Failed to sync pipeline. Error: " + std::string{message ? message : "unknown"}};
+                        }
+
+                        rows += ReceiveBatch(sent - first, error);
+                    }
+
+                    if (!PQexitPipelineMode(m_connection))
+                    {
+                        MIF_LOG(Warning) << "[Mif::Db::PostgreSql::Detail::Statement::ExecuteBatch] "
+                                << "Failed to exit pipeline mode. Error: " << PQerrorMessage(m_connection);
+                    }
+#else
+                    // The libpq before 14 has no pipeline mode, so every execution waits for its result.
+                    for (auto const &parameters : batch)
+                    {
+                        m_parameters.Bind(parameters);
+
+                        ResultPtr result{PQexecPrepared(m_connection, m_name.c_str(), m_parameters.GetCount(),
+                                m_parameters.GetValues(), m_parameters.GetLengths(), m_parameters.GetFormats(), 0),
+                                [] (PGresult *res) { if (res) PQclear(res); } };
+
+                        auto const status = result ? PQresultStatus(result.get()) : PGRES_FATAL_ERROR;
+                        if (status != PGRES_COMMAND_OK && status != PGRES_TUPLES_OK)
+                        {
+                            auto const *message = result ? PQresultErrorMessage(result.get()) : PQerrorMessage(m_connection);
+                            error = message ? message : "unknown";
+                            break;
+                        }
+
+                        rows += std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+                    }
+#endif
+
+                    if (!error.empty())
+                    {
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Statement::ExecuteBatch] "
+                                "Failed to execute batch. Error: " + error};
+                    }
+
+                    return rows;
+                }
+
+                // Reads the results of the given number of the executions and the pipeline sync.
+                // Only the first error is kept; the executions after it are aborted by the server.
+                std::uint64_t Statement::ReceiveBatch(std::size_t count, std::string &error)
+                {
+                    std::uint64_t rows = 0;
+
+#ifdef LIBPQ_HAS_PIPELINING
+                    for (std::size_t i = 0 ; i < count ; ++i)
+                    {
+                        while (auto *received = PQgetResult(m_connection))
+                        {
+                            ResultPtr result{received, [] (PGresult *res) { if (res) PQclear(res); } };
+
+                            switch (PQresultStatus(result.get()))
+                            {
+                            case PGRES_COMMAND_OK :
+                            case PGRES_TUPLES_OK :
+                                rows += std::strtoull(PQcmdTuples(result.get()), nullptr, 10);
+                                break;
+                            case PGRES_PIPELINE_ABORTED :
+                                break;
+                            default :
+                                if (error.empty())
+                                {
+                                    auto const *message = PQresultErrorMessage(result.get());
+                                    error = message && *message ? message : "unknown";
+                                }
+                                break;
+                            }
+                        }
+                    }
+
+                    ResultPtr sync{PQgetResult(m_connection), [] (PGresult *res) { if (res) PQclear(res); } };
+                    if (!sync || PQresultStatus(sync.get()) != PGRES_PIPELINE_SYNC)
+                    {
+                        auto const *message = PQerrorMessage(m_connection);
+                        throw std::runtime_error{"[Mif::Db::PostgreSql::Detail::Statement::ReceiveBatch] "
+                                "Failed to receive pipeline sync. Error: " + std::string{message ? message : "unknown"}};
+                    }
+#else
+                    Common::Unused(count, error);
+#endif
+
+                    return rows;
                 }
 
             }   // namespace Detail
@@ -9,8 +9,11 @@
 #define __MIF_DB_POSTGRESQL_DETAIL_STATEMENT_H__
 
 // STD
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 // LIBPR
 #include <libpq-fe.h>
@@ -19,6 +22,9 @@
 #include "mif/db/istatement.h"
 #include "mif/service/iservice.h"
 
+// THIS
+#include "parameters.h"
+
 namespace Mif
 {
     namespace Db
@@ -39,12 +45,21 @@ namespace Mif
                     virtual ~Statement();
 
                 private:
+                    // The number of the executions sent in one pipeline sync. The results of a portion are small enough
+                    // to fit into the socket buffers, so the server is never blocked writing them.
+                    static constexpr std::size_t BatchPortion = 256;
+
                     PGconn *m_connection;
                     Service::IServicePtr m_holder;
                     std::string m_name;
+                    ParameterBinder m_parameters;
 
                     // IStatement
                     virtual IRecordsetPtr Execute(Parameters const &parameters) override final;
+                    virtual IRecordsetPtr Execute(Parameters const &parameters, ExecuteOptions const &options) override final;
+                    virtual std::uint64_t ExecuteBatch(std::vector<Parameters> const &batch) override final;
+
+                    std::uint64_t ReceiveBatch(std::size_t count, std::string &error);
                 };
 
             }   // namespace Detail
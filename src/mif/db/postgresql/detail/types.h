@@ -0,0 +1,67 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_POSTGRESQL_DETAIL_TYPES_H__
+#define __MIF_DB_POSTGRESQL_DETAIL_TYPES_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+
+// LIBPR
+#include <libpq-fe.h>
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+                namespace Types
+                {
+
+                    // Built-in type ids (see pg_type.h of the server).
+                    constexpr Oid Bool = 16;
+                    constexpr Oid Bytea = 17;
+                    constexpr Oid Char = 18;
+                    constexpr Oid Name = 19;
+                    constexpr Oid Int8 = 20;
+                    constexpr Oid Int2 = 21;
+                    constexpr Oid Int4 = 23;
+                    constexpr Oid Text = 25;
+                    constexpr Oid Json = 114;
+                    constexpr Oid Xml = 142;
+                    constexpr Oid Float4 = 700;
+                    constexpr Oid Float8 = 701;
+                    constexpr Oid Unknown = 705;
+                    constexpr Oid BpChar = 1042;
+                    constexpr Oid VarChar = 1043;
+
+                    // Values of the binary format are in network byte order.
+                    inline std::uint64_t ReadBigEndian(char const *data, std::size_t size)
+                    {
+                        std::uint64_t value = 0;
+                        for (std::size_t i = 0 ; i < size ; ++i)
+                            value = (value << 8) | static_cast<unsigned char>(data[i]);
+                        return value;
+                    }
+
+                    inline void WriteBigEndian(std::uint64_t value, char *data, std::size_t size)
+                    {
+                        for (std::size_t i = 0 ; i < size ; ++i)
+                            data[i] = static_cast<char>((value >> ((size - i - 1) * 8)) & 0xFF);
+                    }
+
+                }   // namespace Types
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_POSTGRESQL_DETAIL_TYPES_H__
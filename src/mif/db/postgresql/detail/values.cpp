@@ -0,0 +1,238 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cerrno>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <stdexcept>
+
+// THIS
+#include "types.h"
+#include "values.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+                namespace Values
+                {
+                    namespace
+                    {
+
+                        bool IsString(Oid type)
+                        {
+                            switch (type)
+                            {
+                            case Types::Bytea :
+                            case Types::Char :
+                            case Types::Name :
+                            case Types::Text :
+                            case Types::Json :
+                            case Types::Xml :
+                            case Types::Unknown :
+                            case Types::BpChar :
+                            case Types::VarChar :
+                                return true;
+                            default :
+                                break;
+                            }
+
+                            return false;
+                        }
+
+                    }   // namespace
+
+                    bool HasBinaryForm(Oid type)
+                    {
+                        switch (type)
+                        {
+                        case Types::Bool :
+                        case Types::Int2 :
+                        case Types::Int4 :
+                        case Types::Int8 :
+                        case Types::Float4 :
+                        case Types::Float8 :
+                            return true;
+                        default :
+                            break;
+                        }
+
+                        return IsString(type);
+                    }
+
+                    StringView GetView(Oid type, char const *value, std::size_t length, bool binary)
+                    {
+                        if (binary && !IsString(type))
+                            throw std::logic_error{"The field type has no string form in the binary result format."};
+
+                        return {value, length};
+                    }
+
+                    std::string GetString(Oid type, char const *value, std::size_t length, bool binary)
+                    {
+                        if (binary)
+                        {
+                            switch (type)
+                            {
+                            case Types::Bool :
+                                return GetInteger(type, value, length, binary) ? "t" : "f";
+                            case Types::Int2 :
+                            case Types::Int4 :
+                            case Types::Int8 :
+                                return std::to_string(GetInteger(type, value, length, binary));
+                            case Types::Float4 :
+                            case Types::Float8 :
+                                {
+                                    // The shortest form which is read back to the same value.
+                                    auto const number = GetReal(type, value, length, binary);
+                                    char buffer[32];
+                                    std::snprintf(buffer, sizeof(buffer), "%.15g", number);
+                                    if (std::strtod(buffer, nullptr) != number)
+                                        std::snprintf(buffer, sizeof(buffer), "%.17g", number);
+                                    return buffer;
+                                }
+                            default :
+                                break;
+                            }
+                        }
+
+                        return GetView(type, value, length, binary).ToString();
+                    }
+
+                    std::int64_t GetInteger(Oid type, char const *value, std::size_t length, bool binary)
+                    {
+                        if (!binary)
+                        {
+                            if (type == Types::Bool)
+                                return *value == 't' ? 1 : 0;
+
+                            // The text after the number is ignored as std::stoll does, so the numeric
+                            // values like "10.00" are read as their integer part.
+                            errno = 0;
+                            char *end = nullptr;
+                            auto const number = std::strtoll(value, &end, 10);
+                            if (end == value || errno == ERANGE)
+                                throw std::invalid_argument{"Failed to convert \"" + std::string{value} + "\" to integer."};
+                            return static_cast<std::int64_t>(number);
+                        }
+
+                        std::size_t size = 0;
+                        switch (type)
+                        {
+                        case Types::Bool :
+                            size = 1;
+                            break;
+                        case Types::Int2 :
+                            size = sizeof(std::int16_t);
+                            break;
+                        case Types::Int4 :
+                            size = sizeof(std::int32_t);
+                            break;
+                        case Types::Int8 :
+                            size = sizeof(std::int64_t);
+                            break;
+                        default :
+                            throw std::logic_error{"The field type is not an integer type."};
+                        }
+
+                        if (length != size)
+                            throw std::runtime_error{"Bad size of the binary value."};
+
+                        auto const raw = Types::ReadBigEndian(value, size);
+
+                        switch (type)
+                        {
+                        case Types::Bool :
+                            return raw ? 1 : 0;
+                        case Types::Int2 :
+                            return static_cast<std::int16_t>(static_cast<std::uint16_t>(raw));
+                        case Types::Int4 :
+                            return static_cast<std::int32_t>(static_cast<std::uint32_t>(raw));
+                        default :
+                            break;
+                        }
+
+                        return static_cast<std::int64_t>(raw);
+                    }
+
+                    double GetReal(Oid type, char const *value, std::size_t length, bool binary)
+                    {
+                        if (!binary)
+                        {
+                            errno = 0;
+                            char *end = nullptr;
+                            auto const number = std::strtod(value, &end);
+                            if (end == value || errno == ERANGE)
+                                throw std::invalid_argument{"Failed to convert \"" + std::string{value} + "\" to double."};
+                            return number;
+                        }
+
+                        switch (type)
+                        {
+                        case Types::Float4 :
+                            {
+                                if (length != sizeof(float))
+                                    throw std::runtime_error{"Bad size of the binary value."};
+                                auto const raw = static_cast<std::uint32_t>(Types::ReadBigEndian(value, sizeof(float)));
+                                float number = 0;
+                                std::memcpy(&number, &raw, sizeof(number));
+                                return number;
+                            }
+                        case Types::Float8 :
+                            {
+                                if (length != sizeof(double))
+                                    throw std::runtime_error{"Bad size of the binary value."};
+                                auto const raw = Types::ReadBigEndian(value, sizeof(double));
+                                double number = 0;
+                                std::memcpy(&number, &raw, sizeof(number));
+                                return number;
+                            }
+                        case Types::Bool :
+                        case Types::Int2 :
+                        case Types::Int4 :
+                        case Types::Int8 :
+                            return static_cast<double>(GetInteger(type, value, length, binary));
+                        default :
+                            break;
+                        }
+
+                        throw std::logic_error{"The field type is not a numeric type."};
+                    }
+
+                    Common::Buffer GetBuffer(Oid type, char const *value, std::size_t length, bool binary)
+                    {
+                        if (binary || type != Types::Bytea)
+                        {
+                            auto const view = GetView(type, value, length, binary);
+                            return {view.data, view.data + view.size};
+                        }
+
+                        // Both the hex and the escape forms are decoded.
+                        std::size_t size = 0;
+                        std::unique_ptr<unsigned char, decltype(&PQfreemem)> data{
+                                PQunescapeBytea(reinterpret_cast<unsigned char const *>(value), &size),
+                                &PQfreemem
+                            };
+                        if (!data)
+                            throw std::invalid_argument{"Failed to unescape the binary string."};
+
+                        auto const *begin = reinterpret_cast<char const *>(data.get());
+                        return {begin, begin + size};
+                    }
+
+                }   // namespace Values
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
@@ -0,0 +1,53 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_POSTGRESQL_DETAIL_VALUES_H__
+#define __MIF_DB_POSTGRESQL_DETAIL_VALUES_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+// LIBPR
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/db/columns.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace PostgreSql
+        {
+            namespace Detail
+            {
+                namespace Values
+                {
+
+                    // Decoding of the field values received in the text or the binary format.
+                    // A text value must be terminated by zero.
+
+                    // Only numbers, booleans, strings and binary strings can be read in the binary format.
+                    bool HasBinaryForm(Oid type);
+
+                    StringView GetView(Oid type, char const *value, std::size_t length, bool binary);
+                    std::string GetString(Oid type, char const *value, std::size_t length, bool binary);
+                    std::int64_t GetInteger(Oid type, char const *value, std::size_t length, bool binary);
+                    double GetReal(Oid type, char const *value, std::size_t length, bool binary);
+                    // The text form of bytea is unescaped, the other values are returned as they are.
+                    Common::Buffer GetBuffer(Oid type, char const *value, std::size_t length, bool binary);
+
+                }   // namespace Values
+            }   // namespace Detail
+        }   // namespace PostgreSql
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_POSTGRESQL_DETAIL_VALUES_H__
@@ -6,10 +6,13 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <cstddef>
 #include <functional>
 #include <memory>
 #include <stdexcept>
 #include <string>
+#include <utility>
+#include <vector>
 
 // BOOST
 #include <boost/scope_exit.hpp>
@@ -26,7 +29,9 @@
 #include "mif/service/make.h"
 
 // THIS
+#include "detail/bulk_writer.h"
 #include "detail/statement.h"
+#include "detail/statement_cache.h"
 
 namespace Mif
 {
@@ -47,6 +52,12 @@ namespace Mif
                     }
 
                     Connection(std::string fileName)
+                        : Connection(fileName, DefaultStatementCacheSize)
+                    {
+                    }
+
+                    // The statement cache is disabled if statementCacheSize is 0.
+                    Connection(std::string fileName, std::size_t statementCacheSize)
                     {
                         if (fileName.empty())
                             throw std::invalid_argument{"[Mif::Db::SQLIte::Connection] Empty file name."};
@@ -66,9 +77,13 @@ namespace Mif
                             throw std::runtime_error{"[Mif::Db::SQLite::Connection] Failed to open in-memory database. "
                                     "Error: " + std::string{message ? message : "unknown"}};
                         }
+
+                        m_statements.reset(new Detail::StatementCache{m_connection.get(), statementCacheSize});
                     }
 
                 private:
+                    static constexpr std::size_t DefaultStatementCacheSize = 64;
+
                     using ConnectionPtr = std::unique_ptr<sqlite3, std::function<void (sqlite3 *)>>;
                     ConnectionPtr m_connection{nullptr, [] (sqlite3 *conn)
                             {
@@ -79,6 +94,9 @@ namespace Mif
                             }
                         };
 
+                    // Declared after the connection to be destroyed before it.
+                    std::unique_ptr<Detail::StatementCache> m_statements;
+
                     // IConnection
                     virtual void ExecuteDirect(std::string const &query) override final
                     {
@@ -107,7 +125,44 @@ namespace Mif
 
                     virtual IStatementPtr CreateStatement(std::string const &query) override final
                     {
-                        return Service::Make<Detail::Statement, IStatement>(m_connection.get(), this, query);
+                        if (query.empty())
+                            throw std::invalid_argument{"[Mif::Db::SQLite::Connection::CreateStatement] Empty query string."};
+
+                        return Service::Make<Detail::Statement, IStatement>(m_connection.get(), this, m_statements->Get(query));
+                    }
+
+                    virtual IBulkWriterPtr CreateBulkWriter(std::string const &table,
+                            std::vector<std::string> const &columns) override final
+                    {
+                        if (table.empty())
+                            throw std::invalid_argument{"[Mif::Db::SQLite::Connection::CreateBulkWriter] Empty table name."};
+
+                        if (columns.empty())
+                            throw std::invalid_argument{"[Mif::Db::SQLite::Connection::CreateBulkWriter] No columns."};
+
+                        std::string names;
+                        std::string values;
+                        for (std::size_t i = 0 ; i < columns.size() ; ++i)
+                        {
+                            if (i)
+                            {
+                                names += ", ";
+                                values += ", ";
+                            }
+                            names += columns[i];
+                            values += "$" + std::to_string(i + 1);
+                        }
+
+                        auto statement = m_statements->Get("insert into " + table + " (" + names + ") values (" + values + ");");
+
+                        return Service::Make<Detail::BulkWriter, IBulkWriter>(m_connection.get(), this,
+                                std::move(statement), columns.size());
+                    }
+
+                    virtual IRecordsetPtr CreateBulkReader(std::string const &query) override final
+                    {
+                        // SQLite reads the rows one by one anyway.
+                        return CreateStatement(query)->Execute();
                     }
                 };
             }   // namespace
@@ -127,3 +182,11 @@ MIF_SERVICE_CREATOR
     Mif::Db::SQLite::Connection,
     std::string
 )
+
+MIF_SERVICE_CREATOR
+(
+    Mif::Db::Id::Service::SQLite,
+    Mif::Db::SQLite::Connection,
+    std::string,
+    std::size_t
+)
@@ -0,0 +1,127 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "bulk_writer.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace SQLite
+        {
+            namespace Detail
+            {
+
+                BulkWriter::BulkWriter(sqlite3 *connection, Service::IService *holder, PreparedStatementPtr statement,
+                        std::size_t columns)
+                    : m_connection{connection}
+                    , m_holder{holder}
+                    , m_statement{std::move(statement)}
+                    , m_columns{columns}
+                {
+                    if (!m_connection)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::BulkWriter] Empty connection pointer."};
+
+                    if (!m_holder)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::BulkWriter] Empty connection holder pointer."};
+
+                    if (!m_statement)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::BulkWriter] Empty prepared statement pointer."};
+
+                    // The statement is still read by a recordset, so a private one is compiled.
+                    if (!m_statement->TryAcquire())
+                    {
+                        m_statement = std::make_shared<PreparedStatement>(m_connection, m_statement->GetQuery(), false);
+                        m_statement->TryAcquire();
+                    }
+
+                    // Without a transaction every insert is synced to the disk.
+                    if (sqlite3_get_autocommit(m_connection))
+                    {
+                        if (sqlite3_exec(m_connection, "begin;", nullptr, nullptr, nullptr) != SQLITE_OK)
+                        {
+                            m_statement->Release();
+                            throw std::runtime_error{"[Mif::Db::SQLite::Detail::BulkWriter] Failed to begin transaction. "
+                                    "Error: " + std::string{sqlite3_errmsg(m_connection)}};
+                        }
+
+                        m_transaction = true;
+                    }
+                }
+
+                BulkWriter::~BulkWriter()
+                {
+                    m_statement->Release();
+
+                    if (!m_finished && m_transaction)
+                    {
+                        if (sqlite3_exec(m_connection, "rollback;", nullptr, nullptr, nullptr) != SQLITE_OK)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Db::SQLite::Detail::~BulkWriter] Failed to rollback transaction. "
+                                    << "Error: " << sqlite3_errmsg(m_connection);
+                        }
+                    }
+                }
+
+                void BulkWriter::Write(Parameters const &row)
+                {
+                    if (m_finished)
+                        throw std::logic_error{"[Mif::Db::SQLite::Detail::BulkWriter::Write] The writer is finished."};
+
+                    if (row.size() != m_columns)
+                    {
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::BulkWriter::Write] "
+                                "The row has " + std::to_string(row.size()) + " values instead of " +
+                                std::to_string(m_columns) + "."};
+                    }
+
+                    auto *statement = m_statement->Get();
+
+                    m_statement->Bind(row);
+
+                    auto const res = sqlite3_step(statement);
+                    sqlite3_reset(statement);
+
+                    if (res != SQLITE_DONE)
+                    {
+                        throw std::runtime_error{"[Mif::Db::SQLite::Detail::BulkWriter::Write] "
+                                "Failed to insert row. Error: " + std::string{sqlite3_errmsg(m_connection)}};
+                    }
+
+                    ++m_rows;
+                }
+
+                std::uint64_t BulkWriter::Finish()
+                {
+                    if (m_finished)
+                        throw std::logic_error{"[Mif::Db::SQLite::Detail::BulkWriter::Finish] The writer is finished."};
+
+                    if (m_transaction && sqlite3_exec(m_connection, "commit;", nullptr, nullptr, nullptr) != SQLITE_OK)
+                    {
+                        throw std::runtime_error{"[Mif::Db::SQLite::Detail::BulkWriter::Finish] "
+                                "Failed to commit transaction. Error: " + std::string{sqlite3_errmsg(m_connection)}};
+                    }
+
+                    m_finished = true;
+
+                    return m_rows;
+                }
+
+            }   // namespace Detail
+        }   // namespace SQLite
+    }   // namespace Db
+}   // namespace Mif
@@ -0,0 +1,64 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_SQLITE_DETAIL_BULK_WRITER_H__
+#define __MIF_DB_SQLITE_DETAIL_BULK_WRITER_H__
+
+// STD
+#include <cstddef>
+#include <cstdint>
+
+// SQLITE
+#include <sqlite3.h>
+
+// MIF
+#include "mif/db/ibulk_writer.h"
+#include "mif/service/iservice.h"
+
+// THIS
+#include "statement_cache.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace SQLite
+        {
+            namespace Detail
+            {
+
+                // The rows are inserted by one prepared statement in one transaction. If a transaction
+                // is already open on the connection, the rows become a part of it.
+                class BulkWriter
+                    : public Service::Inherit<IBulkWriter>
+                {
+                public:
+                    BulkWriter(sqlite3 *connection, Service::IService *holder, PreparedStatementPtr statement,
+                            std::size_t columns);
+
+                    virtual ~BulkWriter();
+
+                private:
+                    sqlite3 *m_connection;
+                    Service::IServicePtr m_holder;
+                    PreparedStatementPtr m_statement;
+                    std::size_t m_columns;
+                    bool m_transaction = false;
+                    bool m_finished = false;
+                    std::uint64_t m_rows = 0;
+
+                    // IBulkWriter
+                    virtual void Write(Parameters const &row) override final;
+                    virtual std::uint64_t Finish() override final;
+                };
+
+            }   // namespace Detail
+        }   // namespace SQLite
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_SQLITE_DETAIL_BULK_WRITER_H__
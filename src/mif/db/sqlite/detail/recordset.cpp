@@ -6,6 +6,8 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <cstring>
+#include <iterator>
 #include <stdexcept>
 #include <utility>
 
@@ -142,7 +144,10 @@ namespace Mif
                             "Failed to get " + std::to_string(index) + " field value."};
                     }
 
-                    return reinterpret_cast<std::string::value_type const *>(text);
+                    // The size is taken after the text, because the conversion may change it. Blobs can contain zeros.
+                    auto const size = static_cast<std::size_t>(sqlite3_column_bytes(m_statement.get(), index));
+
+                    return {reinterpret_cast<std::string::value_type const *>(text), size};
                 }
 
                 std::int32_t Recordset::GetAsInt32(std::size_t index) const
@@ -187,6 +192,131 @@ namespace Mif
                         "Failed to get " + std::to_string(index) + " field value. Error: " + std::string{e.what()}};
                 }
 
+                Common::Buffer Recordset::GetAsBuffer(std::size_t index) const
+                {
+                    if (IsNull(index))
+                    {
+                        throw std::logic_error{"[Mif::Db::SQLite::Detail::Recordset::GetAsBuffer] "
+                            "Failed to get " + std::to_string(index) + " field value from null."};
+                    }
+
+                    auto const *data = reinterpret_cast<char const *>(sqlite3_column_blob(m_statement.get(), index));
+                    auto const size = static_cast<std::size_t>(sqlite3_column_bytes(m_statement.get(), index));
+
+                    // An empty blob has no data.
+                    if (!data)
+                        return {};
+
+                    return {data, data + size};
+                }
+
+                StringView Recordset::Store(char const *data, std::size_t size)
+                {
+                    if (!size)
+                        return {"", 0};
+
+                    if (size > ChunkSize / 4)
+                    {
+                        // The large values get their own chunks, which are put before the current one.
+                        std::unique_ptr<char []> chunk{new char [size]};
+                        std::memcpy(chunk.get(), data, size);
+                        auto const *buffer = chunk.get();
+                        m_chunks.insert(m_chunks.empty() ? std::end(m_chunks) : std::prev(std::end(m_chunks)), std::move(chunk));
+                        return {buffer, size};
+                    }
+
+                    if (m_chunkFree < size)
+                    {
+                        m_chunks.emplace_back(new char [ChunkSize]);
+                        m_chunkFree = ChunkSize;
+                    }
+
+                    auto *buffer = m_chunks.back().get() + (ChunkSize - m_chunkFree);
+                    std::memcpy(buffer, data, size);
+                    m_chunkFree -= size;
+
+                    return {buffer, size};
+                }
+
+                std::size_t Recordset::Fetch(Columns &columns, std::size_t maxRows)
+                try
+                {
+                    for (auto const &column : columns.Get())
+                        CheckIndex(column.field);
+
+                    Columns::Rollback rollback{columns};
+
+                    std::size_t count = 0;
+
+                    // The rows are read one by one, because SQLite has only the current row.
+                    while (count < maxRows && Read())
+                    {
+                        for (auto const &column : columns.Get())
+                        {
+                            auto const index = static_cast<int>(column.field);
+                            auto const isNull = sqlite3_column_type(m_statement.get(), index) == SQLITE_NULL;
+
+                            if (column.nulls)
+                            {
+                                column.nulls->push_back(isNull);
+                            }
+                            else if (isNull)
+                            {
+                                throw std::logic_error{"Failed to get " + std::to_string(column.field) +
+                                        " field value from null."};
+                            }
+
+                            switch (column.type)
+                            {
+                            case Columns::Type::Int32 :
+                                static_cast<std::vector<std::int32_t> *>(column.values)->push_back(
+                                        isNull ? 0 : static_cast<std::int32_t>(sqlite3_column_int(m_statement.get(), index)));
+                                break;
+                            case Columns::Type::Int64 :
+                                static_cast<std::vector<std::int64_t> *>(column.values)->push_back(
+                                        isNull ? 0 : static_cast<std::int64_t>(sqlite3_column_int64(m_statement.get(), index)));
+                                break;
+                            case Columns::Type::Double :
+                                static_cast<std::vector<double> *>(column.values)->push_back(
+                                        isNull ? 0 : sqlite3_column_double(m_statement.get(), index));
+                                break;
+                            case Columns::Type::String :
+                            case Columns::Type::StringView :
+                                {
+                                    auto const *text = isNull ? nullptr : sqlite3_column_text(m_statement.get(), index);
+                                    auto const size = isNull ? 0 : static_cast<std::size_t>(sqlite3_column_bytes(m_statement.get(), index));
+                                    auto const *data = reinterpret_cast<char const *>(text);
+                                    if (column.type == Columns::Type::String)
+                                    {
+                                        auto &values = *static_cast<std::vector<std::string> *>(column.values);
+                                        if (data)
+                                            values.emplace_back(data, size);
+                                        else
+                                            values.emplace_back();
+                                    }
+                                    else
+                                    {
+                                        static_cast<std::vector<StringView> *>(column.values)->push_back(
+                                                data ? Store(data, size) : StringView{nullptr, 0});
+                                    }
+                                }
+                                break;
+                            }
+                        }
+
+                        ++count;
+                    }
+
+                    rollback.Release();
+
+                    return count;
+                }
+                catch (std::exception const &e)
+                {
+                    throw std::runtime_error{"[Mif::Db::SQLite::Detail::Recordset::Fetch] "
+                        "Failed to fetch rows. Error: " + std::string{e.what()}};
+                }
+
             }   // namespace Detail
         }   // namespace SQLite
     }   // namespace Db
@@ -15,6 +15,7 @@
 #include <map>
 #include <memory>
 #include <string>
+#include <vector>
 
 // SQLITE
 #include <sqlite3.h>
@@ -48,7 +49,14 @@ namespace Mif
                     std::map<std::size_t, std::string> m_fieldsNames;
                     std::map<std::string, std::size_t> m_fieldsIndexes;
 
+                    // SQLite drops the text of the current row on the next step, so the fetched
+                    // strings are copied into large chunks which live as long as the recordset.
+                    static constexpr std::size_t ChunkSize = 64 * 1024;
+                    std::vector<std::unique_ptr<char []>> m_chunks;
+                    std::size_t m_chunkFree = 0;
+
                     void CheckIndex(std::size_t index) const;
+                    StringView Store(char const *data, std::size_t size);
 
                     // IRecordset
                     virtual bool Read() override final;
@@ -60,6 +68,8 @@ namespace Mif
                     virtual std::int32_t GetAsInt32(std::size_t index) const override final;
                     virtual std::int64_t GetAsInt64(std::size_t index) const override final;
                     virtual double GetAsDouble(std::size_t index) const override final;
+                    virtual Common::Buffer GetAsBuffer(std::size_t index) const override final;
+                    virtual std::size_t Fetch(Columns &columns, std::size_t maxRows) override final;
                 };
 
             }   // namespace Detail
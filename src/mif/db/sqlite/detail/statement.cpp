@@ -6,12 +6,16 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <cstdint>
 #include <functional>
+#include <memory>
 #include <stdexcept>
+#include <string>
 #include <utility>
+#include <vector>
 
 // MIF
-#include "mif/common/log.h"
+#include "mif/common/unused.h"
 #include "mif/service/make.h"
 
 // THIS
@@ -28,10 +32,10 @@ namespace Mif
             {
 
                 Statement::Statement(sqlite3 *connection, Service::IService *holder,
-                        std::string const &query)
+                        PreparedStatementPtr statement)
                     : m_connection{connection}
                     , m_holder{holder}
-                    , m_query{query}
+                    , m_statement{std::move(statement)}
                 {
                     if (!m_connection)
                         throw std::invalid_argument{"[Mif::Db::SQLite::Detail::Statement] Empty connection pointer."};
@@ -39,77 +43,83 @@ namespace Mif
                     if (!m_holder)
                         throw std::invalid_argument{"[Mif::Db::SQLite::Detail::Statement] Empty connection holder pointer."};
 
-                    if (m_query.empty())
-                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::Statement] Empty query."};
-
-                    /*if (PQresultStatus(result.get()) != PGRES_COMMAND_OK)
-                    {
-                        auto const *message = PQresultErrorMessage(result.get());
+                    if (!m_statement)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::Statement] Empty prepared statement pointer."};
+                }
 
-                        throw std::runtime_error{"[Mif::Db::SQLite::Detail::Statement] "
-                                "Failed to create prepared statement for query \"" + m_query + "\". "
-                                "Erro: " + std::string{message ? message : "unknown"}};
-                    }*/
+                IRecordsetPtr Statement::Execute(Parameters const &parameters, ExecuteOptions const &options)
+                {
+                    // SQLite keeps typed values and always reads the rows one by one.
+                    Common::Unused(options);
+                    return Execute(parameters);
                 }
 
                 IRecordsetPtr Statement::Execute(Parameters const &parameters)
                 {
-                    sqlite3_stmt *stmt = nullptr;
-                    auto const res = sqlite3_prepare_v2(m_connection, m_query.c_str(), m_query.length() + 1, &stmt, nullptr);
+                    auto prepared = Acquire();
 
                     using StatementPtr = std::unique_ptr<sqlite3_stmt, std::function<void (sqlite3_stmt *)>>;
-                    auto const needToCleanBindings = !parameters.empty();
-                    StatementPtr statement{stmt, [needToCleanBindings] (sqlite3_stmt *s)
+                    StatementPtr statement{prepared->Get(), [prepared] (sqlite3_stmt *)
                             {
-                                if (!s)
-                                    return;
-
-                                if (needToCleanBindings && sqlite3_clear_bindings(s) != SQLITE_OK)
-                                {
-                                    MIF_LOG(Warning) << "[Mif::Db::SQLite::Detail::Statement::Execute] "
-                                                     << "Failed to clean binded parameters in the statement.";
-                                }
-
-                                if (sqlite3_finalize(s) != SQLITE_OK)
-                                {
-                                    MIF_LOG(Warning) << "[Mif::Db::SQLite::Detail::Statement::Execute] "
-                                                     << "Failed to close statement.";
-                                }
+                                prepared->Release();
                             }
                         };
 
-                    if (res != SQLITE_OK)
-                    {
-                        throw std::runtime_error{"[Mif::Db::SQLite::Detail::Statement::Execute] "
-                                "Failed to create prepared statement for query \"" + m_query + "\""};
-                    }
+                    prepared->Bind(parameters);
 
-                    int index = 1;
-                    for (auto const &prm : parameters)
-                    {
-                        if (prm.empty())
-                        {
-                            if (sqlite3_bind_null(statement.get(), index) != SQLITE_OK)
+                    return Service::Make<Recordset, IRecordset>(this, std::move(statement));
+                }
+
+                std::uint64_t Statement::ExecuteBatch(std::vector<Parameters> const &batch)
+                {
+                    auto prepared = Acquire();
+
+                    using StatementPtr = std::unique_ptr<sqlite3_stmt, std::function<void (sqlite3_stmt *)>>;
+                    StatementPtr statement{prepared->Get(), [prepared] (sqlite3_stmt *)
                             {
-                                throw std::runtime_error{"[Mif::Db::SQLite::Detail::Statement::Execute] "
-                                        "Failed to bind null parameter with index " + std::to_string(index) +
-                                        " to statement for query \"" + m_query + "\""};
+                                prepared->Release();
                             }
-                        }
-                        else
+                        };
+
+                    // There is no network round trip to save, so the only work left is to step
+                    // the same compiled statement without creating the recordsets.
+                    std::uint64_t rows = 0;
+
+                    for (auto const &parameters : batch)
+                    {
+                        prepared->Bind(parameters);
+
+                        auto res = SQLITE_ROW;
+                        while (res == SQLITE_ROW)
+                            res = sqlite3_step(statement.get());
+
+                        if (res != SQLITE_DONE)
                         {
-                            if (sqlite3_bind_text(statement.get(), index, prm.c_str(), -1, SQLITE_TRANSIENT) != SQLITE_OK)
-                            {
-                                throw std::runtime_error{"[Mif::Db::SQLite::Detail::Statement::Execute] "
-                                        "Failed to bind \"" + prm + "\" parameter with index " + std::to_string(index) +
-                                        " to statement for query \"" + m_query + "\""};
-                            }
+                            throw std::runtime_error{"[Mif::Db::SQLite::Detail::Statement::ExecuteBatch] "
+                                    "Failed to execute statement. Error: " + std::string{sqlite3_errmsg(m_connection)}};
                         }
 
-                        ++index;
+                        rows += static_cast<std::uint64_t>(sqlite3_changes(m_connection));
+
+                        sqlite3_reset(statement.get());
                     }
 
-                    return Service::Make<Recordset, IRecordset>(this, std::move(statement));
+                    return rows;
+                }
+
+                PreparedStatementPtr Statement::Acquire()
+                {
+                    auto prepared = m_statement;
+
+                    // The prepared statement is still read by another recordset. A private one is compiled
+                    // for this execution, because SQLite can not step one statement for two recordsets.
+                    if (!prepared->TryAcquire())
+                    {
+                        prepared = std::make_shared<PreparedStatement>(m_connection, m_statement->GetQuery(), false);
+                        prepared->TryAcquire();
+                    }
+
+                    return prepared;
                 }
 
             }   // namespace Detail
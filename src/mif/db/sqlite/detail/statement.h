@@ -9,8 +9,10 @@
 #define __MIF_DB_SQLITE_DETAIL_STATEMENT_H__
 
 // STD
+#include <cstdint>
 #include <memory>
 #include <string>
+#include <vector>
 
 // SQLITE
 #include <sqlite3.h>
@@ -19,6 +21,9 @@
 #include "mif/db/istatement.h"
 #include "mif/service/iservice.h"
 
+// THIS
+#include "statement_cache.h"
+
 namespace Mif
 {
     namespace Db
@@ -32,16 +37,20 @@ namespace Mif
                     : public Service::Inherit<IStatement>
                 {
                 public:
-                    Statement(sqlite3 *connection, Service::IService *holder, std::string const &query);
+                    Statement(sqlite3 *connection, Service::IService *holder, PreparedStatementPtr statement);
 
                 private:
                     sqlite3 *m_connection;
                     Service::IServicePtr m_holder;
 
-                    std::string m_query;
+                    PreparedStatementPtr m_statement;
 
                     // IStatement
                     virtual IRecordsetPtr Execute(Parameters const &parameters) override final;
+                    virtual IRecordsetPtr Execute(Parameters const &parameters, ExecuteOptions const &options) override final;
+                    virtual std::uint64_t ExecuteBatch(std::vector<Parameters> const &batch) override final;
+
+                    PreparedStatementPtr Acquire();
                 };
 
             }   // namespace Detail
@@ -0,0 +1,205 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "statement_cache.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace SQLite
+        {
+            namespace Detail
+            {
+
+                PreparedStatement::PreparedStatement(sqlite3 *connection, std::string const &query, bool persistent)
+                    : m_query{query}
+                {
+                    if (!connection)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::PreparedStatement] Empty connection pointer."};
+
+                    if (m_query.empty())
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::PreparedStatement] Empty query."};
+
+#if SQLITE_VERSION_NUMBER >= 3020000
+                    auto const res = sqlite3_prepare_v3(connection, m_query.c_str(), m_query.length() + 1,
+                            persistent ? SQLITE_PREPARE_PERSISTENT : 0, &m_statement, nullptr);
+#else
+                    (void)persistent;
+                    auto const res = sqlite3_prepare_v2(connection, m_query.c_str(), m_query.length() + 1,
+                            &m_statement, nullptr);
+#endif
+
+                    if (res != SQLITE_OK)
+                    {
+                        if (m_statement)
+                            sqlite3_finalize(m_statement);
+
+                        auto const *message = sqlite3_errmsg(connection);
+
+                        throw std::runtime_error{"[Mif::Db::SQLite::Detail::PreparedStatement] "
+                                "Failed to create prepared statement for query \"" + m_query + "\". "
+                                "Error: " + std::string{message ? message : "unknown"}};
+                    }
+                }
+
+                PreparedStatement::~PreparedStatement()
+                {
+                    if (m_statement && sqlite3_finalize(m_statement) != SQLITE_OK)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Db::SQLite::Detail::PreparedStatement::~PreparedStatement] "
+                                         << "Failed to close statement.";
+                    }
+                }
+
+                std::string const& PreparedStatement::GetQuery() const
+                {
+                    return m_query;
+                }
+
+                bool PreparedStatement::TryAcquire()
+                {
+                    return !m_busy.exchange(true, std::memory_order_acquire);
+                }
+
+                void PreparedStatement::Bind(IStatement::Parameters const &parameters)
+                {
+                    // The copy keeps its memory between executions, so a hot statement does not allocate.
+                    m_parameters = parameters;
+
+                    for (std::size_t i = 0 ; i < m_parameters.size() ; ++i)
+                    {
+                        auto const index = static_cast<int>(i + 1);
+                        auto const prm = m_parameters[i];
+
+                        int res = SQLITE_OK;
+
+                        switch (prm.GetType())
+                        {
+                        case Parameter::Type::Null :
+                            res = sqlite3_bind_null(m_statement, index);
+                            break;
+                        case Parameter::Type::Int32 :
+                            res = sqlite3_bind_int(m_statement, index, prm.GetInt32());
+                            break;
+                        case Parameter::Type::Int64 :
+                            res = sqlite3_bind_int64(m_statement, index, prm.GetInt64());
+                            break;
+                        case Parameter::Type::Double :
+                            res = sqlite3_bind_double(m_statement, index, prm.GetDouble());
+                            break;
+                        case Parameter::Type::Text :
+                            res = sqlite3_bind_text(m_statement, index, prm.GetData(),
+                                    static_cast<int>(prm.GetSize()), SQLITE_STATIC);
+                            break;
+                        case Parameter::Type::Blob :
+                            res = sqlite3_bind_blob(m_statement, index, prm.GetData(),
+                                    static_cast<int>(prm.GetSize()), SQLITE_STATIC);
+                            break;
+                        }
+
+                        if (res != SQLITE_OK)
+                        {
+                            throw std::runtime_error{"[Mif::Db::SQLite::Detail::PreparedStatement::Bind] "
+                                    "Failed to bind parameter with index " + std::to_string(index) +
+                                    " to statement for query \"" + m_query + "\". "
+                                    "Error: " + std::string{sqlite3_errstr(res)}};
+                        }
+                    }
+                }
+
+                sqlite3_stmt* PreparedStatement::Get() const
+                {
+                    return m_statement;
+                }
+
+                void PreparedStatement::Release()
+                {
+                    // The result of sqlite3_reset repeats the error of the last step, so it is not checked.
+                    sqlite3_reset(m_statement);
+
+                    if (sqlite3_clear_bindings(m_statement) != SQLITE_OK)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Db::SQLite::Detail::PreparedStatement::Release] "
+                                         << "Failed to clean binded parameters in the statement.";
+                    }
+
+                    m_busy.store(false, std::memory_order_release);
+                }
+
+                StatementCache::StatementCache(sqlite3 *connection, std::size_t capacity)
+                    : m_connection{connection}
+                    , m_capacity{capacity}
+                {
+                    if (!m_connection)
+                        throw std::invalid_argument{"[Mif::Db::SQLite::Detail::StatementCache] Empty connection pointer."};
+                }
+
+                PreparedStatementPtr StatementCache::Get(std::string const &query)
+                {
+                    if (!m_capacity)
+                    {
+                        ++m_misses;
+                        return std::make_shared<PreparedStatement>(m_connection, query, false);
+                    }
+
+                    {
+                        LockGuard lock{m_lock};
+                        auto const iter = m_index.find(query);
+                        if (iter != std::end(m_index))
+                        {
+                            m_items.splice(std::begin(m_items), m_items, iter->second);
+                            ++m_hits;
+                            return m_items.front();
+                        }
+                    }
+
+                    ++m_misses;
+
+                    // The query is compiled out of the lock. If another thread has put the same query
+                    // in the meantime, its statement is returned.
+                    auto statement = std::make_shared<PreparedStatement>(m_connection, query, true);
+
+                    LockGuard lock{m_lock};
+                    auto const iter = m_index.find(query);
+                    if (iter != std::end(m_index))
+                    {
+                        m_items.splice(std::begin(m_items), m_items, iter->second);
+                        return m_items.front();
+                    }
+
+                    m_items.push_front(statement);
+                    m_index.emplace(query, std::begin(m_items));
+
+                    // The evicted statements are finalized when the last statement object using them is released.
+                    while (m_items.size() > m_capacity)
+                    {
+                        m_index.erase(m_items.back()->GetQuery());
+                        m_items.pop_back();
+                    }
+
+                    return statement;
+                }
+
+                StatementCache::Counters StatementCache::GetCounters() const
+                {
+                    return {m_hits, m_misses};
+                }
+
+            }   // namespace Detail
+        }   // namespace SQLite
+    }   // namespace Db
+}   // namespace Mif
@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_DB_SQLITE_DETAIL_STATEMENT_CACHE_H__
+#define __MIF_DB_SQLITE_DETAIL_STATEMENT_CACHE_H__
+
+// STD
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+// SQLITE
+#include <sqlite3.h>
+
+// MIF
+#include "mif/db/istatement.h"
+
+namespace Mif
+{
+    namespace Db
+    {
+        namespace SQLite
+        {
+            namespace Detail
+            {
+
+                // Compiled statement which is reset and rebound for every execution.
+                // Only one recordset can read it at a time.
+                class PreparedStatement final
+                {
+                public:
+                    PreparedStatement(sqlite3 *connection, std::string const &query, bool persistent);
+                    ~PreparedStatement();
+
+                    PreparedStatement(PreparedStatement const &) = delete;
+                    PreparedStatement(PreparedStatement &&) = delete;
+                    PreparedStatement& operator = (PreparedStatement const &) = delete;
+                    PreparedStatement& operator = (PreparedStatement &&) = delete;
+
+                    std::string const& GetQuery() const;
+
+                    bool TryAcquire();
+                    void Bind(IStatement::Parameters const &parameters);
+                    sqlite3_stmt* Get() const;
+                    void Release();
+
+                private:
+                    std::string const m_query;
+                    sqlite3_stmt *m_statement = nullptr;
+                    std::atomic<bool> m_busy{false};
+                    // The bound values are not copied by SQLite and must live until the statement is reset.
+                    IStatement::Parameters m_parameters;
+                };
+
+                using PreparedStatementPtr = std::shared_ptr<PreparedStatement>;
+
+                // LRU cache of the prepared statements of one connection keyed by query text.
+                class StatementCache final
+                {
+                public:
+                    struct Counters
+                    {
+                        std::uint64_t hits;
+                        std::uint64_t misses;
+                    };
+
+                    StatementCache(sqlite3 *connection, std::size_t capacity);
+
+                    StatementCache(StatementCache const &) = delete;
+                    StatementCache(StatementCache &&) = delete;
+                    StatementCache& operator = (StatementCache const &) = delete;
+                    StatementCache& operator = (StatementCache &&) = delete;
+
+                    PreparedStatementPtr Get(std::string const &query);
+
+                    Counters GetCounters() const;
+
+                private:
+                    using LockType = std::mutex;
+                    using LockGuard = std::lock_guard<LockType>;
+
+                    using Items = std::list<PreparedStatementPtr>;
+
+                    sqlite3 *m_connection;
+                    std::size_t const m_capacity;
+
+                    LockType m_lock;
+                    Items m_items;
+                    std::unordered_map<std::string/*query*/, Items::iterator> m_index;
+
+                    std::atomic<std::uint64_t> m_hits{0};
+                    std::atomic<std::uint64_t> m_misses{0};
+                };
+
+            }   // namespace Detail
+        }   // namespace SQLite
+    }   // namespace Db
+}   // namespace Mif
+
+#endif  // !__MIF_DB_SQLITE_DETAIL_STATEMENT_CACHE_H__
@@ -70,6 +70,19 @@ namespace Mif
             return false;
         }
 
+        bool Client::Post(Common::Buffer header, Common::Buffer payload)
+        {
+            if (m_makredAsClosed)
+                return false;
+
+            if (auto publisher = m_publisher.lock())
+            {
+                publisher->Publish(std::move(header), std::move(payload));
+                return true;
+            }
+            return false;
+        }
+
         bool Client::IsClosed() const
         {
             return m_makredAsClosed;
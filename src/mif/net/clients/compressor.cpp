@@ -0,0 +1,81 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// MIF
+#include "mif/net/clients/compressor.h"
+
+// THIS
+#include "detail/zlib_stream.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+
+            class Compressor::Impl final
+            {
+            public:
+                Impl(Codec codec, int level, std::size_t threshold)
+                    : m_codec{codec}
+                    , m_level{level}
+                    , m_threshold{threshold}
+                {
+                    if (m_codec != Codec::None && m_codec != Codec::Deflate)
+                        throw std::invalid_argument{"[Mif::Net::Clients::Compressor::Impl] Unsupported codec."};
+                }
+
+                Common::Buffer Process(Common::Buffer buffer)
+                {
+                    if (m_codec == Codec::Deflate && buffer.size() >= m_threshold)
+                    {
+                        Common::Buffer result;
+                        result.push_back(static_cast<char>(Codec::Deflate));
+                        auto stream = m_streams.Get(Detail::ZLibFormat::Deflate, m_level);
+                        stream->Compress(buffer.data(), buffer.size(), result);
+                        m_streams.Put(std::move(stream));
+                        if (result.size() < buffer.size() + 1)
+                            return result;
+                    }
+
+                    buffer.insert(std::begin(buffer), static_cast<char>(Codec::None));
+                    return buffer;
+                }
+
+            private:
+                Codec const m_codec;
+                int const m_level;
+                std::size_t const m_threshold;
+
+                Detail::StreamPool<Detail::Deflater> m_streams;
+            };
+
+            Compressor::Compressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher,
+                    Codec codec, int level, std::size_t threshold)
+                : Client(control, publisher)
+                , m_impl{new Impl{codec, level, threshold}}
+            {
+            }
+
+            Compressor::~Compressor()
+            {
+            }
+
+            void Compressor::ProcessData(Common::Buffer buffer)
+            {
+                Post(m_impl->Process(std::move(buffer)));
+            }
+
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
@@ -0,0 +1,77 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <iterator>
+#include <stdexcept>
+#include <string>
+#include <utility>
+
+// MIF
+#include "mif/net/clients/codec.h"
+#include "mif/net/clients/decompressor.h"
+
+// THIS
+#include "detail/zlib_stream.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+
+            class Decompressor::Impl final
+            {
+            public:
+                Common::Buffer Process(Common::Buffer buffer)
+                {
+                    if (buffer.empty())
+                        throw std::invalid_argument{"[Mif::Net::Clients::Decompressor::Impl::Process] No codec id."};
+
+                    auto const codec = static_cast<Codec>(buffer.front());
+                    switch (codec)
+                    {
+                    case Codec::None :
+                        buffer.erase(std::begin(buffer));
+                        return buffer;
+                    case Codec::Deflate :
+                        {
+                            Common::Buffer result;
+                            auto stream = m_streams.Get(Detail::ZLibFormat::Deflate);
+                            stream->Decompress(buffer.data() + 1, buffer.size() - 1, result);
+                            m_streams.Put(std::move(stream));
+                            return result;
+                        }
+                    }
+
+                    throw std::runtime_error{"[Mif::Net::Clients::Decompressor::Impl::Process] Unsupported codec "
+                        "\"" + std::to_string(static_cast<unsigned>(codec)) + "\"."};
+                }
+
+            private:
+                Detail::StreamPool<Detail::Inflater> m_streams;
+            };
+
+            Decompressor::Decompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher)
+                : Client(control, publisher)
+                , m_impl{new Impl}
+            {
+            }
+
+            Decompressor::~Decompressor()
+            {
+            }
+
+            void Decompressor::ProcessData(Common::Buffer buffer)
+            {
+                Post(m_impl->Process(std::move(buffer)));
+            }
+
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
@@ -0,0 +1,155 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstring>
+#include <stdexcept>
+#include <string>
+
+// THIS
+#include "zlib_stream.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+            namespace Detail
+            {
+
+                namespace
+                {
+
+                    int GetWindowBits(ZLibFormat format)
+                    {
+                        switch (format)
+                        {
+                        case ZLibFormat::Deflate :
+                            return MAX_WBITS;
+                        case ZLibFormat::GZip :
+                            return MAX_WBITS + 16;
+                        case ZLibFormat::Auto :
+                            return MAX_WBITS + 32;
+                        }
+                        throw std::invalid_argument{"[Mif::Net::Clients::Detail::GetWindowBits] Unknown format."};
+                    }
+
+                }   // namespace
+
+                Deflater::Deflater(ZLibFormat format, int level)
+                {
+                    if (format == ZLibFormat::Auto)
+                        throw std::invalid_argument{"[Mif::Net::Clients::Detail::Deflater] Format must be defined for compression."};
+
+                    std::memset(&m_stream, 0, sizeof(m_stream));
+                    auto const res = deflateInit2(&m_stream, level, Z_DEFLATED, GetWindowBits(format), 8, Z_DEFAULT_STRATEGY);
+                    if (res != Z_OK)
+                    {
+                        throw std::runtime_error{"[Mif::Net::Clients::Detail::Deflater] Failed to init zlib stream. "
+                            "Error: " + std::to_string(res)};
+                    }
+                }
+
+                Deflater::~Deflater()
+                {
+                    deflateEnd(&m_stream);
+                }
+
+                void Deflater::Compress(char const *data, std::size_t size, Common::Buffer &result)
+                {
+                    auto res = deflateReset(&m_stream);
+                    if (res != Z_OK)
+                    {
+                        throw std::runtime_error{"[Mif::Net::Clients::Detail::Deflater::Compress] Failed to reset zlib stream. "
+                            "Error: " + std::to_string(res)};
+                    }
+
+                    auto const offset = result.size();
+                    result.resize(offset + deflateBound(&m_stream, static_cast<uLong>(size)));
+
+                    m_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+                    m_stream.avail_in = static_cast<uInt>(size);
+                    m_stream.next_out = reinterpret_cast<Bytef *>(&result[offset]);
+                    m_stream.avail_out = static_cast<uInt>(result.size() - offset);
+
+                    res = deflate(&m_stream, Z_FINISH);
+                    if (res != Z_STREAM_END)
+                    {
+                        result.resize(offset);
+                        throw std::runtime_error{"[Mif::Net::Clients::Detail::Deflater::Compress] Failed to compress data. "
+                            "Error: " + std::to_string(res)};
+                    }
+
+                    result.resize(offset + m_stream.total_out);
+                }
+
+                Inflater::Inflater(ZLibFormat format)
+                {
+                    std::memset(&m_stream, 0, sizeof(m_stream));
+                    auto const res = inflateInit2(&m_stream, GetWindowBits(format));
+                    if (res != Z_OK)
+                    {
+                        throw std::runtime_error{"[Mif::Net::Clients::Detail::Inflater] Failed to init zlib stream. "
+                            "Error: " + std::to_string(res)};
+                    }
+                }
+
+                Inflater::~Inflater()
+                {
+                    inflateEnd(&m_stream);
+                }
+
+                void Inflater::Decompress(char const *data, std::size_t size, Common::Buffer &result)
+                {
+                    auto res = inflateReset(&m_stream);
+                    if (res != Z_OK)
+                    {
+                        throw std::runtime_error{"[Mif::Net::Clients::Detail::Inflater::Decompress] Failed to reset zlib stream. "
+                            "Error: " + std::to_string(res)};
+                    }
+
+                    auto const offset = result.size();
+                    result.resize(offset + (size < 1024 ? 4096 : size * 4));
+
+                    m_stream.next_in = reinterpret_cast<Bytef *>(const_cast<char *>(data));
+                    m_stream.avail_in = static_cast<uInt>(size);
+
+                    for ( ; ; )
+                    {
+                        auto const produced = offset + m_stream.total_out;
+                        m_stream.next_out = reinterpret_cast<Bytef *>(&result[produced]);
+                        m_stream.avail_out = static_cast<uInt>(result.size() - produced);
+
+                        res = inflate(&m_stream, Z_NO_FLUSH);
+                        if (res == Z_STREAM_END)
+                            break;
+
+                        if (res != Z_OK && res != Z_BUF_ERROR)
+                        {
+                            result.resize(offset);
+                            throw std::runtime_error{"[Mif::Net::Clients::Detail::Inflater::Decompress] Failed to decompress data. "
+                                "Error: " + std::to_string(res)};
+                        }
+
+                        if (m_stream.avail_out)
+                        {
+                            result.resize(offset);
+                            throw std::runtime_error{"[Mif::Net::Clients::Detail::Inflater::Decompress] Failed to decompress data. "
+                                "Error: unexpected end of data."};
+                        }
+
+                        result.resize(result.size() * 2);
+                    }
+
+                    result.resize(offset + m_stream.total_out);
+                }
+
+            }   // namespace Detail
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
@@ -0,0 +1,116 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_CLIENTS_DETAIL_ZLIB_STREAM_H__
+#define __MIF_NET_CLIENTS_DETAIL_ZLIB_STREAM_H__
+
+// STD
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+// ZLIB
+#include <zlib.h>
+
+// MIF
+#include "mif/common/types.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Clients
+        {
+            namespace Detail
+            {
+
+                enum class ZLibFormat
+                {
+                    Deflate,
+                    GZip,
+                    // Only for decompression. Detects zlib or gzip header.
+                    Auto
+                };
+
+                // zlib stream state is allocated once and reset for every message.
+                class Deflater final
+                {
+                public:
+                    Deflater(ZLibFormat format, int level);
+                    ~Deflater();
+
+                    Deflater(Deflater const &) = delete;
+                    Deflater& operator = (Deflater const &) = delete;
+
+                    // Appends compressed data to the result.
+                    void Compress(char const *data, std::size_t size, Common::Buffer &result);
+
+                private:
+                    z_stream m_stream;
+                };
+
+                class Inflater final
+                {
+                public:
+                    Inflater(ZLibFormat format);
+                    ~Inflater();
+
+                    Inflater(Inflater const &) = delete;
+                    Inflater& operator = (Inflater const &) = delete;
+
+                    // Appends decompressed data to the result.
+                    void Decompress(char const *data, std::size_t size, Common::Buffer &result);
+
+                private:
+                    z_stream m_stream;
+                };
+
+                // Clients are called from several worker threads, so every thread
+                // takes its own stream and gives it back for reuse.
+                template <typename T>
+                class StreamPool final
+                {
+                public:
+                    using Ptr = std::unique_ptr<T>;
+
+                    template <typename ... TArgs>
+                    Ptr Get(TArgs && ... args)
+                    {
+                        {
+                            LockGuard lock{m_lock};
+                            if (!m_streams.empty())
+                            {
+                                auto stream = std::move(m_streams.back());
+                                m_streams.pop_back();
+                                return stream;
+                            }
+                        }
+                        return Ptr{new T{std::forward<TArgs>(args) ... }};
+                    }
+
+                    void Put(Ptr stream)
+                    {
+                        LockGuard lock{m_lock};
+                        m_streams.push_back(std::move(stream));
+                    }
+
+                private:
+                    using LockType = std::mutex;
+                    using LockGuard = std::lock_guard<LockType>;
+
+                    LockType m_lock;
+                    std::vector<Ptr> m_streams;
+                };
+
+            }   // namespace Detail
+        }   // namespace Clients
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_CLIENTS_DETAIL_ZLIB_STREAM_H__
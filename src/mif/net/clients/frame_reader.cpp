@@ -7,7 +7,11 @@
 
 // STD
 #include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
 #include <iterator>
+#include <stdexcept>
 #include <utility>
 
 // BOOST
@@ -28,37 +32,69 @@ namespace Mif
             public:
                 void OnData(Common::Buffer buffer, FrameReader &owner)
                 {
-                    if (!m_buffer.size())
-                        m_buffer.swap(buffer);
-                    else
-                        m_buffer.insert(std::end(m_buffer), std::begin(buffer), std::end(buffer));
-                    std::int32_t frameBytes = 0;
-                    if (m_buffer.size() < sizeof(frameBytes))
-                        return;
-                    frameBytes = *reinterpret_cast<decltype(frameBytes) const *>(m_buffer.data());
-                    boost::endian::big_to_native_inplace(frameBytes);
-                    if (m_buffer.size() < frameBytes + sizeof(frameBytes))
-                        return;
-                    Common::Buffer{}.swap(buffer);
-                    auto begin = std::begin(m_buffer);
-                    std::advance(begin, sizeof(frameBytes));
-                    auto end = begin;
-                    std::advance(end, frameBytes);
-                    buffer.assign(begin, end);
-                    if (end == std::end(m_buffer))
+                    // A buffer which holds a whole frame only becomes the frame, no other memory is taken.
+                    if (!m_headerBytes && IsSingleFrame(buffer))
                     {
-                        Common::Buffer{}.swap(m_buffer);
+                        buffer.erase(std::begin(buffer), std::next(std::begin(buffer), FrameHeaderSize));
+                        owner.Post(std::move(buffer));
+                        return;
                     }
-                    else
+
+                    // Every frame is made once with its final size and filled right from the incoming data.
+                    for (std::size_t offset = 0 ; offset < buffer.size() ; )
                     {
-                        Common::Buffer newBuffer{end, std::end(m_buffer)};
-                        m_buffer.swap(newBuffer);
+                        auto const *data = buffer.data() + offset;
+                        auto const available = buffer.size() - offset;
+
+                        if (m_headerBytes < FrameHeaderSize)
+                        {
+                            auto const bytes = std::min(FrameHeaderSize - m_headerBytes, available);
+                            std::memcpy(m_header + m_headerBytes, data, bytes);
+                            m_headerBytes += bytes;
+                            offset += bytes;
+                            if (m_headerBytes == FrameHeaderSize)
+                                m_frame.reserve(GetFrameSize(m_header));
+                        }
+                        else
+                        {
+                            auto const bytes = std::min(GetFrameSize(m_header) - m_frame.size(), available);
+                            m_frame.insert(std::end(m_frame), data, data + bytes);
+                            offset += bytes;
+                        }
+
+                        if (m_headerBytes == FrameHeaderSize && m_frame.size() == GetFrameSize(m_header))
+                        {
+                            Common::Buffer frame;
+                            frame.swap(m_frame);
+                            m_headerBytes = 0;
+                            owner.Post(std::move(frame));
+                        }
                     }
-                    owner.Post(std::move(buffer));
                 }
 
             private:
-                Common::Buffer m_buffer;
+                using FrameSize = std::int32_t;
+                static constexpr std::size_t FrameHeaderSize = sizeof(FrameSize);
+
+                char m_header[FrameHeaderSize];
+                std::size_t m_headerBytes = 0;
+                Common::Buffer m_frame;
+
+                static std::size_t GetFrameSize(char const *header)
+                {
+                    FrameSize frameBytes = 0;
+                    std::memcpy(&frameBytes, header, FrameHeaderSize);
+                    boost::endian::big_to_native_inplace(frameBytes);
+                    if (frameBytes < 0)
+                        throw std::runtime_error{"[Mif::Net::Clients::FrameReader::Impl] Bad frame size."};
+                    return static_cast<std::size_t>(frameBytes);
+                }
+
+                static bool IsSingleFrame(Common::Buffer const &buffer)
+                {
+                    return buffer.size() >= FrameHeaderSize &&
+                            buffer.size() == FrameHeaderSize + GetFrameSize(buffer.data());
+                }
             };
 
             FrameReader::FrameReader(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher)
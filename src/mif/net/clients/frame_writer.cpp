@@ -6,8 +6,8 @@
 //-------------------------------------------------------------------
 
 // STD
-#include <algorithm>
-#include <iterator>
+#include <cstdint>
+#include <cstring>
 #include <utility>
 
 // BOOST
@@ -32,13 +32,11 @@ namespace Mif
             {
                 auto frameBytes = static_cast<std::int32_t>(buffer.size());
                 boost::endian::native_to_big_inplace(frameBytes);
-                Common::Buffer frame;
-                frame.reserve(buffer.size() + sizeof(frameBytes));
-                std::copy(reinterpret_cast<char const *>(&frameBytes),
-                    reinterpret_cast<char const *>(&frameBytes) + sizeof(frameBytes),
-                    std::back_inserter(frame));
-                frame.insert(std::end(frame), std::begin(buffer), std::end(buffer));
-                Post(std::move(frame));
+                Common::Buffer header(sizeof(frameBytes));
+                std::memcpy(header.data(), &frameBytes, sizeof(frameBytes));
+                // The payload is not moved to make a room for the header. The tcp session
+                // writes both buffers by one gather write, the other publishers join them.
+                Post(std::move(header), std::move(buffer));
             }
 
         }   // namespace Clients
@@ -8,17 +8,12 @@
 // STD
 #include <utility>
 
-// BOOST
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/device/back_inserter.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/stream.hpp>
-
 // MIF
 #include "mif/net/clients/gzip_compressor.h"
 
+// THIS
+#include "detail/zlib_stream.h"
+
 namespace Mif
 {
     namespace Net
@@ -26,28 +21,35 @@ namespace Mif
         namespace Clients
         {
 
+            class GZipCompressor::Impl final
+            {
+            public:
+                Common::Buffer Process(Common::Buffer const &buffer)
+                {
+                    Common::Buffer result;
+                    auto stream = m_streams.Get(Detail::ZLibFormat::GZip, Z_DEFAULT_COMPRESSION);
+                    stream->Compress(buffer.data(), buffer.size(), result);
+                    m_streams.Put(std::move(stream));
+                    return result;
+                }
+
+            private:
+                Detail::StreamPool<Detail::Deflater> m_streams;
+            };
+
             GZipCompressor::GZipCompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher)
                 : Client(control, publisher)
+                , m_impl{new Impl}
             {
             }
 
-            void GZipCompressor::ProcessData(Common::Buffer buffer)
+            GZipCompressor::~GZipCompressor()
             {
-                Common::Buffer result;
-
-                {
-                    using SourceType = boost::iostreams::basic_array_source<char>;
-                    SourceType source{buffer.data(), buffer.size()};
-                    boost::iostreams::stream<SourceType> iStream{source};
-
-                    boost::iostreams::filtering_ostream oStream;
-                    oStream.push(boost::iostreams::gzip_compressor{});
-                    oStream.push(boost::iostreams::back_inserter(result));
-
-                    boost::iostreams::copy(iStream, oStream);
-                }
+            }
 
-                Post(std::move(result));
+            void GZipCompressor::ProcessData(Common::Buffer buffer)
+            {
+                Post(m_impl->Process(buffer));
             }
 
         }   // namespace Clients
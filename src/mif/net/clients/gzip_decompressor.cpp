@@ -8,17 +8,12 @@
 // STD
 #include <utility>
 
-// BOOST
-#include <boost/iostreams/copy.hpp>
-#include <boost/iostreams/device/back_inserter.hpp>
-#include <boost/iostreams/device/array.hpp>
-#include <boost/iostreams/filter/gzip.hpp>
-#include <boost/iostreams/filtering_stream.hpp>
-#include <boost/iostreams/stream.hpp>
-
 // MIF
 #include "mif/net/clients/gzip_decompressor.h"
 
+// THIS
+#include "detail/zlib_stream.h"
+
 namespace Mif
 {
     namespace Net
@@ -26,28 +21,35 @@ namespace Mif
         namespace Clients
         {
 
+            class GZipDecompressor::Impl final
+            {
+            public:
+                Common::Buffer Process(Common::Buffer const &buffer)
+                {
+                    Common::Buffer result;
+                    auto stream = m_streams.Get(Detail::ZLibFormat::Auto);
+                    stream->Decompress(buffer.data(), buffer.size(), result);
+                    m_streams.Put(std::move(stream));
+                    return result;
+                }
+
+            private:
+                Detail::StreamPool<Detail::Inflater> m_streams;
+            };
+
             GZipDecompressor::GZipDecompressor(std::weak_ptr<IControl> control, std::weak_ptr<IPublisher> publisher)
                 : Client(control, publisher)
+                , m_impl{new Impl}
             {
             }
 
-            void GZipDecompressor::ProcessData(Common::Buffer buffer)
+            GZipDecompressor::~GZipDecompressor()
             {
-                Common::Buffer result;
-
-                {
-                    using SourceType = boost::iostreams::basic_array_source<char>;
-                    SourceType source{buffer.data(), buffer.size()};
-                    boost::iostreams::stream<SourceType> iStream{source};
-
-                    boost::iostreams::filtering_ostream oStream;
-                    oStream.push(boost::iostreams::gzip_decompressor{});
-                    oStream.push(boost::iostreams::back_inserter(result));
-
-                    boost::iostreams::copy(iStream, oStream);
-                }
+            }
 
-                Post(std::move(result));
+            void GZipDecompressor::ProcessData(Common::Buffer buffer)
+            {
+                Post(m_impl->Process(buffer));
             }
 
         }   // namespace Clients
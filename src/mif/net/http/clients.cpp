@@ -6,11 +6,17 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <iterator>
 #include <stdexcept>
 #include <map>
 #include <memory>
 #include <mutex>
+#include <string>
 #include <utility>
+#include <vector>
 
 // MIF
 #include "mif/common/log.h"
@@ -19,6 +25,9 @@
 #include "mif/net/http/connection.h"
 #include "mif/net/http/constants.h"
 
+// THIS
+#include "detail/utility.h"
+
 namespace Mif
 {
     namespace Net
@@ -40,12 +49,13 @@ namespace Mif
                         using OnCloseHandler = std::function<void (std::string const &)>;
 
                         Session(std::string const &host, std::string const &port, std::string const &resource,
-                                OnCloseHandler const &onCloseHandler)
+                                std::size_t connections, OnCloseHandler const &onCloseHandler)
                             : m_host{host}
                             , m_port{port}
                             , m_resource{resource}
                             , m_sessionId{Common::UuidGenerator{}.Generate()}
                             , m_onCloseHandler{onCloseHandler}
+                            , m_slots(std::max<std::size_t>(connections, 1))
                         {
                         }
 
@@ -56,7 +66,10 @@ namespace Mif
 
                         IClientFactory::ClientPtr Init(IClientFactory &factory)
                         {
-                            GetConnection();
+                            {
+                                LockGuard lock{m_lock};
+                                Connect(0);
+                            }
                             m_client = factory.Create(std::weak_ptr<IControl>(shared_from_this()),
                                 std::weak_ptr<IPublisher>(shared_from_this()));
                             return m_client;
@@ -68,6 +81,16 @@ namespace Mif
 
                         using ConnectionPtr = std::shared_ptr<Connection>;
 
+                        struct Slot
+                        {
+                            ConnectionPtr connection;
+                            std::uint64_t generation = 0;
+                            std::size_t requests = 0;
+                        };
+
+                        using Slots = std::vector<Slot>;
+                        using Requests = std::map<std::uint64_t/*request id*/, std::size_t/*slot*/>;
+
                         LockType m_lock;
 
                         std::string m_host;
@@ -78,35 +101,104 @@ namespace Mif
 
                         bool m_needForClose{false};
 
-                        ConnectionPtr m_connection;
+                        Slots m_slots;
+                        Requests m_requests;
+                        std::uint64_t m_requestId{0};
+                        std::uint64_t m_generation{0};
 
                         IClientFactory::ClientPtr m_client;
 
-                        ConnectionPtr GetConnection()
+                        // The handlers get the generation of the connection, so the events of a connection
+                        // which was replaced in its slot are told apart from the events of the current one.
+                        void Connect(std::size_t index)
                         {
-                            ConnectionPtr connection;
+                            auto self = shared_from_this();
+                            auto const generation = ++m_generation;
+                            auto connection = std::make_shared<Connection>(m_host, m_port,
+                                std::bind(&Session::OnRequestDone, self, index, generation, std::placeholders::_1),
+                                std::bind(&Session::OnClose, self, index, generation));
+
+                            DropRequests(index);
+                            m_slots[index].connection = connection;
+                            m_slots[index].generation = generation;
+                        }
+
+                        // An idle connection is taken first, then a new one is made if there is a free slot,
+                        // otherwise the request is queued on the least loaded connection.
+                        ConnectionPtr GetConnection(std::string &requestId)
+                        {
+                            LockGuard lock{m_lock};
+
+                            if (m_needForClose)
+                                throw std::runtime_error{"Session marked for closure."};
+
+                            auto index = m_slots.size();
+                            auto free = m_slots.size();
+
+                            for (std::size_t i = 0 ; i < m_slots.size() ; ++i)
                             {
-                                LockGuard lock{m_lock};
+                                auto const &slot = m_slots[i];
 
-                                if (m_needForClose)
-                                    throw std::runtime_error{"Session marked for closure."};
+                                if (!slot.connection || slot.connection->IsClosed())
+                                {
+                                    if (free == m_slots.size())
+                                        free = i;
+                                    continue;
+                                }
 
-                                if (!m_connection || m_connection->IsClosed())
+                                if (!slot.requests)
                                 {
-                                    auto self = shared_from_this();
-                                    m_connection = std::make_shared<Connection>(m_host, m_port,
-                                        std::bind(&Session::OnRequestDone, self, std::placeholders::_1),
-                                        std::bind(&Session::OnClose, self));
+                                    index = i;
+                                    break;
                                 }
-                                connection = m_connection;
+
+                                if (index == m_slots.size() || slot.requests < m_slots[index].requests)
+                                    index = i;
+                            }
+
+                            if (free != m_slots.size() && (index == m_slots.size() || m_slots[index].requests))
+                            {
+                                index = free;
+                                Connect(index);
+                            }
+
+                            auto &slot = m_slots[index];
+                            auto const id = ++m_requestId;
+                            requestId = std::to_string(id);
+                            m_requests.emplace(id, index);
+                            ++slot.requests;
+
+                            return slot.connection;
+                        }
+
+                        // The requests of a closed connection get no response.
+                        void DropRequests(std::size_t index)
+                        {
+                            for (auto iter = std::begin(m_requests) ; iter != std::end(m_requests) ; )
+                            {
+                                if (iter->second == index)
+                                    iter = m_requests.erase(iter);
+                                else
+                                    ++iter;
                             }
-                            return connection;
+
+                            m_slots[index].requests = 0;
                         }
 
-                        void OnRequestDone(IInputPack const &pack)
+                        void OnRequestDone(std::size_t index, std::uint64_t generation, IInputPack const &pack)
                         {
                             try
                             {
+                                {
+                                    LockGuard lock{m_lock};
+                                    if (m_slots[index].generation != generation)
+                                    {
+                                        MIF_LOG(Warning) << "[Mif::Net::Http::Clients::Impl::OnRequestDone] "
+                                            << "Response from a replaced connection is skipped.";
+                                        return;
+                                    }
+                                }
+
                                 if (pack.GetCode() != Code::Ok)
                                 {
                                     auto const data = pack.GetData();
@@ -117,20 +209,52 @@ namespace Mif
                                 }
 
                                 {
-                                    auto const headers = pack.GetHeaders();
-                                    auto const sessionIter = headers.find(Constants::Header::MifExt::Session::Value);
-                                    if (sessionIter == std::end(headers))
+                                    auto const *session = Utility::FindHeader(pack, Constants::Header::MifExt::Session::Value);
+                                    if (!session)
                                         throw std::runtime_error{"No session from server."};
-                                    if (sessionIter->second.empty())
+                                    if (!session->size)
                                         throw std::runtime_error{"Empty session from server."};
-                                    if (sessionIter->second != m_sessionId)
+                                    if (session->ToString() != m_sessionId)
                                     {
                                         throw std::runtime_error{"Bad session from server. "
-                                            "Server session: \"" + sessionIter->second + "\" "
+                                            "Server session: \"" + session->ToString() + "\" "
                                             "Needed session: \"" + m_sessionId + "\""};
                                     }
                                 }
 
+                                {
+                                    auto const *requestId = Utility::FindHeader(pack, Constants::Header::MifExt::Request::Value);
+
+                                    LockGuard lock{m_lock};
+
+                                    auto iter = std::end(m_requests);
+                                    if (requestId)
+                                    {
+                                        auto const value = requestId->ToString();
+                                        char *end = nullptr;
+                                        auto const id = std::strtoull(value.c_str(), &end, 10);
+                                        if (!value.empty() && !*end)
+                                            iter = m_requests.find(id);
+                                        if (iter == std::end(m_requests))
+                                            throw std::runtime_error{"Unknown request id \"" + value + "\" from server."};
+                                    }
+                                    else
+                                    {
+                                        // A server which does not echo the request id answers the requests
+                                        // of a connection in order, so the response is for the oldest one.
+                                        iter = std::find_if(std::begin(m_requests), std::end(m_requests),
+                                                [index] (Requests::value_type const &i) { return i.second == index; });
+                                        if (iter == std::end(m_requests))
+                                            throw std::runtime_error{"No request id from server and no request in progress."};
+                                    }
+
+                                    auto &slot = m_slots[iter->second];
+                                    if (slot.requests)
+                                        --slot.requests;
+
+                                    m_requests.erase(iter);
+                                }
+
                                 auto data = pack.GetData();
                                 if (data.empty())
                                     throw std::runtime_error{"No data in the server response."};
@@ -152,9 +276,12 @@ namespace Mif
                             }
                         }
 
-                        void OnClose()
+                        void OnClose(std::size_t index, std::uint64_t generation)
                         {
                             // TODO: may be try to reconnect
+                            LockGuard lock{m_lock};
+                            if (m_slots[index].generation == generation)
+                                DropRequests(index);
                         }
 
                         //----------------------------------------------------------------------------
@@ -163,12 +290,14 @@ namespace Mif
                         {
                             try
                             {
-                                auto connection = GetConnection();
+                                std::string requestId;
+                                auto connection = GetConnection(requestId);
                                 auto pack = connection->CreateRequest();
 
                                 pack->SetHeader(Constants::Header::Request::Connection::Value,
                                     Constants::Value::Connection::KeepAlive::Value);
                                 pack->SetHeader(Constants::Header::MifExt::Session::Value, m_sessionId);
+                                pack->SetHeader(Constants::Header::MifExt::Request::Value, requestId);
 
                                 pack->SetData(std::move(buffer));
 
@@ -211,9 +340,8 @@ namespace Mif
                                     << "Error: unknown";
                             }
 
+                            LockGuard lock{m_lock};
                             m_needForClose = true;
-
-                            OnClose();
                         }
 
                     };
@@ -224,8 +352,9 @@ namespace Mif
             class Clients::Impl final
             {
             public:
-                Impl(std::shared_ptr<IClientFactory> factory)
+                Impl(std::shared_ptr<IClientFactory> factory, std::size_t connections)
                     : m_factory(factory)
+                    , m_connections{connections}
                 {
                 }
 
@@ -239,7 +368,7 @@ namespace Mif
                     {
                         auto lock = m_lock;
                         auto sessions = m_sessions;
-                        auto session = std::make_shared<Detail::Session>(host, port, resource,
+                        auto session = std::make_shared<Detail::Session>(host, port, resource, m_connections,
                                 [lock, sessions] (std::string const &id)
                                 {
                                     SessionPtr session;
@@ -271,6 +400,8 @@ namespace Mif
 
             private:
                 std::shared_ptr<IClientFactory> m_factory;
+                std::size_t m_connections;
+
                 using SessionPtr = std::shared_ptr<Detail::Session>;
                 using Sessions = std::map<std::string, SessionPtr>;
                 using SessionsPtr = std::shared_ptr<Sessions>;
@@ -284,8 +415,8 @@ namespace Mif
             };
 
 
-            Clients::Clients(std::shared_ptr<IClientFactory> factory)
-                : m_impl{new Clients::Impl{factory}}
+            Clients::Clients(std::shared_ptr<IClientFactory> factory, std::size_t connections)
+                : m_impl{new Clients::Impl{factory, connections}}
             {
             }
 
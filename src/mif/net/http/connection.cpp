@@ -7,26 +7,24 @@
 
 // STD
 #include <atomic>
-#include <cstdint>
-#include <mutex>
+#include <chrono>
+#include <cstddef>
+#include <limits>
+#include <memory>
 #include <stdexcept>
-#include <thread>
 #include <utility>
 
 // EVENT
-#include <event2/buffer.h>
-#include <event2/event.h>
 #include <event2/http.h>
 #include <event2/http_struct.h>
 
 // MIF
 #include "mif/common/log.h"
-#include "mif/common/unused.h"
 #include "mif/net/http/connection.h"
 
 // THIS
+#include "detail/client_engine.h"
 #include "detail/input_pack.h"
-#include "detail/lib_event_initializer.h"
 #include "detail/output_pack.h"
 #include "detail/utility.h"
 
@@ -47,48 +45,42 @@ namespace Mif
 
                 Impl(Params const &params, ClientHandler const &handler,
                         OnCloseHandler const &onClose)
-                    : m_handler{handler}
-                    , m_onClose{onClose}
-                    , m_host{params.host}
-                    , m_port{params.port}
-                    , m_base{Detail::Utility::CreateEventBase()}
+                    : m_engine{Detail::ClientEngine::GetInstance()}
+                    , m_state{std::make_shared<State>()}
                 {
-                    Detail::LibEventInitializer::Init();
-
-                    m_connection.reset(evhttp_connection_base_new(m_base.get(), nullptr, params.host.c_str(),
-                        static_cast<ev_uint16_t>(std::stoi(params.port))));
-
-                    if (!m_connection)
-                    {
-                        throw std::runtime_error{"[Mif::Net::Http::Connection::Impl] "
-                            "Failed to create connection to \"" + m_host + ":" + m_port + "\"."};
-                    }
-
-                    evhttp_connection_set_closecb(m_connection.get(), &Impl::OnClose, this);
-
-                    if (params.timeout != std::chrono::seconds::max())
-                        evhttp_connection_set_timeout(m_connection.get(), params.timeout.count());
-
-                    if (params.retriesCount != std::numeric_limits<std::size_t>::max())
-                        evhttp_connection_set_retries(m_connection.get(), params.retriesCount);
-
-                    if (params.maxHeaderSize != std::numeric_limits<std::size_t>::max())
-                        evhttp_connection_set_max_headers_size(m_connection.get(), params.maxHeaderSize);
-
-                    if (params.maxBodySize != std::numeric_limits<std::size_t>::max())
-                        evhttp_connection_set_max_body_size(m_connection.get(), params.maxBodySize);
-
-                    {
-                        EventPtr timer{event_new(m_base.get(), -1, EV_PERSIST, &Impl::OnTimer, this), &event_free};
-                        if (!timer)
-                            throw std::runtime_error{"[Mif::Net::Http::Connection::Impl] Failed to create timer object."};
-                        timeval interval{0, m_period};
-                        if (event_add(timer.get(), &interval))
-                            throw std::runtime_error{"[Mif::Net::Http::Connection::Impl] Failed to initialize timer."};
-                        std::swap(timer, m_timer);
-                    }
-
-                    m_thread.reset(new std::thread{std::bind(&Impl::Run, this)});
+                    m_state->handler = handler;
+                    m_state->onClose = onClose;
+                    m_state->host = params.host;
+                    m_state->port = params.port;
+
+                    // The connection can be taken from the pool, so all the parameters are set anew.
+                    auto state = m_state;
+                    m_loop = m_engine->Acquire(params.host, params.port, [params, state] (Detail::ClientEngine::Lease const &lease)
+                            {
+                                state->lease = lease;
+
+                                auto *connection = lease.connection;
+                                if (!connection)
+                                {
+                                    state->OnClose();
+                                    return;
+                                }
+
+                                evhttp_connection_set_closecb(connection, &Impl::OnClose, state.get());
+
+                                evhttp_connection_set_timeout(connection,
+                                    params.timeout != std::chrono::seconds::max() ? params.timeout.count() : -1);
+
+                                evhttp_connection_set_retries(connection,
+                                    params.retriesCount != std::numeric_limits<std::size_t>::max() ? params.retriesCount : 0);
+
+                                evhttp_connection_set_max_headers_size(connection,
+                                    params.maxHeaderSize != std::numeric_limits<std::size_t>::max() ? params.maxHeaderSize : -1);
+
+                                evhttp_connection_set_max_body_size(connection,
+                                    params.maxBodySize != std::numeric_limits<std::size_t>::max() ? params.maxBodySize : -1);
+                            }
+                        );
                 }
 
                 Impl(std::string const &host, std::string const &port,
@@ -99,30 +91,38 @@ namespace Mif
 
                 ~Impl()
                 {
-                    if (event_del(m_timer.get()))
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::~Impl] Failed to destroy timer.";
-                    if (!m_isClosed && event_base_loopbreak(m_base.get()))
+                    // The handlers are not called any more. The state lives until the connection
+                    // is released in its loop, because the callbacks of libevent can come before.
+                    m_state->isReleased = true;
+
+                    auto engine = m_engine;
+                    auto state = m_state;
+
+                    try
                     {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::~Impl] "
-                            << "Failed to post 'stop' to server.";
+                        m_engine->Post(m_loop, [engine, state]
+                                {
+                                    if (state->lease.connection)
+                                        engine->Release(state->lease, !state->pending && !state->isClosed);
+                                }
+                            );
                     }
-                    else
+                    catch (std::exception const &e)
                     {
-                        m_isClosed = true;
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::~Impl] "
+                            << "Failed to release connection. Error: " << e.what();
                     }
-
-                    m_thread.reset();
                 }
 
                 bool IsClosed() const
                 {
-                    return m_isClosed;
+                    return m_state->isClosed;
                 }
 
                 IOutputPackPtr CreateRequest() const
                 {
                     Detail::OutputPack::RequestPtr request{evhttp_request_new(&Impl::OnRequestDone,
-                        const_cast<Impl *>(this)), &evhttp_request_free};
+                        m_state.get()), &evhttp_request_free};
                     if (!request)
                         throw std::runtime_error{"[Mif::Net::Http::Connection::Impl::CreateRequest] Failed to create request."};
 
@@ -134,92 +134,112 @@ namespace Mif
                 {
                     if (!pack)
                         throw std::invalid_argument{"[Mif::Net::Http::Connection::Impl::MakeRequest] Empty package for \"" + request + "\""};
-                    auto *out = static_cast<Detail::OutputPack *>(pack.get());
-                    out->MoveDataToBuffer();
-                    out->ReleaseNewRequest();
-                    if (evhttp_make_request(m_connection.get(), out->GetRequest(),
-                        static_cast<evhttp_cmd_type>(Detail::Utility::ConvertMethodType(method)),
-                        request.c_str()))
-                    {
-                        throw std::runtime_error{"[Mif::Net::Http::Connection::Impl::MakeRequest] Failed to make request for \"" + request + "\""};
-                    }
 
+                    static_cast<Detail::OutputPack *>(pack.get())->MoveDataToBuffer();
+
+                    auto const type = static_cast<evhttp_cmd_type>(Detail::Utility::ConvertMethodType(method));
+                    auto state = m_state;
+                    std::shared_ptr<IOutputPack> holder{std::move(pack)};
+
+                    // The request is sent in the loop of the connection. If it is not sent,
+                    // the holder frees the request.
+                    m_engine->Post(m_loop, [state, holder, type, request]
+                            {
+                                auto *connection = state->lease.connection;
+                                if (!connection)
+                                {
+                                    MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::MakeRequest] "
+                                        << "[" << state->host << ":" << state->port << "] "
+                                        << "No connection for \"" << request << "\"";
+
+                                    return;
+                                }
+
+                                auto *out = static_cast<Detail::OutputPack *>(holder.get());
+                                out->ReleaseNewRequest();
+
+                                // It is counted before, because a failed request can be completed in the call.
+                                ++state->pending;
+
+                                if (evhttp_make_request(connection, out->GetRequest(), type, request.c_str()))
+                                {
+                                    MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::MakeRequest] "
+                                        << "[" << state->host << ":" << state->port << "] "
+                                        << "Failed to make request for \"" << request << "\"";
+
+                                    state->OnClose();
+                                }
+                            }
+                        );
                 }
 
             private:
-                using ConnectionPtr = std::unique_ptr<evhttp_connection, decltype(&evhttp_connection_free)>;
-
-                ClientHandler m_handler;
-                OnCloseHandler m_onClose;
-                std::string m_host;
-                std::string m_port;
-
-                Detail::Utility::EventBasePtr m_base;
-
-                std::uint32_t const m_period = 500;
-                using EventPtr = std::unique_ptr<event, decltype(&event_free)>;
-                EventPtr m_timer{nullptr, &event_free};
-
-                ConnectionPtr m_connection{nullptr, &evhttp_connection_free};
+                // Is shared with the loop of the connection.
+                struct State
+                {
+                    ClientHandler handler;
+                    OnCloseHandler onClose;
+                    std::string host;
+                    std::string port;
 
-                std::atomic<bool> m_isClosed{false};
-                using ThreadPtr = std::unique_ptr<std::thread, std::function<void (std::thread *)>>;
-                ThreadPtr m_thread{nullptr, std::bind(&Impl::ThreadDeleter, this, std::placeholders::_1)};
+                    std::atomic<bool> isClosed{false};
+                    std::atomic<bool> isReleased{false};
 
-                static void OnTimer(evutil_socket_t, short, void *)
-                {
-                }
+                    // Are used only in the loop.
+                    Detail::ClientEngine::Lease lease{0, nullptr, {}};
+                    std::size_t pending = 0;
 
-                void ThreadDeleter(std::thread *t)
-                {
-                    try
+                    void OnClose()
                     {
-                        if (t)
-                            t->join();
+                        isClosed = true;
+
+                        if (isReleased)
+                            return;
+
+                        try
+                        {
+                            onClose();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Connection::Impl::OnClose] "
+                                << "Failed to call OnClose handler. Error: " << e.what();
+                        }
+                        catch (...)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Connection::Impl::OnClose] "
+                                << "Failed to call OnClose handler. Error: unknown";
+                        }
                     }
-                    catch (std::exception const &e)
-                    {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::ThreadDeleter] "
-                            << "Failed to join thread. Error: " << e.what();
-                    }
-                    catch (...)
-                    {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::ThreadDeleter] "
-                            << "Failed to join thread. Error: unknown";
-                    }
-                    delete t;
-                }
 
-                void Run()
-                {
-                    auto code = event_base_loop(m_base.get(), 0);
-                    if (code < 0)
+                    void OnRequest(evhttp_request *request)
                     {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::Run] "
-                            << "Message loop was broken with code \"" << code << "\".";
+                        if (isReleased)
+                            return;
+
+                        try
+                        {
+                            Detail::InputPack pack{request};
+                            handler(pack);
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::OnRequest] "
+                                << "Failed to process request. Error: " << e.what();
+                        }
+                        catch (...)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::OnRequest] "
+                                << "Failed to process request. Error: unknown";
+                        }
                     }
+                };
 
-                    m_isClosed = true;
-                }
+                using StatePtr = std::shared_ptr<State>;
 
-                void OnClose()
-                {
-                    try
-                    {
-                        m_isClosed = true;
-                        m_onClose();
-                    }
-                    catch (std::exception const &e)
-                    {
-                        MIF_LOG(Error) << "[Mif::Net::Http::Connection::Impl::OnClose] "
-                            << "Failed to call OnClose handler. Error: " << e.what();
-                    }
-                    catch (...)
-                    {
-                        MIF_LOG(Error) << "[Mif::Net::Http::Connection::Impl::OnClose] "
-                            << "Failed to call OnClose handler. Error: unknown";
-                    }
-                }
+                std::shared_ptr<Detail::ClientEngine> m_engine;
+                StatePtr m_state;
+                std::size_t m_loop = 0;
 
                 static void OnClose(evhttp_connection *, void *arg)
                 {
@@ -230,8 +250,8 @@ namespace Mif
                         return;
                     }
 
-                    auto *self = reinterpret_cast<Impl *>(arg);
-                    self->OnClose();
+                    auto *state = reinterpret_cast<State *>(arg);
+                    state->OnClose();
                 }
 
                 static void OnRequestDone(evhttp_request *request, void *arg)
@@ -243,38 +263,22 @@ namespace Mif
                         return;
                     }
 
-                    auto *self = reinterpret_cast<Impl *>(arg);
+                    auto *state = reinterpret_cast<State *>(arg);
+
+                    if (state->pending)
+                        --state->pending;
 
                     if (!request || !evhttp_request_get_response_code(request) || !request->response_code)
                     {
-                        self->OnClose();
+                        state->OnClose();
 
                         MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::OnRequestDone] "
-                            << "[" << self->m_host << ":" << self->m_port << "] Connection refused.";
+                            << "[" << state->host << ":" << state->port << "] Connection refused.";
 
                         return;
                     }
 
-                    self->OnRequest(request);
-                }
-
-                void OnRequest(evhttp_request *request)
-                {
-                    try
-                    {
-                        Detail::InputPack pack{request};
-                        m_handler(pack);
-                    }
-                    catch (std::exception const &e)
-                    {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::OnRequest] "
-                            << "Failed to process request. Error: " << e.what();
-                    }
-                    catch (...)
-                    {
-                        MIF_LOG(Warning) << "[Mif::Net::Http::Connection::Impl::OnRequest] "
-                            << "Failed to process request. Error: unknown";
-                    }
+                    state->OnRequest(request);
                 }
             };
 
@@ -0,0 +1,198 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <stdexcept>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "async_output_pack.h"
+#include "output_pack.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                AsyncOutputPack::AsyncOutputPack(evhttp_request *request, std::shared_ptr<Dispatcher> dispatcher, OnSent onSent)
+                    : m_state{std::make_shared<State>()}
+                    , m_dispatcher{std::move(dispatcher)}
+                    , m_onSent{std::move(onSent)}
+                {
+                    if (!request)
+                        throw std::invalid_argument{"[Mif::Net::Http::Detail::AsyncOutputPack] Empty request pointer."};
+                    if (!m_dispatcher)
+                        throw std::invalid_argument{"[Mif::Net::Http::Detail::AsyncOutputPack] Empty dispatcher."};
+
+                    auto *connection = evhttp_request_get_connection(request);
+                    if (!connection)
+                        throw std::runtime_error{"[Mif::Net::Http::Detail::AsyncOutputPack] The request has no connection."};
+
+                    m_state->request = request;
+                    m_state->connection = connection;
+
+                    // The holder is released either by the reply or by the close callback, whichever comes first.
+                    // So libevent never calls back with a dangling argument, even if the reply is lost.
+                    m_state->holder = new StatePtr{m_state};
+                    evhttp_connection_set_closecb(connection, &AsyncOutputPack::OnClose, m_state->holder);
+                }
+
+                AsyncOutputPack::~AsyncOutputPack()
+                {
+                    if (m_sent)
+                        return;
+
+                    try
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::AsyncOutputPack] "
+                                << "The response was released without sending. It will be completed with the internal error.";
+
+                        m_code = Code::Internal;
+                        m_reason.clear();
+                        m_headers.clear();
+                        Common::Buffer{}.swap(m_buffer);
+                        Send();
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Error) << "[Mif::Net::Http::Detail::AsyncOutputPack] "
+                                << "Failed to send the response. Error: " << e.what();
+                    }
+                }
+
+                bool AsyncOutputPack::IsSent() const
+                {
+                    return m_sent;
+                }
+
+                void AsyncOutputPack::Send()
+                {
+                    if (m_sent.exchange(true))
+                        throw std::logic_error{"[Mif::Net::Http::Detail::AsyncOutputPack::Send] The response has already been sent."};
+
+                    ReplyPtr reply{new Reply{m_state, m_code, std::move(m_reason), std::move(m_headers),
+                            std::move(m_buffer), std::move(m_onSent)}};
+
+                    if (m_dispatcher->IsLoopThread())
+                    {
+                        SendReply(std::move(reply));
+                        return;
+                    }
+
+                    if (!m_dispatcher->Post(std::bind(&AsyncOutputPack::SendReply, reply)))
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::AsyncOutputPack::Send] "
+                                << "The server is stopped. The response is dropped.";
+                    }
+                }
+
+                void AsyncOutputPack::OnClose(evhttp_connection *connection, void *arg)
+                {
+                    std::unique_ptr<StatePtr> holder{static_cast<StatePtr *>(arg)};
+                    if (!holder || !*holder)
+                        return;
+
+                    auto &state = **holder;
+                    if (state.connection != connection)
+                        return;
+
+                    state.closed = true;
+                    state.connection = nullptr;
+                    state.holder = nullptr;
+
+                    // libevent detaches the request which is still being answered from the connection
+                    // and leaves it to the reply. Otherwise the request is freed together with the connection.
+                    if (evhttp_request_get_connection(state.request))
+                        state.request = nullptr;
+                }
+
+                void AsyncOutputPack::SendReply(ReplyPtr reply)
+                {
+                    auto &state = *reply->state;
+
+                    if (state.closed)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::AsyncOutputPack::SendReply] "
+                                << "The connection was closed by the client. The response is dropped.";
+
+                        if (state.request)
+                            evhttp_request_free(state.request);
+                        state.request = nullptr;
+
+                        if (reply->onSent)
+                            reply->onSent();
+                        return;
+                    }
+
+                    // Sending can free the connection, so it must not call back this reply any more.
+                    evhttp_connection_set_closecb(state.connection, nullptr, nullptr);
+                    delete state.holder;
+                    state.holder = nullptr;
+
+                    try
+                    {
+                        OutputPack pack{state.request};
+                        IOutputPack &out = pack;
+
+                        out.SetCode(reply->code);
+                        if (!reply->reason.empty())
+                            out.SetReason(reply->reason);
+                        for (auto const &i : reply->headers)
+                            out.SetHeader(i.first, i.second);
+                        out.SetData(std::move(reply->data));
+
+                        pack.Send();
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::AsyncOutputPack::SendReply] "
+                                << "Failed to send the response. Error: " << e.what();
+
+                        std::string reason = "Internal server error. ";
+                        reason += e.what();
+                        evhttp_send_error(state.request, HTTP_INTERNAL, reason.c_str());
+                    }
+
+                    if (reply->onSent)
+                        reply->onSent();
+                }
+
+                void AsyncOutputPack::SetCode(Code code)
+                {
+                    m_code = code;
+                }
+
+                void AsyncOutputPack::SetReason(std::string const &reason)
+                {
+                    m_reason = reason;
+                }
+
+                void AsyncOutputPack::SetHeader(std::string const &key, std::string const &value)
+                {
+                    if (key.empty())
+                        throw std::invalid_argument{"[Mif::Net::Http::Detail::AsyncOutputPack::SetHeader] Key must not be empty."};
+                    if (value.empty())
+                        throw std::invalid_argument{"[Mif::Net::Http::Detail::AsyncOutputPack::SetHeader] Value must not be empty."};
+
+                    m_headers.emplace_back(key, value);
+                }
+
+                void AsyncOutputPack::SetData(Common::Buffer buffer)
+                {
+                    m_buffer = std::move(buffer);
+                }
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
@@ -0,0 +1,109 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_HTTP_DETAIL_ASYNC_OUTPUT_PACK_H__
+#define __MIF_NET_HTTP_DETAIL_ASYNC_OUTPUT_PACK_H__
+
+// STD
+#include <atomic>
+#include <functional>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+// EVENT
+#include <event2/http.h>
+
+// MIF
+#include "mif/net/http/iasync_output_pack.h"
+
+// THIS
+#include "dispatcher.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                // Collects the response data without touching the request. The request is filled
+                // and the reply is sent in the thread of the event loop only. The pack watches the
+                // connection, so a reply which comes after the client has gone is dropped.
+                class AsyncOutputPack final
+                    : public IAsyncOutputPack
+                {
+                public:
+                    using OnSent = std::function<void ()>;
+
+                    AsyncOutputPack(evhttp_request *request, std::shared_ptr<Dispatcher> dispatcher, OnSent onSent);
+                    ~AsyncOutputPack();
+
+                    bool IsSent() const;
+
+                    // IAsyncOutputPack
+                    virtual void Send() override final;
+
+                private:
+                    using Headers = std::vector<std::pair<std::string, std::string>>;
+
+                    struct State;
+                    using StatePtr = std::shared_ptr<State>;
+
+                    // It is touched in the thread of the event loop only.
+                    struct State
+                    {
+                        evhttp_request *request = nullptr;
+                        evhttp_connection *connection = nullptr;
+                        // It is given to libevent as the argument of the close callback.
+                        StatePtr *holder = nullptr;
+                        bool closed = false;
+                    };
+
+                    struct Reply
+                    {
+                        StatePtr state;
+                        Code code;
+                        std::string reason;
+                        Headers headers;
+                        Common::Buffer data;
+                        OnSent onSent;
+                    };
+
+                    using ReplyPtr = std::shared_ptr<Reply>;
+
+                    StatePtr m_state;
+                    std::shared_ptr<Dispatcher> m_dispatcher;
+                    OnSent m_onSent;
+
+                    std::atomic<bool> m_sent{false};
+
+                    Code m_code = Code::Ok;
+                    std::string m_reason;
+                    Headers m_headers;
+                    Common::Buffer m_buffer;
+
+                    static void OnClose(evhttp_connection *connection, void *arg);
+                    static void SendReply(ReplyPtr reply);
+
+                    // IOutputPack
+                    virtual void SetCode(Code code) override final;
+                    virtual void SetReason(std::string const &reason) override final;
+
+                    virtual void SetHeader(std::string const &key, std::string const &value) override final;
+                    virtual void SetData(Common::Buffer buffer) override final;
+                };
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_HTTP_DETAIL_ASYNC_OUTPUT_PACK_H__
@@ -0,0 +1,363 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <exception>
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "client_engine.h"
+#include "lib_event_initializer.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                class ClientEngine::Keeper final
+                {
+                public:
+                    Keeper(Keeper const &) = delete;
+                    Keeper& operator = (Keeper const &) = delete;
+
+                    static Keeper& GetInstance()
+                    {
+                        static Keeper keeper;
+                        return keeper;
+                    }
+
+                    std::shared_ptr<ClientEngine> Get()
+                    {
+                        std::lock_guard<std::mutex> lock{m_data->lock};
+
+                        auto usage = m_data->usage.lock();
+                        if (!usage)
+                        {
+                            if (!m_data->engine)
+                                m_data->engine.reset(new ClientEngine, [] (ClientEngine *engine) { delete engine; } );
+
+                            usage = std::make_shared<Usage>(m_data);
+                            m_data->usage = usage;
+                            m_data->idle = false;
+                            m_data->changed.notify_all();
+
+                            if (!m_thread.joinable())
+                                m_thread = std::thread{&Keeper::Run, m_data};
+                        }
+
+                        // The holders share the usage, and the engine itself is owned by the keeper only.
+                        return {usage, m_data->engine.get()};
+                    }
+
+                private:
+                    struct Data
+                    {
+                        std::mutex lock;
+                        std::condition_variable changed;
+                        std::shared_ptr<ClientEngine> engine;
+                        std::weak_ptr<void> usage;
+                        bool idle = false;
+                        std::chrono::steady_clock::time_point idleSince;
+                        bool stop = false;
+                    };
+
+                    using DataPtr = std::shared_ptr<Data>;
+
+                    // It is released by the last holder of the engine, maybe in a loop of the engine,
+                    // so it only starts the grace period.
+                    struct Usage
+                    {
+                        DataPtr data;
+
+                        Usage(DataPtr data)
+                            : data{std::move(data)}
+                        {
+                        }
+
+                        ~Usage()
+                        {
+                            std::lock_guard<std::mutex> lock{data->lock};
+
+                            // A new usage can be made while this one is being released.
+                            if (!data->usage.expired())
+                                return;
+
+                            data->idle = true;
+                            data->idleSince = std::chrono::steady_clock::now();
+                            data->changed.notify_all();
+                        }
+                    };
+
+                    DataPtr m_data = std::make_shared<Data>();
+                    std::thread m_thread;
+
+                    Keeper() = default;
+
+                    ~Keeper()
+                    {
+                        std::shared_ptr<ClientEngine> engine;
+
+                        {
+                            std::lock_guard<std::mutex> lock{m_data->lock};
+                            m_data->stop = true;
+                            m_data->changed.notify_all();
+
+                            if (m_data->usage.expired())
+                            {
+                                std::swap(engine, m_data->engine);
+                            }
+                            else
+                            {
+                                // The engine can not be destroyed by its last holder, which can be in its loop,
+                                // so it is left to the end of the process.
+                                MIF_LOG(Warning) << "[Mif::Net::Http::Detail::ClientEngine::Keeper] "
+                                    << "The client engine is still used at exit. It will not be stopped.";
+                                new std::shared_ptr<ClientEngine>{m_data->engine};
+                            }
+                        }
+
+                        try
+                        {
+                            if (m_thread.joinable())
+                                m_thread.join();
+
+                            engine.reset();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Detail::ClientEngine::Keeper] "
+                                << "Failed to stop client engine. Error: " << e.what();
+                        }
+                    }
+
+                    static void Run(DataPtr data)
+                    {
+                        std::unique_lock<std::mutex> lock{data->lock};
+
+                        while (!data->stop)
+                        {
+                            if (!data->idle || !data->engine)
+                            {
+                                data->changed.wait(lock);
+                                continue;
+                            }
+
+                            auto const gracePeriod = std::chrono::seconds{static_cast<std::int64_t>(GracePeriod)};
+                            auto const deadline = data->idleSince + gracePeriod;
+                            if (data->changed.wait_until(lock, deadline, [&data] { return data->stop || !data->idle; }))
+                                continue;
+
+                            std::shared_ptr<ClientEngine> engine;
+                            std::swap(engine, data->engine);
+                            data->idle = false;
+
+                            lock.unlock();
+                            engine.reset();
+                            lock.lock();
+                        }
+                    }
+                };
+
+                std::shared_ptr<ClientEngine> ClientEngine::GetInstance()
+                {
+                    return Keeper::GetInstance().Get();
+                }
+
+                ClientEngine::ClientEngine()
+                {
+                    LibEventInitializer::Init();
+
+                    std::size_t const maxLoops = MaxLoops;
+                    auto const count = std::max<std::size_t>(1,
+                            std::min<std::size_t>(std::thread::hardware_concurrency(), maxLoops));
+
+                    for (std::size_t i = 0 ; i < count ; ++i)
+                    {
+                        std::unique_ptr<Loop> loop{new Loop};
+
+                        loop->base = Utility::CreateEventBase();
+                        loop->wakeup.reset(event_new(loop->base.get(), -1, 0, &ClientEngine::OnWakeup, loop.get()));
+                        if (!loop->wakeup)
+                            throw std::runtime_error{"[Mif::Net::Http::Detail::ClientEngine] Failed to create wakeup event."};
+
+                        m_loops.push_back(std::move(loop));
+                    }
+
+                    // The loops do not exit without the events, so there is no need for a timer to keep them running.
+                    for (auto &loop : m_loops)
+                    {
+                        auto *base = loop->base.get();
+                        loop->thread.reset(new std::thread{[base]
+                                {
+                                    auto const code = event_base_loop(base, EVLOOP_NO_EXIT_ON_EMPTY);
+                                    if (code < 0)
+                                    {
+                                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::ClientEngine] "
+                                            << "Message loop was broken with code \"" << code << "\".";
+                                    }
+                                }
+                            });
+                    }
+                }
+
+                ClientEngine::~ClientEngine()
+                {
+                    // The tasks posted before are done first, among them the release of the connections.
+                    for (std::size_t i = 0 ; i < m_loops.size() ; ++i)
+                    {
+                        auto *base = m_loops[i]->base.get();
+                        Post(i, [base] { event_base_loopbreak(base); });
+                    }
+
+                    for (auto &loop : m_loops)
+                    {
+                        try
+                        {
+                            loop->thread->join();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Detail::ClientEngine::~ClientEngine] "
+                                << "Failed to join loop thread. Error: " << e.what();
+                        }
+                    }
+
+                    for (auto &item : m_idle)
+                    {
+                        for (auto const &lease : item.second)
+                            evhttp_connection_free(lease.connection);
+                    }
+                }
+
+                std::size_t ClientEngine::Acquire(std::string const &host, std::string const &port,
+                        Initializer initializer)
+                {
+                    auto const number = static_cast<ev_uint16_t>(std::stoi(port));
+
+                    Lease lease{None, nullptr, host + ":" + port};
+
+                    {
+                        std::lock_guard<std::mutex> lock{m_lock};
+
+                        auto const iter = m_idle.find(lease.key);
+                        if (iter != std::end(m_idle) && !iter->second.empty())
+                        {
+                            lease = iter->second.back();
+                            iter->second.pop_back();
+                        }
+                    }
+
+                    if (!lease.connection)
+                        lease.loop = m_next++ % m_loops.size();
+
+                    auto *base = m_loops[lease.loop]->base.get();
+
+                    Post(lease.loop, [lease, host, number, initializer, base] () mutable
+                            {
+                                if (!lease.connection)
+                                {
+                                    lease.connection = evhttp_connection_base_new(base, nullptr, host.c_str(), number);
+
+                                    if (!lease.connection)
+                                    {
+                                        MIF_LOG(Error) << "[Mif::Net::Http::Detail::ClientEngine::Acquire] "
+                                            << "Failed to create connection to \"" << lease.key << "\".";
+                                    }
+                                }
+
+                                try
+                                {
+                                    initializer(lease);
+                                }
+                                catch (...)
+                                {
+                                    if (lease.connection)
+                                        evhttp_connection_free(lease.connection);
+                                    throw;
+                                }
+                            }
+                        );
+
+                    return lease.loop;
+                }
+
+                void ClientEngine::Release(Lease const &lease, bool reusable)
+                {
+                    evhttp_connection_set_closecb(lease.connection, nullptr, nullptr);
+
+                    if (reusable)
+                    {
+                        std::lock_guard<std::mutex> lock{m_lock};
+
+                        auto &items = m_idle[lease.key];
+                        if (items.size() < MaxIdleConnections)
+                        {
+                            items.push_back(lease);
+                            return;
+                        }
+                    }
+
+                    evhttp_connection_free(lease.connection);
+                }
+
+                void ClientEngine::Post(std::size_t loop, Task task)
+                {
+                    auto &item = *m_loops[loop];
+
+                    {
+                        std::lock_guard<std::mutex> lock{item.lock};
+                        item.tasks.push_back(std::move(task));
+                    }
+
+                    event_active(item.wakeup.get(), 0, 0);
+                }
+
+                void ClientEngine::OnWakeup(evutil_socket_t, short, void *arg)
+                {
+                    auto *loop = reinterpret_cast<Loop *>(arg);
+
+                    std::vector<Task> tasks;
+                    {
+                        std::lock_guard<std::mutex> lock{loop->lock};
+                        std::swap(tasks, loop->tasks);
+                    }
+
+                    for (auto const &task : tasks)
+                    {
+                        try
+                        {
+                            task();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Detail::ClientEngine::OnWakeup] "
+                                << "Failed to run task. Error: " << e.what();
+                        }
+                        catch (...)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Detail::ClientEngine::OnWakeup] "
+                                << "Failed to run task. Error: unknown";
+                        }
+                    }
+                }
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
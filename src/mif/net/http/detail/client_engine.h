@@ -0,0 +1,114 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_HTTP_DETAIL_CLIENT_ENGINE_H__
+#define __MIF_NET_HTTP_DETAIL_CLIENT_ENGINE_H__
+
+// STD
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+// EVENT
+#include <event2/event.h>
+#include <event2/http.h>
+
+// THIS
+#include "utility.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                // The event loops of all the client connections. A few threads serve any number of
+                // connections, and the connections which are not needed any more are kept open for
+                // the next clients of the same host. Libevent objects of a connection are used only
+                // in its loop, the other threads post tasks there.
+                class ClientEngine final
+                {
+                public:
+                    struct Lease
+                    {
+                        std::size_t loop;
+                        evhttp_connection *connection;
+                        std::string key;
+                    };
+
+                    using Task = std::function<void ()>;
+                    using Initializer = std::function<void (Lease const &)>;
+
+                    ClientEngine(ClientEngine const &) = delete;
+                    ClientEngine& operator = (ClientEngine const &) = delete;
+                    ClientEngine(ClientEngine &&) = delete;
+                    ClientEngine& operator = (ClientEngine &&) = delete;
+
+                    // The engine is kept for the grace period after its last holder is gone, so the idle
+                    // connections are reused by the next clients. Then it is destroyed in a thread of its own,
+                    // never in its loops, and that thread is joined when the process exits.
+                    static std::shared_ptr<ClientEngine> GetInstance();
+
+                    // Takes an idle connection to the host or creates a new one and returns the loop
+                    // of the connection without waiting for it. The initializer gets the connection
+                    // in the loop before the tasks posted after the call, the connection is null
+                    // if it could not be created.
+                    std::size_t Acquire(std::string const &host, std::string const &port, Initializer initializer);
+                    // Must be called in the loop of the connection. The connection without
+                    // the requests in progress is kept for reuse, the other one is closed.
+                    void Release(Lease const &lease, bool reusable);
+
+                    void Post(std::size_t loop, Task task);
+
+                private:
+                    static std::size_t const MaxLoops = 4;
+                    static std::size_t const MaxIdleConnections = 8;
+                    static std::size_t const None = static_cast<std::size_t>(-1);
+                    // In seconds.
+                    static std::uint32_t const GracePeriod = 30;
+
+                    using EventPtr = std::unique_ptr<event, decltype(&event_free)>;
+
+                    struct Loop
+                    {
+                        Utility::EventBasePtr base{nullptr, &event_base_free};
+                        EventPtr wakeup{nullptr, &event_free};
+                        std::mutex lock;
+                        std::vector<Task> tasks;
+                        std::unique_ptr<std::thread> thread;
+                    };
+
+                    std::vector<std::unique_ptr<Loop>> m_loops;
+                    std::atomic<std::size_t> m_next{0};
+
+                    std::mutex m_lock;
+                    std::map<std::string, std::vector<Lease>> m_idle;
+
+                    class Keeper;
+
+                    ClientEngine();
+                    ~ClientEngine();
+
+                    static void OnWakeup(evutil_socket_t, short, void *arg);
+                };
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_HTTP_DETAIL_CLIENT_ENGINE_H__
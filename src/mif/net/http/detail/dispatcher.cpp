@@ -0,0 +1,126 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <stdexcept>
+#include <utility>
+
+// MIF
+#include "mif/common/log.h"
+
+// THIS
+#include "dispatcher.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                Dispatcher::Dispatcher(event_base *base)
+                {
+                    if (!base)
+                        throw std::invalid_argument{"[Mif::Net::Http::Detail::Dispatcher] Empty event base."};
+
+                    m_event.reset(event_new(base, -1, 0, &Dispatcher::OnWakeup, this));
+                    if (!m_event)
+                        throw std::runtime_error{"[Mif::Net::Http::Detail::Dispatcher] Failed to create wakeup event."};
+                }
+
+                Dispatcher::~Dispatcher()
+                {
+                    Close();
+                }
+
+                bool Dispatcher::Post(Task task)
+                {
+                    LockGuard lock{m_lock};
+
+                    if (!m_event)
+                        return false;
+
+                    m_tasks.push_back(std::move(task));
+
+                    // The loop takes all the queued tasks at once, so it is woken up by the first one only.
+                    if (m_tasks.size() == 1)
+                        event_active(m_event.get(), EV_TIMEOUT, 0);
+
+                    return true;
+                }
+
+                void Dispatcher::SetLoopThread()
+                {
+                    m_loopThread = std::this_thread::get_id();
+                }
+
+                bool Dispatcher::IsLoopThread() const
+                {
+                    return m_loopThread.load() == std::this_thread::get_id();
+                }
+
+                void Dispatcher::Close()
+                {
+                    EventPtr event{nullptr, &event_free};
+                    Tasks tasks;
+
+                    {
+                        LockGuard lock{m_lock};
+                        std::swap(event, m_event);
+                        std::swap(tasks, m_tasks);
+                    }
+
+                    // The event is freed out of the lock, because it waits for the running callback which takes the lock.
+                    event.reset();
+
+                    if (!tasks.empty())
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Dispatcher::Close] "
+                                << tasks.size() << " task(s) were dropped.";
+                    }
+                }
+
+                void Dispatcher::OnWakeup(evutil_socket_t, short, void *arg)
+                {
+                    if (!arg)
+                    {
+                        MIF_LOG(Error) << "[Mif::Net::Http::Detail::Dispatcher::OnWakeup] No arguments.";
+                        return;
+                    }
+
+                    reinterpret_cast<Dispatcher *>(arg)->OnWakeup();
+                }
+
+                void Dispatcher::OnWakeup()
+                {
+                    Tasks tasks;
+
+                    {
+                        LockGuard lock{m_lock};
+                        std::swap(tasks, m_tasks);
+                    }
+
+                    for (auto &task : tasks)
+                    {
+                        try
+                        {
+                            task();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Http::Detail::Dispatcher::OnWakeup] "
+                                    << "Failed to run task. Error: " << e.what();
+                        }
+                    }
+                }
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
@@ -0,0 +1,74 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_HTTP_DETAIL_DISPATCHER_H__
+#define __MIF_NET_HTTP_DETAIL_DISPATCHER_H__
+
+// STD
+#include <atomic>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+
+// EVENT
+#include <event2/event.h>
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+            namespace Detail
+            {
+
+                // Runs the tasks posted from any thread in the thread of the event loop.
+                // The loop is woken up by a user event, so no descriptor is needed.
+                class Dispatcher final
+                {
+                public:
+                    using Task = std::function<void ()>;
+
+                    explicit Dispatcher(event_base *base);
+                    ~Dispatcher();
+
+                    Dispatcher(Dispatcher const &) = delete;
+                    Dispatcher(Dispatcher &&) = delete;
+                    Dispatcher& operator = (Dispatcher const &) = delete;
+                    Dispatcher& operator = (Dispatcher &&) = delete;
+
+                    // Returns false when the dispatcher is already closed. The task is dropped in this case.
+                    bool Post(Task task);
+
+                    void SetLoopThread();
+                    bool IsLoopThread() const;
+
+                    void Close();
+
+                private:
+                    using LockType = std::mutex;
+                    using LockGuard = std::lock_guard<LockType>;
+                    using EventPtr = std::unique_ptr<event, decltype(&event_free)>;
+                    using Tasks = std::deque<Task>;
+
+                    LockType m_lock;
+                    EventPtr m_event{nullptr, &event_free};
+                    Tasks m_tasks;
+                    std::atomic<std::thread::id> m_loopThread{std::thread::id{}};
+
+                    static void OnWakeup(evutil_socket_t, short, void *arg);
+                    void OnWakeup();
+                };
+
+            }   // namespace Detail
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_HTTP_DETAIL_DISPATCHER_H__
@@ -7,7 +7,9 @@
 
 // STD
 #include <cstdlib>
+#include <cstring>
 #include <stdexcept>
+#include <utility>
 
 // EVENT
 #include <event2/buffer.h>
@@ -33,6 +35,37 @@ namespace Mif
                         return {str ? str : ""};
                     }
 
+                    void FreeKeyValues(evkeyvalq *items)
+                    {
+                        evhttp_clear_headers(items);
+                        delete items;
+                    }
+
+                    void ParseKeyValues(evkeyvalq const *items, IInputPack::Fields &fields)
+                    {
+                        std::size_t count = 0;
+                        for (evkeyval const *i = items->tqh_first ; i ; i = i->next.tqe_next)
+                            ++count;
+
+                        fields.reserve(count);
+
+                        for (evkeyval const *i = items->tqh_first ; i ; i = i->next.tqe_next)
+                        {
+                            auto const *key = i->key ? i->key : "";
+                            auto const *value = i->value ? i->value : "";
+                            fields.push_back({{key, std::strlen(key)}, {value, std::strlen(value)}});
+                        }
+                    }
+
+                    template <typename T>
+                    T ToMap(IInputPack::Fields const &fields)
+                    {
+                        T items;
+                        for (auto const &i : fields)
+                            items.insert(std::make_pair(i.name.ToString(), i.value.ToString()));
+                        return items;
+                    }
+
                 }   // namespace
 
                 InputPack::InputPack(evhttp_request *request)
@@ -118,13 +151,17 @@ namespace Mif
 
                 std::string InputPack::GetPath() const
                 {
-                    if (!m_uri)
-                        return {};
-                    auto const *path = evhttp_uri_get_path(m_uri.get());
-                    if (!path)
-                        return {};
-                    std::unique_ptr<char, decltype(&std::free)> decoded{evhttp_uridecode(path, 0, nullptr), &std::free};
-                    return ToString(decoded.get());
+                    std::call_once(m_pathFlag, [this]
+                        {
+                            auto const *path = evhttp_uri_get_path(m_uri.get());
+                            if (!path)
+                                return;
+                            std::unique_ptr<char, decltype(&std::free)> decoded{evhttp_uridecode(path, 0, nullptr), &std::free};
+                            m_path = ToString(decoded.get());
+                        }
+                    );
+
+                    return m_path;
                 }
 
                 std::string InputPack::GetQuery() const
@@ -147,46 +184,74 @@ namespace Mif
 
                 InputPack::Params InputPack::GetParams() const
                 {
-                    auto const &query = GetQuery();
-                    if (query.empty())
-                        return {};
-
-                    evkeyvalq params;
-                    if (evhttp_parse_query_str(query.c_str(), &params))
-                        throw std::runtime_error{"[Mif::Net::Http::Detail::InputPack] Failed to parse query."};
+                    return ToMap<Params>(GetParamsView());
+                }
 
-                    Params result;
-                    for (evkeyval *i = params.tqh_first ; i ; i = i->next.tqe_next)
-                        result.insert(std::make_pair(ToString(i->key), ToString(i->value)));
+                InputPack::Headers InputPack::GetHeaders() const
+                {
+                    return ToMap<Headers>(GetHeadersView());
+                }
 
-                    return result;
+                Common::Buffer InputPack::GetData() const
+                {
+                    auto const data = GetDataView();
+                    return {data.data, data.data + data.size};
                 }
 
-                InputPack::Headers InputPack::GetHeaders() const
+                InputPack::Fields const& InputPack::GetParamsView() const
                 {
-                    auto const *headers = evhttp_request_get_input_headers(m_request);
-                    if (!headers)
-                        return {};
+                    std::call_once(m_paramsFlag, [this]
+                        {
+                            // The raw query is parsed, evhttp_parse_query_str decodes the names and the values.
+                            auto const *query = evhttp_uri_get_query(m_uri.get());
+                            if (!query || !*query)
+                                return;
+
+                            KeyValuesPtr params{new evkeyvalq(), &FreeKeyValues};
 
-                    Headers result;
-                    for (evkeyval *i = headers->tqh_first ; i ; i = i->next.tqe_next)
-                        result.insert(std::make_pair(ToString(i->key), ToString(i->value)));
+                            if (evhttp_parse_query_str(query, params.get()))
+                                throw std::runtime_error{"[Mif::Net::Http::Detail::InputPack] Failed to parse query."};
 
-                    return result;
+                            ParseKeyValues(params.get(), m_paramsView);
+                            m_params = std::move(params);
+                        }
+                    );
+
+                    return m_paramsView;
                 }
 
-                Common::Buffer InputPack::GetData() const
+                InputPack::Fields const& InputPack::GetHeadersView() const
                 {
-                    auto *inputBuffer = evhttp_request_get_input_buffer(m_request);
-                    if (!inputBuffer)
-                        return {};
-                    auto const length = evbuffer_get_length(inputBuffer);
-                    if (!length)
-                        return {};
-                    Common::Buffer buffer(length);
-                    if (evbuffer_copyout(inputBuffer, &buffer[0], length) != static_cast<ev_ssize_t>(length))
-                        throw std::runtime_error{"[Mif::Net::Http::Detail::InputPack::GetData] Failed to copy buffer."};
-                    return buffer;
+                    std::call_once(m_headersFlag, [this]
+                        {
+                            auto const *headers = evhttp_request_get_input_headers(m_request);
+                            if (headers)
+                                ParseKeyValues(headers, m_headersView);
+                        }
+                    );
+
+                    return m_headersView;
+                }
+
+                InputPack::View InputPack::GetDataView() const
+                {
+                    std::call_once(m_dataFlag, [this]
+                        {
+                            auto *inputBuffer = evhttp_request_get_input_buffer(m_request);
+                            if (!inputBuffer)
+                                return;
+                            auto const length = evbuffer_get_length(inputBuffer);
+                            if (!length)
+                                return;
+                            // The chains are joined in place only if the body is not in one chain already.
+                            auto const *data = evbuffer_pullup(inputBuffer, -1);
+                            if (!data)
+                                throw std::runtime_error{"[Mif::Net::Http::Detail::InputPack::GetDataView] Failed to get data."};
+                            m_dataView = {reinterpret_cast<char const *>(data), length};
+                        }
+                    );
+
+                    return m_dataView;
                 }
 
             }   // namespace Detail
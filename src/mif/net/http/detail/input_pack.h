@@ -10,6 +10,8 @@
 
 // STD
 #include <memory>
+#include <mutex>
+#include <string>
 
 // EVENT
 #include <event2/http.h>
@@ -33,9 +35,26 @@ namespace Mif
                     InputPack(evhttp_request *request);
 
                 private:
+                    using KeyValuesPtr = std::unique_ptr<evkeyvalq, void (*)(evkeyvalq *)>;
+
                     evhttp_request *m_request;
                     std::unique_ptr<evhttp_uri, decltype(&evhttp_uri_free)> m_uri{nullptr, &evhttp_uri_free};
 
+                    // The parts are parsed on the first call, the handlers may call the const methods
+                    // from different threads.
+                    mutable std::once_flag m_pathFlag;
+                    mutable std::string m_path;
+
+                    mutable std::once_flag m_paramsFlag;
+                    mutable KeyValuesPtr m_params{nullptr, nullptr};
+                    mutable Fields m_paramsView;
+
+                    mutable std::once_flag m_headersFlag;
+                    mutable Fields m_headersView;
+
+                    mutable std::once_flag m_dataFlag;
+                    mutable View m_dataView{"", 0};
+
                     // IInputPack
                     virtual Method::Type GetType() const override final;
                     virtual Code GetCode() const override final;
@@ -50,6 +69,9 @@ namespace Mif
                     virtual Params GetParams() const override final;
                     virtual Headers GetHeaders() const override final;
                     virtual Common::Buffer GetData() const override final;
+                    virtual Fields const& GetParamsView() const override final;
+                    virtual Fields const& GetHeadersView() const override final;
+                    virtual View GetDataView() const override final;
                 };
 
             }   // namespace Detail
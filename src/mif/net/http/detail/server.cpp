@@ -6,8 +6,11 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <chrono>
+#include <functional>
 #include <memory>
 #include <thread>
+#include <utility>
 
 // MIF
 #include "mif/common/log.h"
@@ -15,7 +18,6 @@
 
 // THIS
 #include "input_pack.h"
-#include "output_pack.h"
 #include "server.h"
 
 namespace Mif
@@ -27,11 +29,14 @@ namespace Mif
             namespace Detail
             {
 
-                Server::Server(ServerHandler const &handler, Methods const &allowedMethods, std::size_t headersSize,
-                        std::size_t bodySize, std::size_t requestTimeout)
+                Server::Server(ServerAsyncHandler const &handler, Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
+                        std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
                     : m_handler{handler}
+                    , m_handlersPool{std::move(handlersPool)}
                     , m_base{Utility::CreateEventBase()}
                 {
+                    m_dispatcher = std::make_shared<Dispatcher>(m_base.get());
+
                     {
                         HttpPtr http{evhttp_new(m_base.get()), &evhttp_free};
                         if (!http)
@@ -52,9 +57,10 @@ namespace Mif
                     }
                 }
 
-                Server::Server(std::string const &host, std::string const &port, ServerHandler const &handler, Methods const &allowedMethods,
+                Server::Server(std::string const &host, std::string const &port, ServerAsyncHandler const &handler,
+                        Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                         std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
-                    : Server{handler, allowedMethods, headersSize, bodySize, requestTimeout}
+                    : Server{handler, std::move(handlersPool), allowedMethods, headersSize, bodySize, requestTimeout}
                 {
                     if (host.empty())
                         throw std::invalid_argument{"[Mif::Net::Http::Detail::Server] Host must not be empty."};
@@ -68,9 +74,10 @@ namespace Mif
                     m_socket = evhttp_bound_socket_get_fd(info);
                 }
 
-                Server::Server(evutil_socket_t socket, ServerHandler const &handler, Methods const &allowedMethods,
+                Server::Server(evutil_socket_t socket, ServerAsyncHandler const &handler,
+                        Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                         std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
-                    : Server{handler, allowedMethods, headersSize, bodySize, requestTimeout}
+                    : Server{handler, std::move(handlersPool), allowedMethods, headersSize, bodySize, requestTimeout}
                 {
                     if (socket == -1)
                         throw std::invalid_argument{"[Mif::Net::Http::Detail::Server] Invalid input socket."};
@@ -95,6 +102,9 @@ namespace Mif
                     {
                         MIF_LOG(Error) << "[Mif::Net::Http::Detail::Server] Failed to stop server item. Error: unknown.";
                     }
+
+                    // The responses which are still alive must not touch the event base after it is freed.
+                    m_dispatcher->Close();
                 }
 
                 evutil_socket_t Server::GetSocket() const
@@ -110,6 +120,8 @@ namespace Mif
 
                     m_isRun = true;
 
+                    m_dispatcher->SetLoopThread();
+
                     while (m_isActive)
                     {
                         auto code = event_base_loop(m_base.get(), 0);
@@ -130,6 +142,19 @@ namespace Mif
 
                     m_isActive = false;
 
+                    // The loop keeps running a while to send the responses which are being prepared by the handlers.
+                    for (auto const deadline = std::chrono::steady_clock::now() + m_drainTimeout ;
+                            m_pending && m_isRun && std::chrono::steady_clock::now() < deadline ; )
+                    {
+                        std::this_thread::sleep_for(std::chrono::microseconds{m_waitPeriod});
+                    }
+
+                    if (m_pending)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server::Stop] "
+                            << m_pending << " response(s) will not be sent.";
+                    }
+
                     if (event_base_loopbreak(m_base.get()))
                     {
                         throw std::runtime_error{"[Mif::Net::Http::Detail::Server::Stop] "
@@ -158,7 +183,7 @@ namespace Mif
 
                     auto *self = reinterpret_cast<Server*>(arg);
 
-                    if (event_base_got_break(self->m_base.get()))
+                    if (!self->m_isActive || event_base_got_break(self->m_base.get()))
                     {
                         MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server::OnRequest] "
                             << "Message loop was stopped. The request will not be processed.";
@@ -170,46 +195,78 @@ namespace Mif
 
                 void Server::OnRequest(evhttp_request *req)
                 {
+                    IInputPackPtr in;
+                    std::shared_ptr<AsyncOutputPack> out;
+
                     try
                     {
-                        auto in = std::make_shared<InputPack >(req);
-                        auto out = std::make_shared<OutputPack>(req);
-                        ServerHandler handler{m_handler};
-                        try
-                        {
-                            handler(*in, *out);
-                            out->Send();
-                        }
-                        catch (std::exception const &e)
-                        {
-                            MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server] "
-                                    << "Failed to process request. Error: " << e.what();
-                            try
-                            {
-                                IOutputPack &pack = *out;
-                                pack.SetHeader(Constants::Header::Response::Connection::Value,
-                                        Constants::Value::Connection::Close::Value);
-                                pack.SetCode(Code::BadMethod);
-                                out->Send();
-                            }
-                            catch (std::exception const &ex)
-                            {
-                                MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server] "
-                                        << "Failed to close connection. Error: " << ex.what();
-                            }
-                        }
+                        in = std::make_shared<InputPack>(req);
+                        out = std::make_shared<AsyncOutputPack>(req, m_dispatcher, [this] () { --m_pending; } );
                     }
                     catch (std::invalid_argument const &e)
                     {
                         std::string reason = "Bad request. ";
                         reason += e.what();
                         evhttp_send_error(req, HTTP_BADREQUEST, reason.c_str());
+                        return;
                     }
                     catch (std::exception const &e)
                     {
                         std::string reason = "Internal server error. ";
                         reason += e.what();
                         evhttp_send_error(req, HTTP_INTERNAL, reason.c_str());
+                        return;
+                    }
+
+                    ++m_pending;
+
+                    if (!m_handlersPool)
+                    {
+                        ProcessRequest(m_handler, std::move(in), std::move(out));
+                        return;
+                    }
+
+                    // The handler is copied to the task, because the server can be stopped before the task is done.
+                    // If the task is not posted, the response is completed with an error when it is released.
+                    try
+                    {
+                        m_handlersPool->Post(std::bind(&Server::ProcessRequest, m_handler, std::move(in), std::move(out)));
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server] "
+                                << "Failed to post request to the handlers pool. Error: " << e.what();
+                    }
+                }
+
+                void Server::ProcessRequest(ServerAsyncHandler const &handler, IInputPackPtr in,
+                        std::shared_ptr<AsyncOutputPack> out)
+                {
+                    try
+                    {
+                        handler(in, out);
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server] "
+                                << "Failed to process request. Error: " << e.what();
+
+                        if (out->IsSent())
+                            return;
+
+                        try
+                        {
+                            IOutputPack &pack = *out;
+                            pack.SetHeader(Constants::Header::Response::Connection::Value,
+                                    Constants::Value::Connection::Close::Value);
+                            pack.SetCode(Code::BadMethod);
+                            out->Send();
+                        }
+                        catch (std::exception const &ex)
+                        {
+                            MIF_LOG(Warning) << "[Mif::Net::Http::Detail::Server] "
+                                    << "Failed to close connection. Error: " << ex.what();
+                        }
                     }
                 }
 
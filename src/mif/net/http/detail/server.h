@@ -10,6 +10,7 @@
 
 // STD
 #include <atomic>
+#include <chrono>
 #include <cstdint>
 #include <memory>
 #include <string>
@@ -19,10 +20,13 @@
 #include <event2/http.h>
 
 // MIF
+#include "mif/common/thread_pool.h"
 #include "mif/net/http/methods.h"
 #include "mif/net/http/request_handler.h"
 
 // THIS
+#include "async_output_pack.h"
+#include "dispatcher.h"
 #include "utility.h"
 
 namespace Mif
@@ -42,9 +46,11 @@ namespace Mif
                     Server(Server &&) = delete;
                     Server& operator = (Server &&) = delete;
 
-                    Server(std::string const &host, std::string const &port, ServerHandler const &handler, Methods const &allowedMethods,
+                    Server(std::string const &host, std::string const &port, ServerAsyncHandler const &handler,
+                            Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                             std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout);
-                    Server(evutil_socket_t socket, ServerHandler const &handler, Methods const &allowedMethods,
+                    Server(evutil_socket_t socket, ServerAsyncHandler const &handler,
+                            Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                             std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout);
 
                     ~Server() noexcept;
@@ -54,26 +60,33 @@ namespace Mif
                     void Stop();
 
                 private:
-                    ServerHandler m_handler;
+                    ServerAsyncHandler m_handler;
+                    Common::IThreadPoolPtr m_handlersPool;
                     evutil_socket_t m_socket = -1;
 
                     using EventPtr = std::unique_ptr<event, decltype(&event_free)>;
                     using HttpPtr = std::unique_ptr<evhttp, decltype(&evhttp_free)>;
 
                     std::uint32_t const m_waitPeriod = 5000;
+                    std::chrono::milliseconds const m_drainTimeout{5000};
 
                     std::atomic<bool> m_isActive{true};
                     std::atomic<bool> m_isRun{false};
+                    std::atomic<std::size_t> m_pending{0};
 
                     Utility::EventBasePtr m_base;
                     HttpPtr m_http{nullptr, &evhttp_free};
+                    std::shared_ptr<Dispatcher> m_dispatcher;
 
-                    Server(ServerHandler const &handler, Methods const &allowedMethods,
+                    Server(ServerAsyncHandler const &handler, Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                             std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout);
 
                     static void OnTimer(evutil_socket_t, short, void *arg);
                     static void OnRequest(evhttp_request *req, void *arg);
                     void OnRequest(evhttp_request *req);
+
+                    static void ProcessRequest(ServerAsyncHandler const &handler, IInputPackPtr in,
+                            std::shared_ptr<AsyncOutputPack> out);
                 };
 
             } // namespace Detail
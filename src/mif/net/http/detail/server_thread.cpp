@@ -21,14 +21,14 @@ namespace Mif
             {
 
                 ServerThread::ServerThread(std::string const &host, std::string const &port,
-                        ServerHandler const &handler, Methods const &allowedMethods,
+                        ServerAsyncHandler const &handler, Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                         std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
                 {
-                    m_thread.reset(new std::thread{[this, &host, &port, &handler, &allowedMethods, &headersSize, &bodySize, &requestTimeout]()
+                    m_thread.reset(new std::thread{[this, &host, &port, &handler, &handlersPool, &allowedMethods, &headersSize, &bodySize, &requestTimeout]()
                             {
                                 try
                                 {
-                                    m_server.reset(new Server{host, port, handler, allowedMethods, headersSize, bodySize, requestTimeout});
+                                    m_server.reset(new Server{host, port, handler, handlersPool, allowedMethods, headersSize, bodySize, requestTimeout});
                                     m_server->Run();
                                 }
                                 catch (...)
@@ -45,14 +45,15 @@ namespace Mif
                         std::rethrow_exception(m_exception);
                 }
 
-                ServerThread::ServerThread(evutil_socket_t socket, ServerHandler const &handler, Methods const &allowedMethods,
+                ServerThread::ServerThread(evutil_socket_t socket, ServerAsyncHandler const &handler,
+                        Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                         std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
                 {
-                    m_thread.reset(new std::thread{[this, &socket, &handler, &allowedMethods, &headersSize, &bodySize, &requestTimeout]()
+                    m_thread.reset(new std::thread{[this, &socket, &handler, &handlersPool, &allowedMethods, &headersSize, &bodySize, &requestTimeout]()
                             {
                                 try
                                 {
-                                    m_server.reset(new Server{socket, handler, allowedMethods, headersSize, bodySize, requestTimeout});
+                                    m_server.reset(new Server{socket, handler, handlersPool, allowedMethods, headersSize, bodySize, requestTimeout});
                                     m_server->Run();
                                 }
                                 catch (...)
@@ -19,6 +19,7 @@
 #include <event2/util.h>
 
 // MIF
+#include "mif/common/thread_pool.h"
 #include "mif/net/http/request_handler.h"
 
 // THIS
@@ -36,10 +37,11 @@ namespace Mif
                 class ServerThread final
                 {
                 public:
-                    ServerThread(std::string const &host, std::string const &port, ServerHandler const &handler,
-                            Methods const &allowedMethods, std::size_t headersSize,
+                    ServerThread(std::string const &host, std::string const &port, ServerAsyncHandler const &handler,
+                            Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods, std::size_t headersSize,
                             std::size_t bodySize, std::size_t requestTimeout);
-                    ServerThread(evutil_socket_t socket, ServerHandler const &handler, Methods const &allowedMethods,
+                    ServerThread(evutil_socket_t socket, ServerAsyncHandler const &handler,
+                            Common::IThreadPoolPtr handlersPool, Methods const &allowedMethods,
                             std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout);
 
                     ~ServerThread();
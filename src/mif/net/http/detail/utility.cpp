@@ -10,6 +10,7 @@
 
 // EVENT
 #include <event2/http.h>
+#include <event2/util.h>
 
 // THIS
 #include "utility.h"
@@ -200,6 +201,22 @@ namespace Mif
                         return base;
                     }
 
+                    IInputPack::View const* FindHeader(IInputPack const &request, char const *name)
+                    {
+                        for (auto const &header : request.GetHeadersView())
+                        {
+                            if (IsEqual(header.name, name))
+                                return &header.value;
+                        }
+
+                        return nullptr;
+                    }
+
+                    bool IsEqual(IInputPack::View const &value, char const *str)
+                    {
+                        return value.size == std::strlen(str) && !evutil_ascii_strncasecmp(value.data, str, value.size);
+                    }
+
                 }   // namespace Utility
 
             }   // namespace Detail
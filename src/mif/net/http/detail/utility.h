@@ -9,6 +9,7 @@
 #define __MIF_NET_HTTP_DETAIL_UTILITY_H__
 
 // STD
+#include <cstring>
 #include <memory>
 
 // EVENT
@@ -16,6 +17,7 @@
 
 // MIF
 #include "mif/net/http/codes.h"
+#include "mif/net/http/iinput_pack.h"
 #include "mif/net/http/methods.h"
 
 namespace Mif
@@ -40,6 +42,10 @@ namespace Mif
 
                     EventBasePtr CreateEventBase();
 
+                    // The header names and the values below are compared case-insensitively.
+                    IInputPack::View const* FindHeader(IInputPack const &request, char const *name);
+                    bool IsEqual(IInputPack::View const &value, char const *str);
+
                 }   // namespace Utility
 
             }   // namespace Detail
@@ -0,0 +1,251 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <algorithm>
+#include <iterator>
+#include <stdexcept>
+
+// MIF
+#include "mif/net/http/router.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Http
+        {
+
+            // C++11 needs the definitions of the constants which are bound to references.
+            constexpr std::size_t Router::MaxParams;
+            constexpr std::size_t Router::None;
+
+            struct Router::State
+            {
+                Match *match;
+                Param params[MaxParams];
+                std::size_t count = 0;
+                bool hasPrefix = false;
+                std::size_t prefixEnd = 0;
+
+                void Set(Node const &node)
+                {
+                    match->m_index = node.index;
+                    match->m_route = &node.route;
+                    match->m_count = count;
+                    std::copy(params, params + count, match->m_params);
+                }
+            };
+
+            Router::Index Router::Match::GetIndex() const
+            {
+                return m_index;
+            }
+
+            std::string const& Router::Match::GetRoute() const
+            {
+                if (!m_route)
+                    throw std::logic_error{"[Mif::Net::Http::Router::Match::GetRoute] No route is matched."};
+
+                return *m_route;
+            }
+
+            std::size_t Router::Match::GetParamsCount() const
+            {
+                return m_count;
+            }
+
+            Router::Param const& Router::Match::GetParam(std::size_t index) const
+            {
+                if (index >= m_count)
+                {
+                    throw std::out_of_range{"[Mif::Net::Http::Router::Match::GetParam] "
+                            "Index " + std::to_string(index) + " is out of range."};
+                }
+
+                return m_params[index];
+            }
+
+            bool Router::Add(std::string const &route, Index index)
+            {
+                std::size_t node = 0;
+                std::size_t params = 0;
+
+                for (std::size_t pos = 0 ; pos < route.size() ; )
+                {
+                    if (route[pos] == '/')
+                    {
+                        ++pos;
+                        continue;
+                    }
+
+                    auto end = route.find('/', pos);
+                    if (end == std::string::npos)
+                        end = route.size();
+
+                    auto const segment = route.substr(pos, end - pos);
+                    pos = end;
+
+                    if (segment.front() == '{')
+                    {
+                        if (segment.size() < 3 || segment.back() != '}')
+                        {
+                            throw std::invalid_argument{"[Mif::Net::Http::Router::Add] "
+                                    "Bad parameter \"" + segment + "\" in route \"" + route + "\"."};
+                        }
+
+                        if (++params > MaxParams)
+                        {
+                            throw std::invalid_argument{"[Mif::Net::Http::Router::Add] "
+                                    "Too many parameters in route \"" + route + "\". "
+                                    "Max count is " + std::to_string(MaxParams) + "."};
+                        }
+
+                        auto const name = segment.substr(1, segment.size() - 2);
+
+                        if (m_nodes[node].param == None)
+                        {
+                            auto const child = m_nodes.size();
+                            m_nodes.emplace_back();
+                            m_nodes[node].param = child;
+                            m_nodes[node].paramName = name;
+                        }
+                        else if (m_nodes[node].paramName != name)
+                        {
+                            throw std::invalid_argument{"[Mif::Net::Http::Router::Add] "
+                                    "Parameter \"" + name + "\" in route \"" + route + "\" conflicts with "
+                                    "parameter \"" + m_nodes[node].paramName + "\" of another route."};
+                        }
+
+                        node = m_nodes[node].param;
+                        continue;
+                    }
+
+                    auto child = FindChild(m_nodes[node], segment.c_str(), segment.size());
+                    if (child == None)
+                    {
+                        child = m_nodes.size();
+                        m_nodes.emplace_back();
+                        m_nodes.back().segment = segment;
+
+                        auto &children = m_nodes[node].children;
+                        auto const iter = std::lower_bound(std::begin(children), std::end(children), segment,
+                                [this] (std::size_t item, std::string const &value)
+                                {
+                                    return m_nodes[item].segment < value;
+                                }
+                            );
+                        children.insert(iter, child);
+                    }
+
+                    node = child;
+                }
+
+                auto &item = m_nodes[node];
+                if (item.hasRoute)
+                    return false;
+
+                item.hasRoute = true;
+                item.index = index;
+                item.route = route;
+
+                return true;
+            }
+
+            bool Router::Find(char const *path, std::size_t size, Match &match) const
+            {
+                State state;
+                state.match = &match;
+                return Find(0, path, 0, size, false, state);
+            }
+
+            bool Router::Find(std::string const &path, Match &match) const
+            {
+                return Find(path.c_str(), path.size(), match);
+            }
+
+            bool Router::FindPrefix(char const *path, std::size_t size, Match &match) const
+            {
+                State state;
+                state.match = &match;
+                return Find(0, path, 0, size, true, state) || state.hasPrefix;
+            }
+
+            bool Router::FindPrefix(std::string const &path, Match &match) const
+            {
+                return FindPrefix(path.c_str(), path.size(), match);
+            }
+
+            bool Router::Empty() const
+            {
+                return m_nodes.size() == 1 && !m_nodes.front().hasRoute;
+            }
+
+            std::size_t Router::FindChild(Node const &node, char const *segment, std::size_t size) const
+            {
+                auto const &children = node.children;
+                auto const iter = std::lower_bound(std::begin(children), std::end(children), 0,
+                        [this, segment, size] (std::size_t item, int)
+                        {
+                            return m_nodes[item].segment.compare(0, std::string::npos, segment, size) < 0;
+                        }
+                    );
+
+                if (iter == std::end(children) || m_nodes[*iter].segment.compare(0, std::string::npos, segment, size))
+                    return None;
+
+                return *iter;
+            }
+
+            bool Router::Find(std::size_t node, char const *path, std::size_t pos, std::size_t size,
+                    bool prefix, State &state) const
+            {
+                while (pos < size && path[pos] == '/')
+                    ++pos;
+
+                auto const &item = m_nodes[node];
+
+                if (pos == size)
+                {
+                    if (!item.hasRoute)
+                        return false;
+
+                    state.Set(item);
+                    return true;
+                }
+
+                // A longer prefix ends farther in the path. The first one found at the same position
+                // wins, because the static segments are tried before the parameters.
+                if (prefix && item.hasRoute && (!state.hasPrefix || state.prefixEnd < pos))
+                {
+                    state.hasPrefix = true;
+                    state.prefixEnd = pos;
+                    state.Set(item);
+                }
+
+                auto end = pos;
+                while (end < size && path[end] != '/')
+                    ++end;
+
+                auto const child = FindChild(item, path + pos, end - pos);
+                if (child != None && Find(child, path, end, size, prefix, state))
+                    return true;
+
+                if (item.param != None)
+                {
+                    state.params[state.count++] = {&item.paramName, path + pos, end - pos};
+                    if (Find(item.param, path, end, size, prefix, state))
+                        return true;
+                    --state.count;
+                }
+
+                return false;
+            }
+
+        }   // namespace Http
+    }   // namespace Net
+}   // namespace Mif
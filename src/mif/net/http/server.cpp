@@ -7,9 +7,12 @@
 
 // STD
 #include <functional>
+#include <memory>
+#include <utility>
 #include <vector>
 
 // MIF
+#include "mif/net/http/router.h"
 #include "mif/net/http/server.h"
 
 // THIS
@@ -27,11 +30,14 @@ namespace Mif
             {
             public:
                 Impl(std::string const &host, std::string const &port,
-                        std::uint16_t workers, ServerHandlers const &handlers, Methods const &allowedMethods,
-                        std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
-                    : m_handlers{handlers}
+                        std::uint16_t workers, ServerHandlers const &handlers,
+                        ServerAsyncHandlers const &asyncHandlers, Common::IThreadPoolPtr handlersPool,
+                        Methods const &allowedMethods, std::size_t headersSize, std::size_t bodySize,
+                        std::size_t requestTimeout)
                 {
-                    auto handler = std::bind(&Impl::OnRequest, this, std::placeholders::_1, std::placeholders::_2);
+                    // The handlers are shared with the tasks which may be still queued in the handlers pool.
+                    HandlersPtr allHandlers{new Handlers{handlers, asyncHandlers}};
+                    auto handler = std::bind(&Impl::OnRequest, allHandlers, std::placeholders::_1, std::placeholders::_2);
 
                     Detail::LibEventInitializer::Init();
 
@@ -43,7 +49,7 @@ namespace Mif
                     {
                         if (socket == -1)
                         {
-                            ItemPtr item{new Detail::ServerThread{host, port, handler,
+                            ItemPtr item{new Detail::ServerThread{host, port, handler, handlersPool,
                                     allowedMethods, headersSize, bodySize, requestTimeout}};
                             socket = item->GetSocket();
                             m_items.push_back(std::move(item));
@@ -51,7 +57,7 @@ namespace Mif
                         else
                         {
                             m_items.push_back(std::move(ItemPtr{new Detail::ServerThread{socket,
-                                handler, allowedMethods, headersSize, bodySize, requestTimeout}}));
+                                handler, handlersPool, allowedMethods, headersSize, bodySize, requestTimeout}}));
                         }
                     }
                 }
@@ -60,39 +66,61 @@ namespace Mif
                 using ItemPtr = std::unique_ptr<Detail::ServerThread>;
                 using Items = std::vector<ItemPtr>;
 
-                ServerHandlers m_handlers;
+                // The synchronous handler is taken if both kinds are registered for the same resource.
+                struct Handlers
+                {
+                    struct Item
+                    {
+                        ServerHandler handler;
+                        ServerAsyncHandler asyncHandler;
+                    };
+
+                    std::vector<Item> items;
+                    Router router;
+
+                    Handlers(ServerHandlers const &handlers, ServerAsyncHandlers const &asyncHandlers)
+                    {
+                        items.reserve(handlers.size() + asyncHandlers.size());
+
+                        for (auto const &i : handlers)
+                        {
+                            if (router.Add(i.first, items.size()))
+                                items.push_back({i.second, {}});
+                        }
+
+                        for (auto const &i : asyncHandlers)
+                        {
+                            if (router.Add(i.first, items.size()))
+                                items.push_back({{}, i.second});
+                        }
+                    }
+                };
+
+                using HandlersPtr = std::shared_ptr<Handlers const>;
 
                 Items m_items;
 
-                void OnRequest(IInputPack const &in, IOutputPack &out)
+                static void OnRequest(HandlersPtr const &allHandlers, IInputPackPtr in, IAsyncOutputPackPtr out)
                 {
-                    auto process = [this, &in, &out] (std::string const &path)
-                            {
-                                auto iter = m_handlers.find(path);
-                                if (iter != std::end(m_handlers))
-                                {
-                                    iter->second(in, out);
-                                    return true;
-                                }
-                                return false;
-                            };
-
-                    auto url = in.GetPath();
-                    if (process(url))
-                        return;
-                    if (!url.empty() && url.back() != '/')
-                    url.append("/");
-                    for (auto pos = url.find_last_of('/') ; pos != std::string::npos ; pos = url.find_last_of('/'))
+                    // A resource handles its path and all the paths below it.
+                    auto const path = in->GetPath();
+                    Router::Match match;
+                    if (!allHandlers->router.FindPrefix(path, match))
                     {
-                        url = url.substr(0, pos);
-                        auto const path = url.empty() ? std::string{"/"} : url;
-
-                        if (process(path))
-                            return;
+                        throw std::runtime_error{"[Mif::Net::Http::Server::Impl] Failed to process request. "
+                                "Handler for resource \"" + path + "\" not found."};
                     }
 
-                    throw std::runtime_error{"[Mif::Net::Http::Server::Impl] Failed to process request. "
-                            "Handler for resource \"" + in.GetPath() + "\" not found."};
+                    auto const &item = allHandlers->items[match.GetIndex()];
+                    if (item.handler)
+                    {
+                        item.handler(*in, *out);
+                        out->Send();
+                    }
+                    else
+                    {
+                        item.asyncHandler(in, out);
+                    }
                 }
             };
 
@@ -100,7 +128,16 @@ namespace Mif
             Server::Server(std::string const &host, std::string const &port,
                 std::uint16_t workers, Methods const &allowedMethods, ServerHandlers const &handlers,
                 std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
-                : m_impl{new Impl{host, port, workers, handlers, allowedMethods, headersSize, bodySize, requestTimeout}}
+                : m_impl{new Impl{host, port, workers, handlers, {}, {}, allowedMethods, headersSize, bodySize, requestTimeout}}
+            {
+            }
+
+            Server::Server(std::string const &host, std::string const &port,
+                std::uint16_t workers, Methods const &allowedMethods, ServerHandlers const &handlers,
+                ServerAsyncHandlers const &asyncHandlers, Common::IThreadPoolPtr handlersPool,
+                std::size_t headersSize, std::size_t bodySize, std::size_t requestTimeout)
+                : m_impl{new Impl{host, port, workers, handlers, asyncHandlers, std::move(handlersPool),
+                        allowedMethods, headersSize, bodySize, requestTimeout}}
             {
             }
 
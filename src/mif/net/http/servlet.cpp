@@ -18,14 +18,14 @@
 #include <boost/date_time/posix_time/posix_time.hpp>
 #include <boost/scope_exit.hpp>
 
-// EVENT
-#include <event2/util.h>
-
 // MIF
 #include "mif/common/log.h"
 #include "mif/net/http/constants.h"
 #include "mif/net/http/servlet.h"
 
+// THIS
+#include "detail/utility.h"
+
 namespace Mif
 {
     namespace Net
@@ -190,11 +190,11 @@ namespace Mif
 
                             try
                             {
-                                auto const headers = request.GetHeaders();
                                 {
-                                    auto const iter = headers.find(Constants::Header::MifExt::Session::Value);
-                                    if (iter != std::end(headers))
-                                        sessionId = iter->second;
+                                    auto const *session = Detail::Utility::FindHeader(request,
+                                            Constants::Header::MifExt::Session::Value);
+                                    if (session)
+                                        sessionId = session->ToString();
                                     else
                                         throw std::invalid_argument{"Session not found."};
                                     if (sessionId.empty())
@@ -235,7 +235,8 @@ namespace Mif
                                     if (!session->NeedForClose())
                                     {
                                         response.SetHeader(Constants::Header::MifExt::Session::Value, sessionId);
-                                        SetKeepAliveFromClient(headers, response);
+                                        SetRequestIdFromClient(request, response);
+                                        SetKeepAliveFromClient(request, response);
                                     }
                                     else
                                     {
@@ -294,12 +295,19 @@ namespace Mif
                         LockType m_lock;
                         Sessions m_sessions;
 
-                        void SetKeepAliveFromClient(IInputPack::Headers const &requestHeaders, IOutputPack &response) const
+                        void SetRequestIdFromClient(IInputPack const &request, IOutputPack &response) const
                         {
-                            auto const iter = requestHeaders.find(Constants::Header::Request::Connection::Value);
-                            if (iter == std::end(requestHeaders) && !iter->second.empty())
-                                return;
-                            if (!iter->second.empty() && !evutil_ascii_strcasecmp(iter->second.c_str(), "keep-alive"))
+                            auto const *requestId = Detail::Utility::FindHeader(request,
+                                    Constants::Header::MifExt::Request::Value);
+                            if (requestId)
+                                response.SetHeader(Constants::Header::MifExt::Request::Value, requestId->ToString());
+                        }
+
+                        void SetKeepAliveFromClient(IInputPack const &request, IOutputPack &response) const
+                        {
+                            auto const *connection = Detail::Utility::FindHeader(request,
+                                    Constants::Header::Request::Connection::Value);
+                            if (connection && Detail::Utility::IsEqual(*connection, "keep-alive"))
                             {
                                 response.SetHeader(Constants::Header::Response::Connection::Value,
                                         Constants::Value::Connection::KeepAlive::Value);
@@ -5,14 +5,14 @@
 //  Copyright (C) 2016-2018 tdv
 //-------------------------------------------------------------------
 
-// C
-#include <string.h>
-
 // MIF
 #include "mif/common/log.h"
 #include "mif/common/unused.h"
 #include "mif/net/http/web_service.h"
 
+// THIS
+#include "detail/utility.h"
+
 namespace Mif
 {
     namespace Net
@@ -32,32 +32,29 @@ namespace Mif
                     PreProcessRequest(request);
                     ++m_statistics.general.total;
                     auto const path = request.GetPath();
-                    auto const iter = m_handlers.find(path);
-                    if (iter != std::end(m_handlers))
+                    Router::Match match;
+                    if (m_router.Find(path, match))
                     {
+                        auto const &handler = m_handlers[match.GetIndex()];
                         try
                         {
-                            ++m_statistics.resources[path].total;
-                            iter->second->OnRequest(request, response);
+                            ++handler.counter->total;
+                            RequestContext context{request, match};
+                            handler.handler->OnRequest(context, response);
                             {
-                                auto const headers = request.GetHeaders();
-                                auto const keepAlive = headers.find(Constants::Header::Request::Connection::Value);
-                                if (keepAlive != std::end(headers))
+                                auto const *keepAlive = Detail::Utility::FindHeader(request,
+                                        Constants::Header::Request::Connection::Value);
+                                if (keepAlive && Detail::Utility::IsEqual(*keepAlive,
+                                        Constants::Value::Connection::KeepAlive::Value))
                                 {
-                                    auto const &value = keepAlive->second;
-                                    auto const *keepAliveValue = Constants::Value::Connection::KeepAlive::Value;
-                                    auto const len = strlen(keepAliveValue);
-                                    if (value.length() == len && !strncasecmp(value.c_str(),  keepAliveValue, len))
-                                    {
-                                        response.SetHeader(Constants::Header::Response::Connection::Value,
-                                                Constants::Value::Connection::KeepAlive::Value);
-                                    }
+                                    response.SetHeader(Constants::Header::Response::Connection::Value,
+                                            Constants::Value::Connection::KeepAlive::Value);
                                 }
                             }
                         }
                         catch (...)
                         {
-                            ++m_statistics.resources[path].bad;
+                            ++handler.counter->bad;
                             throw;
                         }
                     }
@@ -96,6 +93,52 @@ namespace Mif
                 }
             }
 
+            WebService::RequestContext::RequestContext(IInputPack const &request, Router::Match const &match)
+                : m_request{request}
+                , m_match{match}
+            {
+            }
+
+            IInputPack const& WebService::RequestContext::GetRequest() const
+            {
+                return m_request;
+            }
+
+            Router::Match const& WebService::RequestContext::GetMatch() const
+            {
+                return m_match;
+            }
+
+            IInputPack::Params const& WebService::RequestContext::GetParams()
+            {
+                if (!m_params)
+                {
+                    m_params.reset(new IInputPack::Params{m_request.GetParams()});
+
+                    for (std::size_t i = 0 ; i < m_match.GetParamsCount() ; ++i)
+                    {
+                        auto const &param = m_match.GetParam(i);
+                        (*m_params)[*param.name].assign(param.value, param.size);
+                    }
+                }
+
+                return *m_params;
+            }
+
+            IInputPack::Headers const& WebService::RequestContext::GetHeaders()
+            {
+                if (!m_headers)
+                    m_headers.reset(new IInputPack::Headers{m_request.GetHeaders()});
+                return *m_headers;
+            }
+
+            Common::Buffer const& WebService::RequestContext::GetData()
+            {
+                if (!m_data)
+                    m_data.reset(new Common::Buffer{m_request.GetData()});
+                return *m_data;
+            }
+
             void WebService::OnExceptionResponse(IInputPack const &request, IOutputPack &response,
                                                  Code code, std::exception_ptr exception)
             {
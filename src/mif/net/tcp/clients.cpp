@@ -6,6 +6,8 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <atomic>
+#include <cstddef>
 #include <cstdlib>
 #include <stdexcept>
 #include <thread>
@@ -98,7 +100,7 @@ namespace Mif
                         boost::asio::ip::tcp::socket socket{m_ioService};
                         boost::asio::ip::tcp::resolver resolver{m_ioService};
                         boost::asio::connect(socket, resolver.resolve({host, port}));
-                        return std::make_shared<Detail::Session>(std::move(socket), *m_factory)->Start();
+                        return std::make_shared<Detail::Session>(std::move(socket), *m_factory, m_load, m_pool)->Start();
                     }
                     catch (std::exception const &e)
                     {
@@ -109,6 +111,8 @@ namespace Mif
 
             private:
                 std::shared_ptr<IClientFactory> m_factory;
+                std::atomic<std::size_t> m_load{0};
+                Detail::BufferPool m_pool{8192};
                 boost::asio::io_service m_ioService;
                 std::unique_ptr<std::thread> m_thread;
                 boost::asio::io_service::work m_work;
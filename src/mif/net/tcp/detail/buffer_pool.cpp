@@ -0,0 +1,98 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <iterator>
+#include <stdexcept>
+#include <utility>
+
+// THIS
+#include "buffer_pool.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Tcp
+        {
+            namespace Detail
+            {
+
+                BufferPool::BufferPool(std::size_t bufferSize, std::size_t maxFreeBuffers)
+                    : m_bufferSize{bufferSize}
+                    , m_maxFreeBuffers{maxFreeBuffers}
+                {
+                    if (!m_bufferSize)
+                        throw std::invalid_argument{"[Mif::Net::Tcp::Detail::BufferPool] Buffer size must be greater than 0."};
+                }
+
+                Common::Buffer BufferPool::Get()
+                {
+                    {
+                        LockGuard lock{m_lock};
+                        if (!m_free.empty())
+                        {
+                            auto buffer = std::move(m_free.back());
+                            m_free.pop_back();
+                            ++m_reused;
+                            return buffer;
+                        }
+                    }
+
+                    ++m_allocated;
+                    return Common::Buffer(m_bufferSize);
+                }
+
+                void BufferPool::Put(Common::Buffer buffer)
+                {
+                    if (buffer.capacity() == 0)
+                        return;
+
+                    // Too large buffers are not kept, they would hold the memory of a single big message.
+                    if (buffer.capacity() >= m_bufferSize && buffer.capacity() <= 2 * m_bufferSize)
+                    {
+                        buffer.resize(m_bufferSize);
+                        LockGuard lock{m_lock};
+                        if (m_free.size() < m_maxFreeBuffers)
+                        {
+                            m_free.push_back(std::move(buffer));
+                            return;
+                        }
+                    }
+
+                    ++m_dropped;
+                }
+
+                Common::Buffer BufferPool::HandOver(Common::Buffer &buffer, std::size_t length)
+                {
+                    if (length > buffer.size())
+                        throw std::invalid_argument{"[Mif::Net::Tcp::Detail::BufferPool::HandOver] Length is out of the buffer."};
+
+                    // A new buffer for the next read costs more than a copy of a few bytes,
+                    // and a whole buffer would be held by every small message in the handlers.
+                    if (length < m_bufferSize / 2)
+                    {
+                        ++m_copied;
+                        return {std::begin(buffer), std::next(std::begin(buffer), length)};
+                    }
+
+                    ++m_handedOver;
+                    Common::Buffer data;
+                    data.swap(buffer);
+                    data.resize(length);
+                    return data;
+                }
+
+                BufferPool::Counters BufferPool::GetCounters() const
+                {
+                    return {m_allocated, m_reused, m_handedOver, m_copied, m_dropped};
+                }
+
+            }   // namespace Detail
+        }   // namespace Tcp
+    }   // namespace Net
+}   // namespace Mif
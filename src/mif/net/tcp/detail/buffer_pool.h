@@ -0,0 +1,83 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_NET_TCP_DETAIL_BUFFER_POOL_H__
+#define __MIF_NET_TCP_DETAIL_BUFFER_POOL_H__
+
+// STD
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <vector>
+
+// MIF
+#include "mif/common/types.h"
+
+namespace Mif
+{
+    namespace Net
+    {
+        namespace Tcp
+        {
+            namespace Detail
+            {
+
+                // Read buffers of the sessions. A buffer which is filled by a read goes to the
+                // data handler as is, a few bytes are copied out and the buffer stays for the next
+                // read. The buffers of the written data come back to the pool when they fit.
+                class BufferPool final
+                {
+                public:
+                    struct Counters
+                    {
+                        std::uint64_t allocated;
+                        std::uint64_t reused;
+                        std::uint64_t handedOver;
+                        std::uint64_t copied;
+                        std::uint64_t dropped;
+                    };
+
+                    BufferPool(std::size_t bufferSize, std::size_t maxFreeBuffers = 256);
+
+                    BufferPool(BufferPool const &) = delete;
+                    BufferPool(BufferPool &&) = delete;
+                    BufferPool& operator = (BufferPool const &) = delete;
+                    BufferPool& operator = (BufferPool &&) = delete;
+
+                    Common::Buffer Get();
+                    void Put(Common::Buffer buffer);
+
+                    // Returns the first length bytes of the buffer. The buffer is empty after that
+                    // if it is moved to the result.
+                    Common::Buffer HandOver(Common::Buffer &buffer, std::size_t length);
+
+                    Counters GetCounters() const;
+
+                private:
+                    using LockType = std::mutex;
+                    using LockGuard = std::lock_guard<LockType>;
+
+                    std::size_t const m_bufferSize;
+                    std::size_t const m_maxFreeBuffers;
+
+                    LockType m_lock;
+                    std::vector<Common::Buffer> m_free;
+
+                    std::atomic<std::uint64_t> m_allocated{0};
+                    std::atomic<std::uint64_t> m_reused{0};
+                    std::atomic<std::uint64_t> m_handedOver{0};
+                    std::atomic<std::uint64_t> m_copied{0};
+                    std::atomic<std::uint64_t> m_dropped{0};
+                };
+
+            }   // namespace Detail
+        }   // namespace Tcp
+    }   // namespace Net
+}   // namespace Mif
+
+#endif  // !__MIF_NET_TCP_DETAIL_BUFFER_POOL_H__
@@ -9,6 +9,7 @@
 #include <cstdint>
 #include <stdexcept>
 #include <utility>
+#include <vector>
 
 // BOOST
 #include <boost/asio.hpp>
@@ -28,10 +29,20 @@ namespace Mif
             namespace Detail
             {
 
-                Session::Session(boost::asio::ip::tcp::socket socket, IClientFactory &factory)
+                Session::Session(boost::asio::ip::tcp::socket socket, IClientFactory &factory,
+                        std::atomic<std::size_t> &load, BufferPool &pool)
                     : m_socket{std::move(socket)}
                     , m_factory{factory}
+                    , m_load{load}
+                    , m_pool{pool}
                 {
+                    ++m_load;
+                }
+
+                Session::~Session()
+                {
+                    m_pool.Put(std::move(m_readBuffer));
+                    --m_load;
                 }
 
                 IClientFactory::ClientPtr Session::Start()
@@ -55,17 +66,36 @@ namespace Mif
 
                         m_socket.get_io_service().post([self, data] ()
                                 {
-                                    boost::asio::async_write(self->m_socket, boost::asio::buffer(*data),
-                                            [self, data] (boost::system::error_code error, std::size_t /*length*/)
-                                            {
-                                                if (error)
-                                                {
-                                                    MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::Publisher]. "
-                                                        << "Failed to write data. Error: " << error.message();
-                                                    self->CloseMe();
-                                                }
-                                            }
-                                        );
+                                    self->m_outgoing.push_back(std::move(*data));
+                                    if (self->m_writing.empty())
+                                        self->DoWrite();
+                                }
+                            );
+                    }
+                    catch (std::exception const &e)
+                    {
+                        CloseMe();
+                        MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::Publisher]. "
+                            << "Failed to publish data. Error: " << e.what();
+                    }
+                }
+
+                void Session::Publish(Common::Buffer header, Common::Buffer payload)
+                {
+                    try
+                    {
+                        auto self = shared_from_this();
+
+                        auto data = std::make_shared<std::pair<Common::Buffer, Common::Buffer>>(
+                                std::move(header), std::move(payload));
+
+                        // Both buffers are queued by one task, so they go out side by side in one gather write.
+                        m_socket.get_io_service().post([self, data] ()
+                                {
+                                    self->m_outgoing.push_back(std::move(data->first));
+                                    self->m_outgoing.push_back(std::move(data->second));
+                                    if (self->m_writing.empty())
+                                        self->DoWrite();
                                 }
                             );
                     }
@@ -105,37 +135,72 @@ namespace Mif
                         );
                 }
 
+                void Session::DoWrite()
+                {
+                    // All buffers published while the previous write was in progress
+                    // are sent by one gather write.
+                    std::vector<boost::asio::const_buffer> buffers;
+                    buffers.reserve(m_outgoing.size());
+                    while (!m_outgoing.empty())
+                    {
+                        m_writing.push_back(std::move(m_outgoing.front()));
+                        m_outgoing.pop_front();
+                        buffers.push_back(boost::asio::buffer(m_writing.back()));
+                    }
+
+                    auto self = shared_from_this();
+                    boost::asio::async_write(m_socket, buffers,
+                            [self] (boost::system::error_code error, std::size_t /*length*/)
+                            {
+                                for (auto &i : self->m_writing)
+                                    self->m_pool.Put(std::move(i));
+                                self->m_writing.clear();
+                                if (error)
+                                {
+                                    MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::DoWrite]. "
+                                        << "Failed to write data. Error: " << error.message();
+                                    self->m_outgoing.clear();
+                                    self->CloseMe();
+                                    return;
+                                }
+                                if (!self->m_outgoing.empty())
+                                    self->DoWrite();
+                            }
+                        );
+                }
+
                 void Session::DoRead()
                 {
-                    auto buffer = std::make_shared<Common::Buffer>(8192);   // TODO: parametrize it
+                    // The buffer stays for the next read if its data is copied out.
+                    if (m_readBuffer.empty())
+                        m_readBuffer = m_pool.Get();
                     auto self = shared_from_this();
-                    m_socket.async_read_some(boost::asio::buffer(*buffer),
-                        [self, buffer] (boost::system::error_code error, std::size_t length)
+                    m_socket.async_read_some(boost::asio::buffer(m_readBuffer),
+                        [self] (boost::system::error_code error, std::size_t length)
                         {
                             try
                             {
                                 if (!error)
                                 {
-                                    self->m_socket.get_io_service().post([self, length, buffer] ()
-                                            {
-                                                try
-                                                {
-                                                    auto begin = std::begin(*buffer);
-                                                    auto end = begin;
-                                                    std::advance(end, length);
-                                                    self->m_client->OnData({begin, end});
-                                                }
-                                                catch (std::exception const &e)
-                                                {
-                                                    MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::DoRead]. "
-                                                        << "Failed to process data. Error: " << e.what();
-                                                }
-                                            }
-                                        );
+                                    auto data = self->m_pool.HandOver(self->m_readBuffer, length);
+
                                     self->DoRead();
+
+                                    // The handler is already on the io_service thread. The clients chain
+                                    // hands the data over to the workers, so it is called without a new task.
+                                    try
+                                    {
+                                        self->m_client->OnData(std::move(data));
+                                    }
+                                    catch (std::exception const &e)
+                                    {
+                                        MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::DoRead]. "
+                                            << "Failed to process data. Error: " << e.what();
+                                    }
                                 }
                                 else
                                 {
+                                    self->m_pool.Put(std::move(self->m_readBuffer));
                                     self->CloseMe();
                                     if (error.value() != boost::asio::error::eof)
                                     {
@@ -148,7 +213,7 @@ namespace Mif
                             {
                                 self->CloseMe();
                                 MIF_LOG(Warning) << "[Mif::Net::Tcp::Detail::Session::DoRead]. "
-                                    << "Failed to post task on data processing. Error: " << e.what();
+                                    << "Failed to read data. Error: " << e.what();
                             }
                         }
                     );
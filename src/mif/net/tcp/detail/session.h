@@ -9,7 +9,11 @@
 #define __MIF_NET_TCP_DETAIL_SESSION_H__
 
 // STD
+#include <atomic>
+#include <cstddef>
+#include <deque>
 #include <memory>
+#include <vector>
 
 // BOOST
 #include <boost/asio/ip/tcp.hpp>
@@ -17,6 +21,9 @@
 // MIF
 #include "mif/net/iclient_factory.h"
 
+// THIS
+#include "buffer_pool.h"
+
 namespace Mif
 {
     namespace Net
@@ -32,18 +39,29 @@ namespace Mif
                     , public IControl
                 {
                 public:
-                    Session(boost::asio::ip::tcp::socket socket, IClientFactory &factory);
+                    Session(boost::asio::ip::tcp::socket socket, IClientFactory &factory,
+                            std::atomic<std::size_t> &load, BufferPool &pool);
+
+                    ~Session();
 
                     IClientFactory::ClientPtr Start();
 
                 private:
                     boost::asio::ip::tcp::socket m_socket;
                     IClientFactory &m_factory;
+                    std::atomic<std::size_t> &m_load;
+                    BufferPool &m_pool;
                     IClientFactory::ClientPtr m_client;
 
+                    // Only for the io_service thread
+                    Common::Buffer m_readBuffer;
+                    std::deque<Common::Buffer> m_outgoing;
+                    std::vector<Common::Buffer> m_writing;
+
                     //----------------------------------------------------------------------------
                     // IPublisher
                     virtual void Publish(Common::Buffer buffer) override;
+                    virtual void Publish(Common::Buffer header, Common::Buffer payload) override;
 
                     //----------------------------------------------------------------------------
                     // IControl
@@ -51,6 +69,7 @@ namespace Mif
 
                     //----------------------------------------------------------------------------
                     void DoRead();
+                    void DoWrite();
                 };
 
             }   // namespace Detail
@@ -6,16 +6,22 @@
 //-------------------------------------------------------------------
 
 // STD
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <cstdlib>
+#include <memory>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 // BOOST
 #include <boost/asio.hpp>
 
 // MIF
 #include "mif/common/log.h"
+#include "mif/common/unused.h"
 #include "mif/net/tcp/server.h"
 
 // THIS
@@ -31,36 +37,67 @@ namespace Mif
             class Server::Impl final
             {
             public:
-                Impl(std::string const &host, std::string const &port, IClientFactoryPtr factory)
+                Impl(std::string const &host, std::string const &port, IClientFactoryPtr factory,
+                        std::uint16_t ioThreads, Balancing balancing, bool reusePort,
+                        std::size_t readBufferSize)
                 try
                     : m_factory{factory}
-                    , m_acceptor{m_ioService,
-                            [this, &host, &port] () -> boost::asio::ip::tcp::endpoint
-                            {
-                                boost::asio::ip::tcp::resolver resolver{m_ioService};
-                                return *resolver.resolve({host, port});
-                            } ()
-                        }
-                    , m_socket{m_ioService}
-                    , m_work{m_ioService}
+                    , m_balancing{balancing}
                 {
-                    m_thread.reset(new std::thread([this] ()
-                            {
-                                try
-                                {
-                                    m_ioService.run();
-                                }
-                                catch (std::exception const &e)
+                    try
+                    {
+                        if (!ioThreads)
+                            throw std::invalid_argument{"The count of io threads must be greater than 0."};
+
+                        for (std::uint16_t i = 0 ; i < ioThreads ; ++i)
+                            m_reactors.emplace_back(new Reactor{readBufferSize});
+
+                        auto const endpoint = [this, &host, &port] () -> boost::asio::ip::tcp::endpoint
                                 {
-                                    MIF_LOG(Fatal) << "[Mif::Net::Tcp::Server::Impl] Failed to run io_service. "
-                                            << "Error: " << e.what();
-                                    std::exit(EXIT_FAILURE);
-                                }
-                            }
-                        )
-                    );
+                                    boost::asio::ip::tcp::resolver resolver{m_reactors.front()->ioService};
+                                    return *resolver.resolve({host, port});
+                                } ();
 
-                    DoAccept();
+                        if (reusePort)
+                        {
+                            for (auto &reactor : m_reactors)
+                                m_acceptors.emplace_back(new Acceptor{CreateReusePortAcceptor(reactor->ioService, endpoint), reactor.get()});
+                        }
+                        else
+                        {
+                            m_acceptors.emplace_back(new Acceptor{
+                                    boost::asio::ip::tcp::acceptor{m_reactors.front()->ioService, endpoint}, nullptr
+                                });
+                        }
+
+                        for (auto &reactor : m_reactors)
+                        {
+                            auto &ioService = reactor->ioService;
+                            reactor->thread.reset(new std::thread([&ioService] ()
+                                    {
+                                        try
+                                        {
+                                            ioService.run();
+                                        }
+                                        catch (std::exception const &e)
+                                        {
+                                            MIF_LOG(Fatal) << "[Mif::Net::Tcp::Server::Impl] Failed to run io_service. "
+                                                    << "Error: " << e.what();
+                                            std::exit(EXIT_FAILURE);
+                                        }
+                                    }
+                                )
+                            );
+                        }
+
+                        for (auto &acceptor : m_acceptors)
+                            DoAccept(*acceptor);
+                    }
+                    catch (...)
+                    {
+                        Stop();
+                        throw;
+                    }
                 }
                 catch (std::exception const &e)
                 {
@@ -74,52 +111,135 @@ namespace Mif
 
                 virtual ~Impl()
                 {
-                    try
+                    Stop();
+                }
+
+            private:
+#ifdef SO_REUSEPORT
+                using ReusePort = boost::asio::detail::socket_option::boolean<SOL_SOCKET, SO_REUSEPORT>;
+#endif
+
+                struct Reactor
+                {
+                    Reactor(std::size_t readBufferSize)
+                        : pool{readBufferSize}
                     {
-                        m_ioService.post([this] ()
-                                {
-                                    try
-                                    {
-                                        m_ioService.stop();
-                                    }
-                                    catch (std::exception const &e)
-                                    {
-                                        MIF_LOG(Error) << "[Mif::Net::Tcp::~Server::Impl] Failed to post 'stop' to server object. Error: " << e.what();
-                                    }
-                                }
-                            );
+                    }
+
+                    std::atomic<std::size_t> load{0};
+                    Detail::BufferPool pool;
+                    boost::asio::io_service ioService;
+                    boost::asio::io_service::work work{ioService};
+                    std::unique_ptr<std::thread> thread;
+                };
+
+                using ReactorPtr = std::unique_ptr<Reactor>;
+                using Reactors = std::vector<ReactorPtr>;
+
+                struct Acceptor
+                {
+                    boost::asio::ip::tcp::acceptor acceptor;
+                    // Reactor for all accepted sockets. The sockets are balanced between all reactors if it's empty.
+                    Reactor *reactor;
+                };
+
+                using AcceptorPtr = std::unique_ptr<Acceptor>;
+                using Acceptors = std::vector<AcceptorPtr>;
+
+                std::shared_ptr<IClientFactory> m_factory;
+                Balancing const m_balancing;
+                std::atomic<std::size_t> m_nextReactor{0};
+                Reactors m_reactors;
+                Acceptors m_acceptors;
 
-                        m_thread->join();
+                static boost::asio::ip::tcp::acceptor CreateReusePortAcceptor(boost::asio::io_service &ioService,
+                        boost::asio::ip::tcp::endpoint const &endpoint)
+                {
+#ifdef SO_REUSEPORT
+                    boost::asio::ip::tcp::acceptor acceptor{ioService};
+                    acceptor.open(endpoint.protocol());
+                    acceptor.set_option(boost::asio::ip::tcp::acceptor::reuse_address{true});
+                    acceptor.set_option(ReusePort{true});
+                    acceptor.bind(endpoint);
+                    acceptor.listen();
+                    return acceptor;
+#else
+                    Common::Unused(ioService, endpoint);
+                    throw std::runtime_error{"[Mif::Net::Tcp::Server::Impl::CreateReusePortAcceptor] "
+                        "SO_REUSEPORT is not supported on this platform."};
+#endif
+                }
+
+                void Stop()
+                {
+                    for (auto &reactor : m_reactors)
+                    {
+                        try
+                        {
+                            reactor->ioService.stop();
+                            if (reactor->thread)
+                                reactor->thread->join();
+                        }
+                        catch (std::exception const &e)
+                        {
+                            MIF_LOG(Error) << "[Mif::Net::Tcp::Server::Impl::Stop] Failed to stop io_service. Error: " << e.what();
+                        }
                     }
-                    catch (std::exception const &e)
+
+                    m_acceptors.clear();
+
+                    for (auto &reactor : m_reactors)
                     {
-                        MIF_LOG(Error) << "[Mif::Net::Tcp::~Server::Impl] Failed to stop server. Error: " << e.what();
+                        auto const counters = reactor->pool.GetCounters();
+                        MIF_LOG(Info) << "[Mif::Net::Tcp::Server::Impl::Stop] Read buffers. "
+                                << "Allocated: " << counters.allocated << " "
+                                << "Reused: " << counters.reused << " "
+                                << "Handed over: " << counters.handedOver << " "
+                                << "Copied: " << counters.copied << " "
+                                << "Dropped: " << counters.dropped;
                     }
+
+                    // The pending accept handlers of the first reactor can hold sockets of the others.
+                    for (auto &reactor : m_reactors)
+                        reactor.reset();
+                    m_reactors.clear();
                 }
 
-            private:
-                std::shared_ptr<IClientFactory> m_factory;
-                std::unique_ptr<std::thread> m_thread;
-                boost::asio::io_service m_ioService;
-                boost::asio::ip::tcp::acceptor m_acceptor;
-                boost::asio::ip::tcp::socket m_socket;
-                boost::asio::io_service::work m_work;
+                Reactor& SelectReactor()
+                {
+                    if (m_balancing == Balancing::RoundRobin)
+                        return *m_reactors[m_nextReactor++ % m_reactors.size()];
+
+                    auto iter = std::min_element(std::begin(m_reactors), std::end(m_reactors),
+                            [] (ReactorPtr const &left, ReactorPtr const &right)
+                            {
+                                return left->load < right->load;
+                            }
+                        );
+
+                    return **iter;
+                }
 
-                void DoAccept()
+                void DoAccept(Acceptor &acceptor)
                 {
-                    m_acceptor.async_accept(m_socket,
-                            [this] (boost::system::error_code error)
+                    auto &reactor = acceptor.reactor ? *acceptor.reactor : SelectReactor();
+                    auto socket = std::make_shared<boost::asio::ip::tcp::socket>(reactor.ioService);
+                    acceptor.acceptor.async_accept(*socket,
+                            [this, &acceptor, &reactor, socket] (boost::system::error_code error)
                             {
                                 try
                                 {
+                                    if (error == boost::asio::error::operation_aborted)
+                                        return;
+
                                     if (!error)
-                                        std::make_shared<Detail::Session>(std::move(m_socket), *m_factory)->Start();
+                                        std::make_shared<Detail::Session>(std::move(*socket), *m_factory, reactor.load, reactor.pool)->Start();
                                     else
                                     {
                                         MIF_LOG(Warning) << "[Mif::Net::Tcp::Server::Impl::DoAccept] Failed tp accept connection. "
                                                   << "Error: " << error.message();
                                     }
-                                    DoAccept();
+                                    DoAccept(acceptor);
                                 }
                                 catch (std::exception const &e)
                                 {
@@ -130,8 +250,9 @@ namespace Mif
                 }
             };
 
-            Server::Server(std::string const &host, std::string const &port, IClientFactoryPtr factory)
-                : m_impl{new Impl{host, port, factory}}
+            Server::Server(std::string const &host, std::string const &port, IClientFactoryPtr factory,
+                    std::uint16_t ioThreads, Balancing balancing, bool reusePort, std::size_t readBufferSize)
+                : m_impl{new Impl{host, port, factory, ioThreads, balancing, reusePort, readBufferSize}}
             {
             }
 
@@ -6,10 +6,18 @@
 //-------------------------------------------------------------------
 
 // STD
-#include <map>
+#include <algorithm>
+#include <chrono>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <iterator>
 #include <mutex>
 #include <stdexcept>
 #include <string>
+#include <thread>
+#include <utility>
+#include <vector>
 
 // MIF
 #include "mif/common/log.h"
@@ -28,68 +36,363 @@ namespace Mif
         namespace Detail
         {
             class Pool
-                : public Inherit<IPool>
+                : public Inherit<IPool, IPoolMetrics>
             {
             public:
                 Pool(std::uint32_t limit, Service::IFactoryPtr factory, Service::ServiceId serviceId)
-                    : m_limit{limit}
+                    : Pool(MakeParams(limit), factory, serviceId)
+                {
+                }
+
+                Pool(PoolParams const &params, Service::IFactoryPtr factory, Service::ServiceId serviceId)
+                    : m_params(params)
                     , m_factory{factory}
                     , m_serviceId{serviceId}
                 {
-                    if (!m_limit)
+                    if (!m_params.limit)
                         throw std::invalid_argument{"[Mif::Service::Detail::Pool] The limit must be greater than 0."};
+                    if (m_params.minSize > m_params.limit)
+                        throw std::invalid_argument{"[Mif::Service::Detail::Pool] The min size must not be greater than the limit."};
                     if (!m_factory)
                         throw std::invalid_argument{"[Mif::Service::Detail::Pool] The factory pointer must not be empty."};
+
+                    if (m_params.checkInterval.count() > 0)
+                        m_thread = std::thread{&Pool::Run, this};
+                }
+
+                ~Pool()
+                {
+                    if (!m_thread.joinable())
+                        return;
+
+                    {
+                        LockGuard lock{m_lock};
+                        m_stop = true;
+                    }
+
+                    m_stopped.notify_all();
+
+                    try
+                    {
+                        m_thread.join();
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Service::Detail::Pool::~Pool] Failed to stop background thread. "
+                                << "Error: " << e.what();
+                    }
                 }
 
             private:
-                using Services = std::map<IServicePtr, bool /*is busy*/>;
+                using Clock = std::chrono::steady_clock;
 
                 using LockType = std::mutex;
                 using LockGuard = std::lock_guard<LockType>;
+                using UniqueLock = std::unique_lock<LockType>;
 
-                std::uint32_t m_limit;
+                struct Item
+                {
+                    IServicePtr service;
+                    Clock::time_point lastUsed;
+                    Clock::time_point lastChecked;
+                };
+
+                // The free objects and the slots of the gone ones are handed to the waiters in the order
+                // of their arrival, so a thread which comes later can not take them first.
+                struct Waiter
+                {
+                    std::condition_variable ready;
+                    bool isReady = false;
+                    // It is empty if the waiter is given a slot to create a new object.
+                    IServicePtr service;
+                };
+
+                PoolParams const m_params;
                 Service::IFactoryPtr m_factory;
                 Service::ServiceId m_serviceId;
 
                 mutable LockType m_lock;
-                mutable Services m_services;
+                // The last released objects are at the back, so the hot ones are reused first
+                // and the rest can expire.
+                mutable std::deque<Item> m_free;
+                mutable std::deque<Waiter *> m_waiters;
+                // All the objects: free, busy and being created or checked.
+                mutable std::uint32_t m_size = 0;
+
+                mutable PoolCounters m_counters{};
+
+                bool m_stop = false;
+                std::condition_variable m_stopped;
+                std::thread m_thread;
+
+                static PoolParams MakeParams(std::uint32_t limit)
+                {
+                    PoolParams params;
+                    params.limit = limit;
+                    return params;
+                }
+
+                static bool IsGood(IServicePtr const &service)
+                {
+                    try
+                    {
+                        auto checkable = Service::Query<ICheckable>(service);
+                        return !checkable || checkable->IsGood();
+                    }
+                    catch (std::exception const &e)
+                    {
+                        MIF_LOG(Warning) << "[Mif::Service::Detail::Pool::IsGood] Failed to check service. "
+                                << "Error: " << e.what();
+                    }
+
+                    return false;
+                }
 
                 // IPool
                 virtual IServicePtr GetService() const override final
+                {
+                    auto const start = Clock::now();
+                    auto waited = false;
+
+                    auto service = Acquire(start, waited);
+
+                    try
+                    {
+                        return Make<Holder>(const_cast<Pool *>(this), service);
+                    }
+                    catch (...)
+                    {
+                        PutBack(std::move(service));
+                        throw;
+                    }
+                }
+
+                // IPoolMetrics
+                virtual PoolCounters GetCounters() const override final
                 {
                     LockGuard lock{m_lock};
+                    auto counters = m_counters;
+                    counters.size = m_size;
+                    counters.idle = static_cast<std::uint32_t>(m_free.size());
+                    return counters;
+                }
+
+                IServicePtr Acquire(Clock::time_point const &start, bool &waited) const
+                {
+                    UniqueLock lock{m_lock};
 
-                    for (auto i = std::begin(m_services) ; i != std::end(m_services) ; )
+                    while (!m_free.empty())
                     {
-                        if (auto checkable = Service::Query<ICheckable>(i->first))
+                        auto item = std::move(m_free.back());
+                        m_free.pop_back();
+
+                        if (m_params.validateAfter.count() > 0 && start - item.lastChecked >= m_params.validateAfter)
                         {
-                            if (!checkable->IsGood())
+                            lock.unlock();
+                            auto const isGood = IsGood(item.service);
+                            if (!isGood)
+                                item.service.reset();
+                            lock.lock();
+
+                            if (!isGood)
                             {
-                                m_services.erase(i++);
-                                continue;
+                                // The slot of the evicted object is taken over by this call.
+                                ++m_counters.evictions;
+                                return Create(lock, start, waited);
                             }
                         }
 
-                        if (!i->second)
-                        {
-                            auto holder = Make<Holder>(const_cast<Pool *>(this), i->first);
-                            return holder;
-                        }
+                        Checkout(start, waited);
+                        return item.service;
+                    }
 
-                        ++i;
+                    if (m_size < m_params.limit)
+                    {
+                        ++m_size;
+                        return Create(lock, start, waited);
                     }
 
-                    if (m_services.size() >= m_limit)
+                    if (m_params.waitTimeout.count() <= 0)
                     {
                         throw std::runtime_error{"[Mif::Service::Detail::Pool::GetService] Failed to get service. "
-                            "Maximum limit reached (" + std::to_string(m_limit) + ")."};
+                            "Maximum limit reached (" + std::to_string(m_params.limit) + ")."};
+                    }
+
+                    waited = true;
+
+                    Waiter waiter;
+                    m_waiters.push_back(&waiter);
+
+                    if (!waiter.ready.wait_until(lock, start + m_params.waitTimeout, [&waiter] { return waiter.isReady; }))
+                    {
+                        m_waiters.erase(std::find(std::begin(m_waiters), std::end(m_waiters), &waiter));
+                        ++m_counters.timeouts;
+                        AddWaitTime(start);
+
+                        throw std::runtime_error{"[Mif::Service::Detail::Pool::GetService] Failed to get service. "
+                            "No free service for " + std::to_string(m_params.waitTimeout.count()) + " ms "
+                            "(limit " + std::to_string(m_params.limit) + ")."};
+                    }
+
+                    if (waiter.service)
+                    {
+                        Checkout(start, waited);
+                        return std::move(waiter.service);
+                    }
+
+                    return Create(lock, start, waited);
+                }
+
+                // The slot of the new object must already be counted in m_size.
+                IServicePtr Create(UniqueLock &lock, Clock::time_point const &start, bool waited) const
+                {
+                    lock.unlock();
+
+                    IServicePtr service;
+                    try
+                    {
+                        service = m_factory->Create(m_serviceId);
+                    }
+                    catch (...)
+                    {
+                        lock.lock();
+                        ReleaseSlot();
+                        throw;
+                    }
+
+                    lock.lock();
+                    ++m_counters.created;
+                    Checkout(start, waited);
+                    return service;
+                }
+
+                void PutBack(IServicePtr service) const
+                {
+                    LockGuard lock{m_lock};
+
+                    if (!m_waiters.empty())
+                    {
+                        auto *waiter = m_waiters.front();
+                        m_waiters.pop_front();
+                        waiter->service = std::move(service);
+                        waiter->isReady = true;
+                        waiter->ready.notify_one();
+                        return;
                     }
 
-                    auto newInst = m_factory->Create(m_serviceId);
-                    m_services.emplace(newInst, false);
-                    auto holder = Make<Holder>(const_cast<Pool *>(this), newInst);
-                    return holder;
+                    auto const now = Clock::now();
+                    m_free.push_back({std::move(service), now, now});
+                }
+
+                // Must be called under the lock when an object is gone. Its slot is given to the first
+                // waiter, if any, and it is not counted as free in between.
+                void ReleaseSlot() const
+                {
+                    if (m_waiters.empty())
+                    {
+                        --m_size;
+                        return;
+                    }
+
+                    auto *waiter = m_waiters.front();
+                    m_waiters.pop_front();
+                    waiter->isReady = true;
+                    waiter->ready.notify_one();
+                }
+
+                void Checkout(Clock::time_point const &start, bool waited) const
+                {
+                    ++m_counters.checkouts;
+                    if (waited)
+                    {
+                        ++m_counters.waits;
+                        AddWaitTime(start);
+                    }
+                }
+
+                void AddWaitTime(Clock::time_point const &start) const
+                {
+                    auto const time = std::chrono::duration_cast<std::chrono::microseconds>(Clock::now() - start);
+                    m_counters.waitTime += time;
+                    m_counters.maxWaitTime = std::max(m_counters.maxWaitTime, time);
+                }
+
+                // The idle objects are checked and released here, out of the GetService path.
+                void Run()
+                {
+                    UniqueLock lock{m_lock};
+
+                    while (!m_stop)
+                    {
+                        if (m_stopped.wait_for(lock, m_params.checkInterval, [this] { return m_stop; }))
+                            break;
+
+                        auto const now = Clock::now();
+
+                        std::vector<Item> expired;
+                        std::vector<Item> checked;
+
+                        for (auto i = std::begin(m_free) ; i != std::end(m_free) ; )
+                        {
+                            if (m_params.idleTimeout.count() > 0 && m_size > m_params.minSize &&
+                                    now - i->lastUsed >= m_params.idleTimeout)
+                            {
+                                expired.push_back(std::move(*i));
+                                i = m_free.erase(i);
+                                --m_size;
+                                ++m_counters.evictions;
+                                continue;
+                            }
+
+                            if (now - i->lastChecked >= m_params.checkInterval)
+                            {
+                                checked.push_back(std::move(*i));
+                                i = m_free.erase(i);
+                                continue;
+                            }
+
+                            ++i;
+                        }
+
+                        if (expired.empty() && checked.empty())
+                            continue;
+
+                        lock.unlock();
+
+                        expired.clear();
+
+                        for (auto &item : checked)
+                        {
+                            if (IsGood(item.service))
+                                item.lastChecked = Clock::now();
+                            else
+                                item.service.reset();
+                        }
+
+                        lock.lock();
+
+                        // The checked objects were idle, so they are put back behind the hot ones.
+                        for (auto i = checked.rbegin() ; i != checked.rend() ; ++i)
+                        {
+                            if (!i->service)
+                            {
+                                ++m_counters.evictions;
+                                ReleaseSlot();
+                            }
+                            else if (!m_waiters.empty())
+                            {
+                                auto *waiter = m_waiters.front();
+                                m_waiters.pop_front();
+                                waiter->service = std::move(i->service);
+                                waiter->isReady = true;
+                                waiter->ready.notify_one();
+                            }
+                            else
+                            {
+                                m_free.push_front(std::move(*i));
+                            }
+                        }
+                    }
                 }
 
                 class Holder
@@ -101,22 +404,13 @@ namespace Mif
                         , m_service{service}
                     {
                         Add(m_service);
-
-                        auto iter = m_pool->m_services.find(m_service);
-                        if (iter == std::end(m_pool->m_services))
-                            throw std::logic_error{"Service for lock not found."};
-                        iter->second = true;
                     }
 
                     ~Holder()
                     {
                         try
                         {
-                            LockGuard lock{m_pool->m_lock};
-                            auto iter = m_pool->m_services.find(m_service);
-                            if (iter == std::end(m_pool->m_services))
-                                throw std::logic_error{"Service for unlock not found."};
-                            iter->second = false;
+                            m_pool->PutBack(std::move(m_service));
                         }
                         catch (std::exception const &e)
                         {
@@ -125,9 +419,6 @@ namespace Mif
                     }
 
                 private:
-                    using LockType = std::mutex;
-                    using LockGuard = std::lock_guard<LockType>;
-
                     TIntrusivePtr<Pool> m_pool;
                     IServicePtr m_service;
                 };
@@ -148,3 +439,12 @@ MIF_SERVICE_CREATOR
     Mif::Service::IFactoryPtr,
     Mif::Service::ServiceId
 )
+
+MIF_SERVICE_CREATOR
+(
+    Mif::Service::Id::Pool,
+    Mif::Service::Detail::Pool,
+    Mif::Service::PoolParams,
+    Mif::Service::IFactoryPtr,
+    Mif::Service::ServiceId
+)
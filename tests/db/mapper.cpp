@@ -0,0 +1,108 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <string>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Db.Mapper
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/db/iconnection.h"
+#include "mif/db/id/service.h"
+#include "mif/db/mapper.h"
+#include "mif/reflection/reflect_type.h"
+#include "mif/service/create.h"
+
+namespace Test
+{
+
+    struct Person
+    {
+        std::int64_t personId = 0;
+        std::string firstName;
+        std::string lastName;
+        double heightCm = 0;
+    };
+
+    MIF_REFLECT_BEGIN(Person)
+        MIF_REFLECT_FIELD(personId)
+        MIF_REFLECT_FIELD(firstName)
+        MIF_REFLECT_FIELD(lastName)
+        MIF_REFLECT_FIELD(heightCm)
+    MIF_REFLECT_END()
+
+}   // namespace Test
+
+MIF_REGISTER_REFLECTED_TYPE(Test::Person)
+
+namespace
+{
+
+    Mif::Db::IConnectionPtr MakeConnection()
+    {
+        auto connection = Mif::Service::Create<Mif::Db::Id::Service::SQLite, Mif::Db::IConnection>(
+                std::string{":memory:"});
+
+        // The columns are unquoted, as the queries made by the mapper.
+        connection->ExecuteDirect("create table people (personId integer primary key, "
+                "firstName text, lastName text, heightCm real);");
+
+        auto statement = connection->CreateStatement(Mif::Db::GetInsertQuery<Test::Person>("people"));
+
+        Test::Person person;
+        person.personId = 1;
+        person.firstName = "Ada";
+        person.lastName = "Lovelace";
+        person.heightCm = 165.5;
+        // SQLite runs the statement on the first Read.
+        statement->Execute(Mif::Db::ToParameters(person))->Read();
+
+        return connection;
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(CamelCaseFieldsMatchFoldedColumns)
+{
+    auto connection = MakeConnection();
+
+    // PostgreSQL folds the unquoted names to the lower case. SQLite keeps the declared names,
+    // so the aliases give the columns the names PostgreSQL would return.
+    auto const people = Mif::Db::Map<Test::Person>(connection->CreateStatement(
+            "select personId as personid, firstName as firstname, lastName as LASTNAME, "
+            "heightCm as heightcm from people;")->Execute());
+
+    BOOST_REQUIRE_EQUAL(people.size(), 1u);
+    BOOST_CHECK_EQUAL(people[0].personId, 1);
+    BOOST_CHECK_EQUAL(people[0].firstName, "Ada");
+    BOOST_CHECK_EQUAL(people[0].lastName, "Lovelace");
+    BOOST_CHECK_CLOSE(people[0].heightCm, 165.5, 0.001);
+}
+
+BOOST_AUTO_TEST_CASE(UpdateQueryWithCamelCaseKey)
+{
+    auto connection = MakeConnection();
+
+    Test::Person person;
+    person.personId = 1;
+    person.firstName = "Augusta";
+    person.lastName = "King";
+    person.heightCm = 166;
+
+    connection->CreateStatement(Mif::Db::GetUpdateQuery<Test::Person>("people", "personId"))->Execute(
+            Mif::Db::ToUpdateParameters(person, "personId"))->Read();
+
+    auto const people = Mif::Db::Map<Test::Person>(connection->CreateStatement(
+            "select * from people;")->Execute());
+
+    BOOST_REQUIRE_EQUAL(people.size(), 1u);
+    BOOST_CHECK_EQUAL(people[0].firstName, "Augusta");
+    BOOST_CHECK_EQUAL(people[0].lastName, "King");
+}
@@ -0,0 +1,145 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <vector>
+
+// POSIX
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Db.PostgreSql.AsyncConnection
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/db/iasync_connection.h"
+#include "mif/db/id/service.h"
+#include "mif/service/create.h"
+
+// THIS
+#include "server.h"
+
+namespace
+{
+
+    // A socket which is listened, but nobody accepts the connections and answers to them.
+    class SilentServer final
+    {
+    public:
+        SilentServer(SilentServer const &) = delete;
+        SilentServer& operator = (SilentServer const &) = delete;
+
+        SilentServer()
+            : m_socket{socket(AF_INET, SOCK_STREAM, 0)}
+        {
+            BOOST_REQUIRE(m_socket >= 0);
+
+            sockaddr_in address{};
+            address.sin_family = AF_INET;
+            address.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+            BOOST_REQUIRE(!bind(m_socket, reinterpret_cast<sockaddr const *>(&address), sizeof(address)));
+            BOOST_REQUIRE(!listen(m_socket, 16));
+
+            socklen_t length = sizeof(address);
+            BOOST_REQUIRE(!getsockname(m_socket, reinterpret_cast<sockaddr *>(&address), &length));
+            m_port = ntohs(address.sin_port);
+        }
+
+        ~SilentServer()
+        {
+            Close();
+        }
+
+        std::uint16_t GetPort() const
+        {
+            return m_port;
+        }
+
+        // The port is kept free, so the connections to it are refused.
+        void Close()
+        {
+            if (m_socket >= 0)
+                close(m_socket);
+            m_socket = -1;
+        }
+
+    private:
+        int m_socket;
+        std::uint16_t m_port = 0;
+    };
+
+    std::string MakeConnectionString(std::uint16_t port, std::uint32_t timeout)
+    {
+        return "host='127.0.0.1' port='" + std::to_string(port) + "' user='mif' dbname='mif' "
+                "connect_timeout='" + std::to_string(timeout) + "' sslmode='disable'";
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(ConnectTimeoutIsKept)
+{
+    SilentServer server;
+
+    auto connection = Mif::Service::Create<Mif::Db::Id::Service::PostgresAsyncConnection, Mif::Db::IAsyncConnection>(
+            MakeConnectionString(server.GetPort(), 2), std::uint32_t{1});
+
+    auto const start = std::chrono::steady_clock::now();
+    auto result = connection->Execute("select 1;");
+
+    BOOST_REQUIRE(result.wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+    BOOST_CHECK_THROW(result.get(), std::exception);
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::seconds{2});
+}
+
+BOOST_AUTO_TEST_CASE(FailedConnectFailsAllQueries)
+{
+    SilentServer server;
+    server.Close();
+
+    auto connection = Mif::Service::Create<Mif::Db::Id::Service::PostgresAsyncConnection, Mif::Db::IAsyncConnection>(
+            MakeConnectionString(server.GetPort(), 10), std::uint32_t{2});
+
+    std::vector<std::future<Mif::Db::IRecordsetPtr>> results;
+    for (int i = 0 ; i < 8 ; ++i)
+        results.push_back(connection->Execute("select 1;"));
+
+    for (auto &result : results)
+    {
+        BOOST_REQUIRE(result.wait_for(std::chrono::seconds{5}) == std::future_status::ready);
+        BOOST_CHECK_THROW(result.get(), std::exception);
+    }
+
+    // The next query is not lost while the attempts are backed off.
+    auto result = connection->Execute("select 1;");
+    BOOST_REQUIRE(result.wait_for(std::chrono::seconds{10}) == std::future_status::ready);
+    BOOST_CHECK_THROW(result.get(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(FailedQueryIsReported, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+
+    // A single connection runs all the queries, so the next ones show it is left in a good state.
+    auto connection = Mif::Service::Create<Mif::Db::Id::Service::PostgresAsyncConnection, Mif::Db::IAsyncConnection>(
+            server.host, server.port, server.user, server.password, server.db, server.connectionTimeout,
+            std::uint32_t{1});
+
+    BOOST_CHECK_THROW(connection->Execute("select * from mif_test_no_such_table;").get(), std::exception);
+    BOOST_CHECK_THROW(connection->Execute("select 1 / 0;").get(), std::exception);
+
+    auto recordset = connection->Execute("select 42;").get();
+    BOOST_REQUIRE(recordset);
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK_EQUAL(recordset->GetAsInt32(0), 42);
+}
@@ -0,0 +1,159 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Db.PostgreSql.ConnectionPool
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/db/iconnection_pool.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
+#include "mif/db/id/service.h"
+#include "mif/service/create.h"
+#include "mif/service/ipool.h"
+
+// THIS
+#include "server.h"
+
+namespace
+{
+
+    std::vector<Mif::Db::IConnectionPtr> GetConnections(Mif::Db::IConnectionPoolPtr pool, std::size_t count)
+    {
+        std::vector<Mif::Db::IConnectionPtr> connections;
+        for (std::size_t i = 0 ; i < count ; ++i)
+            connections.push_back(pool->GetConnection());
+        return connections;
+    }
+
+    Mif::Db::IConnectionPoolPtr CreatePool(Test::Server const &server, std::uint32_t limit)
+    {
+        Mif::Service::PoolParams params;
+        params.limit = limit;
+        params.minSize = 0;
+        params.waitTimeout = std::chrono::milliseconds{0};
+
+        return Mif::Service::Create<Mif::Db::Id::Service::PostgresConnectionPool, Mif::Db::IConnectionPool>(
+                server.host, server.port, server.user, server.password, server.db, server.connectionTimeout, params);
+    }
+
+    std::int64_t GetInt64(Mif::Db::IConnectionPtr connection, std::string const &query)
+    {
+        auto recordset = connection->CreateStatement(query)->Execute();
+        BOOST_REQUIRE(recordset);
+        BOOST_REQUIRE(recordset->Read());
+        return recordset->GetAsInt64(0);
+    }
+
+    std::int64_t GetBackendPid(Mif::Db::IConnectionPtr connection)
+    {
+        return GetInt64(connection, "select pg_backend_pid()::bigint;");
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(DefaultPoolIsNotLimited, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+
+    auto pool = Mif::Service::Create<Mif::Db::Id::Service::PostgresConnectionPool, Mif::Db::IConnectionPool>(
+            server.host, server.port, server.user, server.password, server.db, server.connectionTimeout);
+
+    // More connections are held at once than any fixed default limit would give.
+    auto const connections = GetConnections(pool, 16);
+
+    auto const counters = Mif::Service::Cast<Mif::Service::IPoolMetrics>(pool)->GetCounters();
+    BOOST_CHECK_EQUAL(counters.size, 16u);
+    BOOST_CHECK_EQUAL(counters.waits, 0u);
+    BOOST_CHECK_EQUAL(counters.timeouts, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(LimitIsOptIn, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+
+    Mif::Service::PoolParams params;
+    params.limit = 2;
+    params.minSize = 0;
+    params.waitTimeout = std::chrono::milliseconds{0};
+
+    auto pool = Mif::Service::Create<Mif::Db::Id::Service::PostgresConnectionPool, Mif::Db::IConnectionPool>(
+            server.host, server.port, server.user, server.password, server.db, server.connectionTimeout, params);
+
+    auto connections = GetConnections(pool, 2);
+    BOOST_CHECK_THROW(pool->GetConnection(), std::exception);
+
+    connections.pop_back();
+    BOOST_CHECK(pool->GetConnection());
+}
+
+BOOST_AUTO_TEST_CASE(ConnectionIsReusedAfterCheckout, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+    auto pool = CreatePool(server, 1);
+
+    std::int64_t pid = 0;
+    {
+        auto connection = pool->GetConnection();
+        pid = GetBackendPid(connection);
+    }
+
+    BOOST_CHECK_EQUAL(GetBackendPid(pool->GetConnection()), pid);
+
+    auto const counters = Mif::Service::Cast<Mif::Service::IPoolMetrics>(pool)->GetCounters();
+    BOOST_CHECK_EQUAL(counters.size, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(BrokenConnectionIsReset, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+    auto pool = CreatePool(server, 1);
+
+    std::int64_t pid = 0;
+    {
+        auto connection = pool->GetConnection();
+        pid = GetBackendPid(connection);
+
+        // The backend is terminated by another connection, and the failed query makes libpq see it.
+        auto killerPool = CreatePool(server, 1);
+        killerPool->GetConnection()->ExecuteDirect("select pg_terminate_backend(" + std::to_string(pid) + ");");
+        BOOST_CHECK_THROW(GetBackendPid(connection), std::exception);
+    }
+
+    // The pooled connection is reset on checkout.
+    auto connection = pool->GetConnection();
+    auto const newPid = GetBackendPid(connection);
+    BOOST_CHECK_NE(newPid, pid);
+}
+
+BOOST_AUTO_TEST_CASE(OpenTransactionIsRolledBack, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto const server = Test::GetServer();
+    auto pool = CreatePool(server, 1);
+
+    {
+        auto connection = pool->GetConnection();
+        // The temporary table lives with the connection, so the next checkout sees it.
+        connection->ExecuteDirect("create temporary table mif_test_rollback (id integer);");
+        connection->ExecuteDirect("begin;");
+        connection->ExecuteDirect("insert into mif_test_rollback (id) values (1);");
+    }
+
+    auto connection = pool->GetConnection();
+    BOOST_CHECK_EQUAL(GetInt64(connection, "select count(*) from mif_test_rollback;"), 0);
+
+    // The connection is not left in a transaction, so the next statement is committed at once.
+    connection->ExecuteDirect("insert into mif_test_rollback (id) values (2);");
+    BOOST_CHECK_EQUAL(GetInt64(connection, "select count(*) from mif_test_rollback;"), 1);
+}
@@ -0,0 +1,156 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Db.PostgreSql.Recordset
+#include <boost/test/included/unit_test.hpp>
+
+// LIBPQ
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/db/columns.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/postgresql/detail/recordset.h"
+#include "mif/db/postgresql/detail/types.h"
+#include "mif/service/make.h"
+
+namespace
+{
+
+    namespace Types = Mif::Db::PostgreSql::Detail::Types;
+
+    Oid const Numeric = 1700;
+
+    struct Field
+    {
+        char const *name;
+        Oid type;
+    };
+
+    // The result is made without a server. A null pointer in the rows is a null value.
+    Mif::Db::IRecordsetPtr MakeRecordset(std::vector<Field> const &fields,
+            std::vector<std::vector<char const *>> const &rows)
+    {
+        auto *result = PQmakeEmptyPGresult(nullptr, PGRES_TUPLES_OK);
+        BOOST_REQUIRE(result);
+
+        std::vector<PGresAttDesc> attributes;
+        for (auto const &field : fields)
+            attributes.push_back({const_cast<char *>(field.name), 0, 0, 0, field.type, -1, -1});
+
+        if (!PQsetResultAttrs(result, static_cast<int>(attributes.size()), attributes.data()))
+        {
+            PQclear(result);
+            BOOST_FAIL("Failed to set the result fields.");
+        }
+
+        for (std::size_t row = 0 ; row < rows.size() ; ++row)
+        {
+            for (std::size_t field = 0 ; field < rows[row].size() ; ++field)
+            {
+                auto const *value = rows[row][field];
+                if (!PQsetvalue(result, static_cast<int>(row), static_cast<int>(field), const_cast<char *>(value),
+                        value ? static_cast<int>(std::string{value}.size()) : -1))
+                {
+                    PQclear(result);
+                    BOOST_FAIL("Failed to set the result value.");
+                }
+            }
+        }
+
+        return Mif::Service::Make<Mif::Db::PostgreSql::Detail::Recordset, Mif::Db::IRecordset>(result,
+                Mif::Db::IStatement::ResultFormat::Text);
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(IntegerFromNumericText)
+{
+    auto recordset = MakeRecordset({{"value", Numeric}}, {{"10.00"}, {" 42"}});
+
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK_EQUAL(recordset->GetAsInt64(0), 10);
+    BOOST_CHECK_EQUAL(recordset->GetAsInt32(0), 10);
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK_EQUAL(recordset->GetAsInt64(0), 42);
+    BOOST_CHECK(!recordset->Read());
+}
+
+BOOST_AUTO_TEST_CASE(IntegerFromBadText)
+{
+    auto recordset = MakeRecordset({{"value", Types::Text}}, {{"abc"}});
+
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK_THROW(recordset->GetAsInt64(0), std::exception);
+    BOOST_CHECK_THROW(recordset->GetAsDouble(0), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(FetchIntegersFromNumericText)
+{
+    auto recordset = MakeRecordset({{"value", Numeric}}, {{"1.50"}, {"2"}});
+
+    std::vector<std::int64_t> values;
+    Mif::Db::Columns columns;
+    columns.Add(0, values);
+
+    BOOST_CHECK_EQUAL(recordset->Fetch(columns, 10), 2u);
+    BOOST_CHECK((values == std::vector<std::int64_t>{1, 2}));
+}
+
+BOOST_AUTO_TEST_CASE(FailedFetchLeavesColumnsUnchanged)
+{
+    // The null in the second column of the second row fails the fetch after the first column is read.
+    auto recordset = MakeRecordset({{"id", Types::Int4}, {"name", Types::Text}},
+            {{"1", "one"}, {"2", nullptr}});
+
+    std::vector<std::int32_t> ids{7};
+    std::vector<std::string> names{"seven"};
+    Mif::Db::Columns columns;
+    columns.Add(0, ids).Add(1, names);
+
+    BOOST_CHECK_THROW(recordset->Fetch(columns, 10), std::exception);
+    BOOST_CHECK((ids == std::vector<std::int32_t>{7}));
+    BOOST_CHECK((names == std::vector<std::string>{"seven"}));
+
+    std::vector<bool> nulls;
+    Mif::Db::Columns nullable;
+    nullable.Add(0, ids).Add(1, names, &nulls);
+
+    BOOST_CHECK_EQUAL(recordset->Fetch(nullable, 10), 2u);
+    BOOST_CHECK((ids == std::vector<std::int32_t>{7, 1, 2}));
+    BOOST_CHECK((names == std::vector<std::string>{"seven", "one", ""}));
+    BOOST_CHECK((nulls == std::vector<bool>{false, true}));
+}
+
+BOOST_AUTO_TEST_CASE(FailedResultIsReportedAndFreedOnce)
+{
+    // The recordset takes the result before it is checked, so the caller must not free it after a failure.
+    auto *result = PQmakeEmptyPGresult(nullptr, PGRES_FATAL_ERROR);
+    BOOST_REQUIRE(result);
+
+    BOOST_CHECK_THROW((Mif::Service::Make<Mif::Db::PostgreSql::Detail::Recordset, Mif::Db::IRecordset>(result,
+            Mif::Db::IStatement::ResultFormat::Text)), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE(ByteaFromText)
+{
+    auto recordset = MakeRecordset({{"data", Types::Bytea}}, {{"\\x41004243"}, {"\\101\\000B"}, {nullptr}});
+
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK((recordset->GetAsBuffer(0) == Mif::Common::Buffer{'A', '\0', 'B', 'C'}));
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK((recordset->GetAsBuffer(0) == Mif::Common::Buffer{'A', '\0', 'B'}));
+    BOOST_REQUIRE(recordset->Read());
+    BOOST_CHECK_THROW(recordset->GetAsBuffer(0), std::exception);
+}
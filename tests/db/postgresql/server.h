@@ -0,0 +1,72 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+#ifndef __MIF_TESTS_DB_POSTGRESQL_SERVER_H__
+#define __MIF_TESTS_DB_POSTGRESQL_SERVER_H__
+
+// STD
+#include <cstdint>
+#include <cstdlib>
+#include <string>
+
+// BOOST
+#include <boost/test/unit_test.hpp>
+
+namespace Test
+{
+
+    // The tests which need a server run only if MIF_TEST_PG_HOST is set. The other settings
+    // are MIF_TEST_PG_PORT, MIF_TEST_PG_USER, MIF_TEST_PG_PASSWORD and MIF_TEST_PG_DB.
+    struct Server
+    {
+        std::string host;
+        std::uint16_t port = 5432;
+        std::string user = "postgres";
+        std::string password;
+        std::string db = "postgres";
+        std::uint32_t connectionTimeout = 10;
+    };
+
+    // The host is empty if the server is not set.
+    inline Server GetServer()
+    {
+        Server server;
+
+        auto const *host = std::getenv("MIF_TEST_PG_HOST");
+        if (!host || !*host)
+            return server;
+
+        server.host = host;
+
+        if (auto const *port = std::getenv("MIF_TEST_PG_PORT"))
+            server.port = static_cast<std::uint16_t>(std::stoi(port));
+        if (auto const *user = std::getenv("MIF_TEST_PG_USER"))
+            server.user = user;
+        if (auto const *password = std::getenv("MIF_TEST_PG_PASSWORD"))
+            server.password = password;
+        if (auto const *db = std::getenv("MIF_TEST_PG_DB"))
+            server.db = db;
+
+        return server;
+    }
+
+    // The precondition of the test cases which need a server, so they are reported as skipped without it.
+    // Usage: BOOST_AUTO_TEST_CASE(Name, * boost::unit_test::precondition(Test::HasServer{}))
+    struct HasServer
+    {
+        boost::test_tools::assertion_result operator () (boost::unit_test::test_unit_id) const
+        {
+            boost::test_tools::assertion_result result{!GetServer().host.empty()};
+            if (!result)
+                result.message() << "MIF_TEST_PG_HOST is not set";
+            return result;
+        }
+    };
+
+}   // namespace Test
+
+#endif  // !__MIF_TESTS_DB_POSTGRESQL_SERVER_H__
@@ -0,0 +1,132 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstdint>
+#include <string>
+#include <vector>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Db.PostgreSql.Statement
+#include <boost/test/included/unit_test.hpp>
+
+// LIBPQ
+#include <libpq-fe.h>
+
+// MIF
+#include "mif/db/iconnection.h"
+#include "mif/db/id/service.h"
+#include "mif/db/irecordset.h"
+#include "mif/db/istatement.h"
+#include "mif/service/create.h"
+
+// THIS
+#include "server.h"
+
+namespace
+{
+
+    // The executions are sent by portions of this size, see Detail::Statement::BatchPortion.
+    std::size_t const Portion = 256;
+
+    Mif::Db::IConnectionPtr Connect()
+    {
+        auto const server = Test::GetServer();
+        return Mif::Service::Create<Mif::Db::Id::Service::PostgreSQL, Mif::Db::IConnection>(
+                server.host, server.port, server.user, server.password, server.db, server.connectionTimeout);
+    }
+
+    // The temporary table lives with the connection only.
+    void CreateTable(Mif::Db::IConnectionPtr connection)
+    {
+        connection->ExecuteDirect("create temporary table mif_test_batch (id integer primary key);");
+    }
+
+    std::vector<Mif::Db::Parameters> MakeBatch(std::size_t count)
+    {
+        std::vector<Mif::Db::Parameters> batch;
+        batch.reserve(count);
+        for (std::size_t i = 0 ; i < count ; ++i)
+            batch.push_back({static_cast<std::int32_t>(i)});
+        return batch;
+    }
+
+    std::int64_t GetCount(Mif::Db::IConnectionPtr connection)
+    {
+        auto recordset = connection->CreateStatement("select count(*) from mif_test_batch;")->Execute();
+        BOOST_REQUIRE(recordset);
+        BOOST_REQUIRE(recordset->Read());
+        return recordset->GetAsInt64(0);
+    }
+
+    std::uint64_t Insert(Mif::Db::IConnectionPtr connection, std::vector<Mif::Db::Parameters> const &batch)
+    {
+        return connection->CreateStatement("insert into mif_test_batch (id) values ($1);")->ExecuteBatch(batch);
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(BatchOfWholePortions, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto connection = Connect();
+    CreateTable(connection);
+
+    BOOST_CHECK_EQUAL(Insert(connection, MakeBatch(2 * Portion)), 2 * Portion);
+    BOOST_CHECK_EQUAL(GetCount(connection), static_cast<std::int64_t>(2 * Portion));
+}
+
+BOOST_AUTO_TEST_CASE(BatchWithPartialPortion, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto connection = Connect();
+    CreateTable(connection);
+
+    auto const count = 2 * Portion + 44;
+    BOOST_CHECK_EQUAL(Insert(connection, MakeBatch(count)), count);
+    BOOST_CHECK_EQUAL(GetCount(connection), static_cast<std::int64_t>(count));
+
+    BOOST_CHECK_EQUAL(Insert(connection, {}), 0u);
+}
+
+BOOST_AUTO_TEST_CASE(FailedExecutionAbortsBatch, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto connection = Connect();
+    CreateTable(connection);
+
+    // The duplicate key is in the second portion. The first portion is committed by its own sync,
+    // the rest of the second one is aborted by the server and the third one is not sent.
+    // Without the pipeline mode every execution is committed by itself.
+    auto batch = MakeBatch(3 * Portion);
+    batch[Portion + 10] = {std::int32_t{0}};
+
+#ifdef LIBPQ_HAS_PIPELINING
+    auto const committed = static_cast<std::int64_t>(Portion);
+#else
+    auto const committed = static_cast<std::int64_t>(Portion + 10);
+#endif
+
+    BOOST_CHECK_THROW(Insert(connection, batch), std::exception);
+    BOOST_CHECK_EQUAL(GetCount(connection), committed);
+
+    // The connection is left out of the pipeline and ready for the next queries.
+    BOOST_CHECK_EQUAL(Insert(connection, {{std::int32_t{-1}}}), 1u);
+    BOOST_CHECK_EQUAL(GetCount(connection), committed + 1);
+}
+
+BOOST_AUTO_TEST_CASE(BatchIsAtomicInTransaction, * boost::unit_test::precondition(Test::HasServer{}))
+{
+    auto connection = Connect();
+    CreateTable(connection);
+
+    auto batch = MakeBatch(3 * Portion);
+    batch.back() = {std::int32_t{0}};
+
+    connection->ExecuteDirect("begin;");
+    BOOST_CHECK_THROW(Insert(connection, batch), std::exception);
+    connection->ExecuteDirect("rollback;");
+
+    BOOST_CHECK_EQUAL(GetCount(connection), 0);
+}
@@ -0,0 +1,181 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstddef>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Net.Clients.Frame
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/net/clients/frame_reader.h"
+#include "mif/net/clients/frame_writer.h"
+#include "mif/net/icontrol.h"
+#include "mif/net/ipublisher.h"
+
+namespace
+{
+
+    // Keeps all published data. The pairs are kept apart if it's asked for.
+    class Recorder final
+        : public Mif::Net::IPublisher
+        , public Mif::Net::IControl
+    {
+    public:
+        Recorder(bool gather)
+            : m_gather{gather}
+        {
+        }
+
+        std::vector<Mif::Common::Buffer> const& GetData() const
+        {
+            return m_data;
+        }
+
+    private:
+        bool const m_gather;
+        std::vector<Mif::Common::Buffer> m_data;
+
+        // IPublisher
+        virtual void Publish(Mif::Common::Buffer buffer) override final
+        {
+            m_data.push_back(std::move(buffer));
+        }
+
+        virtual void Publish(Mif::Common::Buffer header, Mif::Common::Buffer payload) override final
+        {
+            if (!m_gather)
+            {
+                IPublisher::Publish(std::move(header), std::move(payload));
+                return;
+            }
+            m_data.push_back(std::move(header));
+            m_data.push_back(std::move(payload));
+        }
+
+        // IControl
+        virtual void CloseMe() override final
+        {
+        }
+    };
+
+    Mif::Common::Buffer MakeBuffer(std::string const &str)
+    {
+        return {std::begin(str), std::end(str)};
+    }
+
+    std::string ToString(Mif::Common::Buffer const &buffer)
+    {
+        return {std::begin(buffer), std::end(buffer)};
+    }
+
+    // Frames of the writer joined into one stream.
+    Mif::Common::Buffer MakeStream(std::vector<std::string> const &frames)
+    {
+        auto recorder = std::make_shared<Recorder>(false);
+        auto writer = std::make_shared<Mif::Net::Clients::FrameWriter>(recorder, recorder);
+        for (auto const &i : frames)
+            writer->OnData(MakeBuffer(i));
+
+        Mif::Common::Buffer stream;
+        for (auto const &i : recorder->GetData())
+            stream.insert(std::end(stream), std::begin(i), std::end(i));
+        return stream;
+    }
+
+    std::vector<std::string> Read(std::vector<Mif::Common::Buffer> chunks)
+    {
+        auto recorder = std::make_shared<Recorder>(false);
+        auto reader = std::make_shared<Mif::Net::Clients::FrameReader>(recorder, recorder);
+        for (auto &i : chunks)
+            reader->OnData(std::move(i));
+
+        std::vector<std::string> frames;
+        for (auto const &i : recorder->GetData())
+            frames.push_back(ToString(i));
+        return frames;
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(WriteHeaderAndPayloadApart)
+{
+    auto recorder = std::make_shared<Recorder>(true);
+    auto writer = std::make_shared<Mif::Net::Clients::FrameWriter>(recorder, recorder);
+
+    auto payload = MakeBuffer("payload");
+    auto const *data = payload.data();
+    writer->OnData(std::move(payload));
+
+    auto const &published = recorder->GetData();
+    BOOST_REQUIRE_EQUAL(published.size(), 2u);
+    BOOST_CHECK(published[0] == Mif::Common::Buffer({0, 0, 0, 7}));
+    BOOST_CHECK_EQUAL(ToString(published[1]), "payload");
+    BOOST_CHECK(published[1].data() == data);
+}
+
+BOOST_AUTO_TEST_CASE(JoinHeaderAndPayload)
+{
+    auto const stream = MakeStream({"abc"});
+    BOOST_CHECK(stream == Mif::Common::Buffer({0, 0, 0, 3, 'a', 'b', 'c'}));
+}
+
+BOOST_AUTO_TEST_CASE(ReadSingleFrame)
+{
+    auto stream = MakeStream({"frame"});
+    auto const *data = stream.data();
+
+    auto recorder = std::make_shared<Recorder>(false);
+    auto reader = std::make_shared<Mif::Net::Clients::FrameReader>(recorder, recorder);
+    reader->OnData(std::move(stream));
+
+    auto const &frames = recorder->GetData();
+    BOOST_REQUIRE_EQUAL(frames.size(), 1u);
+    BOOST_CHECK_EQUAL(ToString(frames[0]), "frame");
+    // The incoming buffer becomes the frame.
+    BOOST_CHECK(frames[0].data() == data);
+}
+
+BOOST_AUTO_TEST_CASE(ReadSeveralFramesInOneChunk)
+{
+    std::vector<std::string> const expected{"first", "second", "third"};
+    auto const frames = Read({MakeStream(expected)});
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(frames), std::end(frames), std::begin(expected), std::end(expected));
+}
+
+BOOST_AUTO_TEST_CASE(ReadFramesSplitAtEveryByte)
+{
+    std::vector<std::string> const expected{"first", "second frame", "x"};
+    auto const stream = MakeStream(expected);
+
+    for (std::size_t i = 1 ; i < stream.size() ; ++i)
+    {
+        std::vector<Mif::Common::Buffer> chunks{
+                Mif::Common::Buffer(std::begin(stream), std::next(std::begin(stream), i)),
+                Mif::Common::Buffer(std::next(std::begin(stream), i), std::end(stream))
+            };
+        auto const frames = Read(std::move(chunks));
+        BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(frames), std::end(frames), std::begin(expected), std::end(expected));
+    }
+
+    std::vector<Mif::Common::Buffer> chunks;
+    for (auto i : stream)
+        chunks.push_back(Mif::Common::Buffer(1, i));
+    auto const frames = Read(std::move(chunks));
+    BOOST_CHECK_EQUAL_COLLECTIONS(std::begin(frames), std::end(frames), std::begin(expected), std::end(expected));
+}
+
+BOOST_AUTO_TEST_CASE(RejectBadFrameSize)
+{
+    BOOST_CHECK_THROW(Read({Mif::Common::Buffer{char(0xFF), 0, 0, 0, 'a'}}), std::runtime_error);
+}
@@ -0,0 +1,217 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <stdexcept>
+#include <string>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Net.Http.Router
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/net/http/router.h"
+
+namespace
+{
+
+    using Router = Mif::Net::Http::Router;
+
+    std::string GetName(Router::Match const &match, std::size_t index)
+    {
+        return *match.GetParam(index).name;
+    }
+
+    std::string GetValue(Router::Match const &match, std::size_t index)
+    {
+        auto const &param = match.GetParam(index);
+        return {param.value, param.size};
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(StaticSegmentWinsOverParameter)
+{
+    Router router;
+    BOOST_REQUIRE(router.Add("/users/{id}", 0));
+    BOOST_REQUIRE(router.Add("/users/me", 1));
+
+    Router::Match match;
+    BOOST_REQUIRE(router.Find("/users/me", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 1u);
+    BOOST_CHECK_EQUAL(match.GetRoute(), "/users/me");
+    BOOST_CHECK_EQUAL(match.GetParamsCount(), 0u);
+
+    // The values point into the path.
+    std::string const path = "/users/42";
+    BOOST_REQUIRE(router.Find(path, match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), 1u);
+    BOOST_CHECK_EQUAL(GetName(match, 0), "id");
+    BOOST_CHECK_EQUAL(GetValue(match, 0), "42");
+}
+
+BOOST_AUTO_TEST_CASE(ParameterIsTriedAfterFailedStaticBranch)
+{
+    Router router;
+    BOOST_REQUIRE(router.Add("/a/b/c", 0));
+    BOOST_REQUIRE(router.Add("/a/{x}/d", 1));
+    BOOST_REQUIRE(router.Add("/a/{x}/{y}/e", 2));
+
+    Router::Match match;
+    BOOST_REQUIRE(router.Find("/a/b/c", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+
+    // "b" is a static segment, but the rest of the path matches the parameter branch only.
+    std::string path = "/a/b/d";
+    BOOST_REQUIRE(router.Find(path, match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 1u);
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), 1u);
+    BOOST_CHECK_EQUAL(GetValue(match, 0), "b");
+
+    // The parameters captured by a failed branch are dropped.
+    path = "/a/b/c/e";
+    BOOST_REQUIRE(router.Find(path, match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 2u);
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), 2u);
+    BOOST_CHECK_EQUAL(GetName(match, 0), "x");
+    BOOST_CHECK_EQUAL(GetValue(match, 0), "b");
+    BOOST_CHECK_EQUAL(GetName(match, 1), "y");
+    BOOST_CHECK_EQUAL(GetValue(match, 1), "c");
+
+    BOOST_CHECK(!router.Find("/a/b", match));
+    BOOST_CHECK(!router.Find("/a/b/c/d", match));
+}
+
+BOOST_AUTO_TEST_CASE(FindPrefixTakesLongestRoute)
+{
+    Router router;
+    BOOST_REQUIRE(router.Add("/admin", 0));
+    BOOST_REQUIRE(router.Add("/admin/users", 1));
+    BOOST_REQUIRE(router.Add("/files/{name}", 2));
+
+    Router::Match match;
+    BOOST_REQUIRE(router.FindPrefix("/admin/users/1/edit", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 1u);
+
+    BOOST_REQUIRE(router.FindPrefix("/admin/list", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+
+    BOOST_REQUIRE(router.FindPrefix("/admin", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+
+    std::string const path = "/files/a.txt/raw";
+    BOOST_REQUIRE(router.FindPrefix(path, match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 2u);
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), 1u);
+    BOOST_CHECK_EQUAL(GetValue(match, 0), "a.txt");
+
+    // A prefix is made of whole segments.
+    BOOST_CHECK(!router.FindPrefix("/administrator", match));
+    BOOST_CHECK(!router.FindPrefix("/files", match));
+    BOOST_CHECK(!router.FindPrefix("/other", match));
+
+    // The root route is the shortest prefix of any path.
+    BOOST_REQUIRE(router.Add("/", 3));
+    BOOST_REQUIRE(router.FindPrefix("/other/path", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 3u);
+    BOOST_REQUIRE(router.FindPrefix("/admin/users", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 1u);
+}
+
+BOOST_AUTO_TEST_CASE(ParameterNamesConflict)
+{
+    Router router;
+    BOOST_REQUIRE(router.Add("/users/{id}", 0));
+    BOOST_REQUIRE(router.Add("/users/{id}/posts", 1));
+
+    BOOST_CHECK_THROW(router.Add("/users/{name}/files", 2), std::invalid_argument);
+    BOOST_CHECK_THROW(router.Add("/users/{}", 2), std::invalid_argument);
+    BOOST_CHECK_THROW(router.Add("/users/{id", 2), std::invalid_argument);
+
+    // The same route is not added twice and the first index is kept.
+    BOOST_CHECK(!router.Add("/users/{id}", 3));
+
+    Router::Match match;
+    BOOST_REQUIRE(router.Find("/users/7", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+    BOOST_CHECK(!router.Find("/users/7/files", match));
+}
+
+BOOST_AUTO_TEST_CASE(ParametersAreLimited)
+{
+    std::string route;
+    std::string path;
+    for (std::size_t i = 0 ; i < Router::MaxParams ; ++i)
+    {
+        route += "/{p" + std::to_string(i) + "}";
+        path += "/v" + std::to_string(i);
+    }
+
+    Router router;
+    BOOST_REQUIRE(router.Add(route, 0));
+    BOOST_CHECK_THROW(router.Add(route + "/{extra}", 1), std::invalid_argument);
+
+    Router::Match match;
+    BOOST_REQUIRE(router.Find(path, match));
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), Router::MaxParams);
+    for (std::size_t i = 0 ; i < Router::MaxParams ; ++i)
+    {
+        BOOST_CHECK_EQUAL(GetName(match, i), "p" + std::to_string(i));
+        BOOST_CHECK_EQUAL(GetValue(match, i), "v" + std::to_string(i));
+    }
+
+    BOOST_CHECK_THROW(match.GetParam(Router::MaxParams), std::out_of_range);
+
+    // A path longer than any route does not overflow the parameters.
+    BOOST_CHECK(!router.Find(path + "/v8", match));
+    BOOST_CHECK(!router.FindPrefix("/", match));
+    path += "/v8/v9";
+    BOOST_REQUIRE(router.FindPrefix(path, match));
+    BOOST_CHECK_EQUAL(match.GetParamsCount(), Router::MaxParams);
+}
+
+BOOST_AUTO_TEST_CASE(RepeatedAndTrailingSlashesAreSkipped)
+{
+    Router router;
+    BOOST_REQUIRE(router.Add("/list", 0));
+    BOOST_REQUIRE(router.Add("/users/{id}", 1));
+
+    BOOST_CHECK(!router.Add("/list/", 2));
+    BOOST_CHECK(!router.Add("//list", 2));
+
+    Router::Match match;
+    for (auto const *path : {"/list", "/list/", "//list", "list", "/list//"})
+    {
+        BOOST_REQUIRE_MESSAGE(router.Find(path, match), path);
+        BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+    }
+
+    std::string const path = "//users///42//";
+    BOOST_REQUIRE(router.Find(path, match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 1u);
+    BOOST_REQUIRE_EQUAL(match.GetParamsCount(), 1u);
+    BOOST_CHECK_EQUAL(GetValue(match, 0), "42");
+
+    BOOST_CHECK(!router.Find("/users//", match));
+}
+
+BOOST_AUTO_TEST_CASE(EmptyRouter)
+{
+    Router router;
+    BOOST_CHECK(router.Empty());
+
+    Router::Match match;
+    BOOST_CHECK(!router.Find("/", match));
+    BOOST_CHECK(!router.FindPrefix("/any", match));
+    BOOST_CHECK_THROW(match.GetRoute(), std::logic_error);
+
+    BOOST_REQUIRE(router.Add("/", 0));
+    BOOST_CHECK(!router.Empty());
+    BOOST_REQUIRE(router.Find("", match));
+    BOOST_CHECK_EQUAL(match.GetIndex(), 0u);
+}
@@ -0,0 +1,123 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <cstddef>
+#include <stdexcept>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Net.Tcp.BufferPool
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/common/types.h"
+#include "mif/net/tcp/detail/buffer_pool.h"
+
+namespace
+{
+
+    using BufferPool = Mif::Net::Tcp::Detail::BufferPool;
+
+    std::size_t const BufferSize = 1024;
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(ReuseBuffer)
+{
+    BufferPool pool{BufferSize};
+
+    auto buffer = pool.Get();
+    BOOST_CHECK_EQUAL(buffer.size(), BufferSize);
+    auto const *data = buffer.data();
+    pool.Put(std::move(buffer));
+
+    buffer = pool.Get();
+    BOOST_CHECK(buffer.data() == data);
+
+    auto const counters = pool.GetCounters();
+    BOOST_CHECK_EQUAL(counters.allocated, 1u);
+    BOOST_CHECK_EQUAL(counters.reused, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(HandOverFilledBuffer)
+{
+    BufferPool pool{BufferSize};
+
+    auto buffer = pool.Get();
+    buffer[0] = 'a';
+    auto const *data = buffer.data();
+
+    auto const chunk = pool.HandOver(buffer, BufferSize - 1);
+    BOOST_CHECK_EQUAL(chunk.size(), BufferSize - 1);
+    BOOST_CHECK(chunk.data() == data);
+    BOOST_CHECK_EQUAL(chunk[0], 'a');
+    BOOST_CHECK(buffer.empty());
+
+    auto const counters = pool.GetCounters();
+    BOOST_CHECK_EQUAL(counters.handedOver, 1u);
+    BOOST_CHECK_EQUAL(counters.copied, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(CopySmallData)
+{
+    BufferPool pool{BufferSize};
+
+    auto buffer = pool.Get();
+    buffer[0] = 'a';
+    buffer[1] = 'b';
+    auto const *data = buffer.data();
+
+    auto const chunk = pool.HandOver(buffer, 2);
+    BOOST_CHECK_EQUAL(chunk.size(), 2u);
+    BOOST_CHECK(chunk.data() != data);
+    BOOST_CHECK_EQUAL(chunk[1], 'b');
+    BOOST_CHECK_EQUAL(buffer.size(), BufferSize);
+    BOOST_CHECK(buffer.data() == data);
+
+    auto const counters = pool.GetCounters();
+    BOOST_CHECK_EQUAL(counters.handedOver, 0u);
+    BOOST_CHECK_EQUAL(counters.copied, 1u);
+
+    BOOST_CHECK_THROW(pool.HandOver(buffer, BufferSize + 1), std::invalid_argument);
+}
+
+BOOST_AUTO_TEST_CASE(RecycleWrittenBuffers)
+{
+    BufferPool pool{BufferSize};
+
+    // A buffer of the written data is taken if it fits the pool.
+    Mif::Common::Buffer written(BufferSize + BufferSize / 2);
+    auto const *data = written.data();
+    pool.Put(std::move(written));
+
+    auto buffer = pool.Get();
+    BOOST_CHECK_EQUAL(buffer.size(), BufferSize);
+    BOOST_CHECK(buffer.data() == data);
+
+    pool.Put(Mif::Common::Buffer(BufferSize / 2));
+    pool.Put(Mif::Common::Buffer(BufferSize * 4));
+    pool.Put(Mif::Common::Buffer{});
+
+    auto const counters = pool.GetCounters();
+    BOOST_CHECK_EQUAL(counters.allocated, 0u);
+    BOOST_CHECK_EQUAL(counters.reused, 1u);
+    BOOST_CHECK_EQUAL(counters.dropped, 2u);
+}
+
+BOOST_AUTO_TEST_CASE(LimitFreeBuffers)
+{
+    BufferPool pool{BufferSize, 1};
+
+    auto first = pool.Get();
+    auto second = pool.Get();
+    pool.Put(std::move(first));
+    pool.Put(std::move(second));
+
+    auto const counters = pool.GetCounters();
+    BOOST_CHECK_EQUAL(counters.allocated, 2u);
+    BOOST_CHECK_EQUAL(counters.dropped, 1u);
+}
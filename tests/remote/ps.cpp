@@ -0,0 +1,319 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <tuple>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Remote.PS
+#include <boost/mpl/list.hpp>
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/common/crc32.h"
+#include "mif/net/icontrol.h"
+#include "mif/net/ihandler.h"
+#include "mif/net/ipublisher.h"
+#include "mif/remote/predefined/serialization/boost/binary.h"
+#include "mif/remote/predefined/serialization/json.h"
+#include "mif/remote/ps.h"
+#include "mif/remote/ps_client.h"
+#include "mif/service/factory.h"
+#include "mif/service/make.h"
+
+namespace Test
+{
+
+    struct IHuman
+        : public Mif::Service::Inherit<Mif::Service::IService>
+    {
+        virtual std::string GetName() const = 0;
+    };
+
+    using IHumanPtr = Mif::Service::TServicePtr<IHuman>;
+
+    struct ICalculator
+        : public Mif::Service::Inherit<IHuman>
+    {
+        virtual std::int32_t Add(std::int32_t x, std::int32_t y) = 0;
+        virtual double Mul(double x, double y) const = 0;
+        virtual std::string Concat(std::string const &x, std::string const &y) const = 0;
+        virtual void Fail() = 0;
+        virtual IHumanPtr GetOwner() = 0;
+        virtual std::string GetNameOf(IHumanPtr human) = 0;
+    };
+
+    namespace Meta
+    {
+
+        using namespace ::Test;
+
+        MIF_REMOTE_PS_BEGIN(IHuman)
+            MIF_REMOTE_METHOD(GetName)
+        MIF_REMOTE_PS_END()
+
+        MIF_REMOTE_PS_BEGIN(ICalculator)
+            MIF_REMOTE_METHOD(Add)
+            MIF_REMOTE_METHOD(Mul)
+            MIF_REMOTE_METHOD(Concat)
+            MIF_REMOTE_METHOD(Fail)
+            MIF_REMOTE_METHOD(GetOwner)
+            MIF_REMOTE_METHOD(GetNameOf)
+        MIF_REMOTE_PS_END()
+
+    }   // namespace Meta
+
+}   // namespace Test
+
+MIF_REMOTE_REGISTER_PS(Test::Meta::IHuman)
+MIF_REMOTE_REGISTER_PS(Test::Meta::ICalculator)
+
+namespace
+{
+
+    enum : Mif::Service::ServiceId
+    {
+        CalculatorId = 1
+    };
+
+    class Human
+        : public Mif::Service::Inherit<Test::IHuman>
+    {
+    public:
+        Human(std::string const &name)
+            : m_name{name}
+        {
+        }
+
+    private:
+        std::string m_name;
+
+        // IHuman
+        virtual std::string GetName() const override final
+        {
+            return m_name;
+        }
+    };
+
+    class Calculator
+        : public Mif::Service::Inherit<Test::ICalculator>
+    {
+    private:
+        // IHuman
+        virtual std::string GetName() const override final
+        {
+            return "Calculator";
+        }
+
+        // ICalculator
+        virtual std::int32_t Add(std::int32_t x, std::int32_t y) override final
+        {
+            return x + y;
+        }
+
+        virtual double Mul(double x, double y) const override final
+        {
+            return x * y;
+        }
+
+        virtual std::string Concat(std::string const &x, std::string const &y) const override final
+        {
+            return x + y;
+        }
+
+        virtual void Fail() override final
+        {
+            throw std::runtime_error{"Failed on purpose."};
+        }
+
+        virtual Test::IHumanPtr GetOwner() override final
+        {
+            return Mif::Service::Make<Human, Test::IHuman>("Owner");
+        }
+
+        virtual std::string GetNameOf(Test::IHumanPtr human) override final
+        {
+            return human ? human->GetName() : std::string{};
+        }
+    };
+
+    // Delivers the data of one side to the other one in the same thread.
+    class Channel final
+        : public Mif::Net::IPublisher
+        , public Mif::Net::IControl
+    {
+    public:
+        void SetPeer(std::weak_ptr<Mif::Net::IHandler> peer)
+        {
+            m_peer = peer;
+        }
+
+    private:
+        std::weak_ptr<Mif::Net::IHandler> m_peer;
+
+        // IPublisher
+        virtual void Publish(Mif::Common::Buffer buffer) override final
+        {
+            if (auto peer = m_peer.lock())
+                peer->OnData(std::move(buffer));
+        }
+
+        // IControl
+        virtual void CloseMe() override final
+        {
+        }
+    };
+
+    // Keeps the last data which is sent by the client.
+    class Recorder final
+        : public Mif::Net::IPublisher
+        , public Mif::Net::IControl
+    {
+    public:
+        Mif::Common::Buffer GetData() const
+        {
+            return m_data;
+        }
+
+    private:
+        Mif::Common::Buffer m_data;
+
+        // IPublisher
+        virtual void Publish(Mif::Common::Buffer buffer) override final
+        {
+            m_data = std::move(buffer);
+        }
+
+        // IControl
+        virtual void CloseMe() override final
+        {
+        }
+    };
+
+    template <typename TSerialization>
+    class Connection final
+    {
+    public:
+        using Client = Mif::Remote::PSClient<TSerialization>;
+
+        Connection()
+        {
+            auto factory = Mif::Service::Make<Mif::Service::Factory, Mif::Service::Factory>();
+            factory->AddInstance(CalculatorId, Mif::Service::Make<Calculator, Mif::Service::IService>());
+
+            auto const timeout = std::chrono::seconds{10};
+
+            m_server = std::make_shared<Client>(m_serverChannel, m_serverChannel, timeout,
+                    Mif::Service::Cast<Mif::Service::IFactory>(factory));
+            m_client = std::make_shared<Client>(m_clientChannel, m_clientChannel, timeout);
+
+            m_serverChannel->SetPeer(m_client);
+            m_clientChannel->SetPeer(m_server);
+        }
+
+        Client& GetClient()
+        {
+            return *m_client;
+        }
+
+    private:
+        std::shared_ptr<Channel> m_serverChannel = std::make_shared<Channel>();
+        std::shared_ptr<Channel> m_clientChannel = std::make_shared<Channel>();
+        std::shared_ptr<Client> m_server;
+        std::shared_ptr<Client> m_client;
+    };
+
+    using Serializations = boost::mpl::list
+        <
+            Mif::Remote::Predefined::Serialization::Json,
+            Mif::Remote::Predefined::Serialization::Boost::Binary
+        >;
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CallMethods, T, Serializations)
+{
+    Connection<T> connection;
+    auto calculator = connection.GetClient().template CreateService<Test::ICalculator>(CalculatorId);
+    BOOST_REQUIRE(calculator);
+
+    BOOST_CHECK_EQUAL(calculator->Add(2, 3), 5);
+    BOOST_CHECK_EQUAL(calculator->Mul(1.5, 4), 6.0);
+    BOOST_CHECK_EQUAL(calculator->Concat("ab", "cd"), "abcd");
+    BOOST_CHECK_EQUAL(calculator->GetName(), "Calculator");
+    BOOST_CHECK_THROW(calculator->Fail(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(CallMethodsAsync, T, Serializations)
+{
+    Connection<T> connection;
+    auto service = connection.GetClient().template CreateService<Test::ICalculator>(CalculatorId);
+    BOOST_REQUIRE(service);
+
+    using Proxy = typename Test::Meta::ICalculator_PS<T>::Proxy;
+    auto &calculator = dynamic_cast<Proxy &>(*service);
+
+    BOOST_CHECK_EQUAL(calculator.AddAsync(20, 22).get(), 42);
+    BOOST_CHECK_THROW(calculator.FailAsync().get(), std::exception);
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(PassInterfaces, T, Serializations)
+{
+    Connection<T> connection;
+    auto calculator = connection.GetClient().template CreateService<Test::ICalculator>(CalculatorId);
+    BOOST_REQUIRE(calculator);
+
+    auto owner = calculator->GetOwner();
+    BOOST_REQUIRE(owner);
+    BOOST_CHECK_EQUAL(owner->GetName(), "Owner");
+
+    BOOST_CHECK_EQUAL(calculator->GetNameOf(Mif::Service::Make<Human, Test::IHuman>("Guest")), "Guest");
+    BOOST_CHECK_EQUAL(calculator->GetNameOf({}), "");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(QueryBaseInterface, T, Serializations)
+{
+    Connection<T> connection;
+    auto calculator = connection.GetClient().template CreateService<Test::ICalculator>(CalculatorId);
+    BOOST_REQUIRE(calculator);
+
+    auto human = Mif::Service::Query<Test::IHuman>(calculator);
+    BOOST_REQUIRE(human);
+    BOOST_CHECK_EQUAL(human->GetName(), "Calculator");
+}
+
+BOOST_AUTO_TEST_CASE_TEMPLATE(UnknownMethod, T, Serializations)
+{
+    using Client = Mif::Remote::PSClient<T>;
+    using ObjectManagerPS = Mif::Remote::Detail::Meta::IObjectManager_PS<T>;
+
+    auto recorder = std::make_shared<Recorder>();
+    auto client = std::make_shared<Client>(recorder, recorder, std::chrono::seconds{10});
+
+    // The object manager of a client always has the instance id 1.
+    Mif::Remote::RequestId const requestId = 42;
+    Mif::Remote::InstanceId const instanceId = 1;
+    Mif::Remote::MethodId const methodId = Mif::Common::Crc32("NoSuchMethod");
+    typename T::Serializer request(true, requestId, instanceId, ObjectManagerPS::InterfaceId, methodId);
+    client->OnData(request.GetBuffer());
+
+    auto const data = recorder->GetData();
+    BOOST_REQUIRE(!data.empty());
+
+    typename T::Deserializer response(data);
+    BOOST_CHECK(response.IsResponse());
+    BOOST_CHECK_EQUAL(response.GetRequestId(), requestId);
+    BOOST_CHECK_EQUAL(response.GetInstance(), instanceId);
+    BOOST_CHECK_EQUAL(response.GetInterface(), static_cast<Mif::Remote::InterfaceId>(ObjectManagerPS::InterfaceId));
+    BOOST_CHECK_EQUAL(response.GetMethod(), methodId);
+    BOOST_CHECK(response.HasException());
+}
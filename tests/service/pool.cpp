@@ -0,0 +1,276 @@
+//-------------------------------------------------------------------
+//  MetaInfo Framework (MIF)
+//  https://github.com/tdv/mif
+//  Created:     10.2026
+//  Copyright (C) 2016-2018 tdv
+//-------------------------------------------------------------------
+
+// STD
+#include <atomic>
+#include <chrono>
+#include <future>
+#include <memory>
+#include <mutex>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+// BOOST
+#define BOOST_TEST_MODULE Mif.Service.Pool
+#include <boost/test/included/unit_test.hpp>
+
+// MIF
+#include "mif/service/create.h"
+#include "mif/service/icheckable.h"
+#include "mif/service/ifactory.h"
+#include "mif/service/id/service.h"
+#include "mif/service/ipool.h"
+#include "mif/service/make.h"
+
+namespace
+{
+
+    enum : Mif::Service::ServiceId
+    {
+        ObjectId = 1
+    };
+
+    struct IObject
+        : public Mif::Service::Inherit<Mif::Service::IService>
+    {
+        virtual int GetNumber() const = 0;
+    };
+
+    class Object
+        : public Mif::Service::Inherit<IObject, Mif::Service::ICheckable>
+    {
+    public:
+        Object(int number, std::shared_ptr<std::atomic<bool>> isGood)
+            : m_number{number}
+            , m_isGood{isGood}
+        {
+        }
+
+    private:
+        int m_number;
+        std::shared_ptr<std::atomic<bool>> m_isGood;
+
+        // IObject
+        virtual int GetNumber() const override final
+        {
+            return m_number;
+        }
+
+        // ICheckable
+        virtual bool IsGood() const override final
+        {
+            return *m_isGood;
+        }
+    };
+
+    // Numbers the objects in the order of their creation. The creation can be delayed and failed on demand.
+    class Factory
+        : public Mif::Service::Inherit<Mif::Service::IFactory>
+    {
+    public:
+        std::shared_ptr<std::atomic<bool>> isGood = std::make_shared<std::atomic<bool>>(true);
+        std::atomic<int> failures{0};
+        std::chrono::milliseconds delay{0};
+
+    private:
+        std::atomic<int> m_created{0};
+
+        // IFactory
+        virtual Mif::Service::IServicePtr Create(Mif::Service::ServiceId id) override final
+        {
+            BOOST_REQUIRE_EQUAL(id, static_cast<Mif::Service::ServiceId>(ObjectId));
+
+            std::this_thread::sleep_for(delay);
+
+            if (failures > 0)
+            {
+                --failures;
+                throw std::runtime_error{"Failed on purpose."};
+            }
+
+            return Mif::Service::Make<Object, Mif::Service::IService>(++m_created, isGood);
+        }
+    };
+
+    using FactoryPtr = Mif::Service::TServicePtr<Factory>;
+
+    Mif::Service::PoolParams MakeParams(std::uint32_t limit, std::chrono::milliseconds waitTimeout)
+    {
+        Mif::Service::PoolParams params;
+        params.limit = limit;
+        params.waitTimeout = waitTimeout;
+        params.validateAfter = std::chrono::milliseconds{0};
+        return params;
+    }
+
+    Mif::Service::IPoolPtr CreatePool(Mif::Service::PoolParams const &params, FactoryPtr factory)
+    {
+        return Mif::Service::Create<Mif::Service::Id::Pool, Mif::Service::IPool>(
+                Mif::Service::PoolParams{params},
+                Mif::Service::IFactoryPtr{factory},
+                Mif::Service::ServiceId{ObjectId}
+            );
+    }
+
+    Mif::Service::PoolCounters GetCounters(Mif::Service::IPoolPtr pool)
+    {
+        return Mif::Service::Cast<Mif::Service::IPoolMetrics>(pool)->GetCounters();
+    }
+
+    int GetNumber(Mif::Service::IServicePtr service)
+    {
+        return Mif::Service::Cast<IObject>(service)->GetNumber();
+    }
+
+    // The waiters have no other sign of being queued, so a while is given to them.
+    void LetWait()
+    {
+        std::this_thread::sleep_for(std::chrono::milliseconds{200});
+    }
+
+}   // namespace
+
+BOOST_AUTO_TEST_CASE(FailsAtOnceByDefault)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    Mif::Service::PoolParams params;
+    params.limit = 1;
+    auto pool = CreatePool(params, factory);
+
+    auto service = pool->GetService();
+
+    auto const start = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW(pool->GetService(), std::exception);
+    BOOST_CHECK(std::chrono::steady_clock::now() - start < std::chrono::seconds{1});
+
+    service.reset();
+    BOOST_CHECK_EQUAL(GetNumber(pool->GetService()), 1);
+}
+
+BOOST_AUTO_TEST_CASE(WaitersAreServedInOrder)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    auto pool = CreatePool(MakeParams(1, std::chrono::seconds{10}), factory);
+
+    auto service = pool->GetService();
+
+    std::mutex lock;
+    std::vector<int> order;
+
+    auto wait = [&] (int id)
+        {
+            auto item = pool->GetService();
+            std::lock_guard<std::mutex> guard{lock};
+            order.push_back(id);
+            return GetNumber(item);
+        };
+
+    auto first = std::async(std::launch::async, wait, 1);
+    LetWait();
+    auto second = std::async(std::launch::async, wait, 2);
+    LetWait();
+
+    service.reset();
+
+    // The same object is handed over from the first waiter to the second one.
+    BOOST_CHECK_EQUAL(first.get(), 1);
+    BOOST_CHECK_EQUAL(second.get(), 1);
+    BOOST_REQUIRE_EQUAL(order.size(), 2u);
+    BOOST_CHECK_EQUAL(order[0], 1);
+    BOOST_CHECK_EQUAL(order[1], 2);
+
+    auto const counters = GetCounters(pool);
+    BOOST_CHECK_EQUAL(counters.waits, 2u);
+    BOOST_CHECK_EQUAL(counters.created, 1u);
+    BOOST_CHECK_EQUAL(counters.timeouts, 0u);
+}
+
+BOOST_AUTO_TEST_CASE(WaitTimesOut)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    auto pool = CreatePool(MakeParams(1, std::chrono::milliseconds{100}), factory);
+
+    auto service = pool->GetService();
+
+    auto const start = std::chrono::steady_clock::now();
+    BOOST_CHECK_THROW(pool->GetService(), std::exception);
+    BOOST_CHECK(std::chrono::steady_clock::now() - start >= std::chrono::milliseconds{100});
+
+    auto const counters = GetCounters(pool);
+    BOOST_CHECK_EQUAL(counters.timeouts, 1u);
+    BOOST_CHECK_EQUAL(counters.size, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(FailedCreateHandsSlotToWaiter)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    factory->failures = 1;
+    factory->delay = std::chrono::milliseconds{400};
+    auto pool = CreatePool(MakeParams(1, std::chrono::seconds{10}), factory);
+
+    auto failed = std::async(std::launch::async, [&pool] { return pool->GetService(); });
+    LetWait();
+    auto waiter = std::async(std::launch::async, [&pool] { return pool->GetService(); });
+
+    BOOST_CHECK_THROW(failed.get(), std::exception);
+    auto service = waiter.get();
+    BOOST_REQUIRE(service);
+    BOOST_CHECK_EQUAL(GetNumber(service), 1);
+
+    auto const counters = GetCounters(pool);
+    BOOST_CHECK_EQUAL(counters.size, 1u);
+    BOOST_CHECK_EQUAL(counters.waits, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(EvictedSlotIsReplaced)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    auto params = MakeParams(1, std::chrono::milliseconds{0});
+    params.validateAfter = std::chrono::milliseconds{1};
+    auto pool = CreatePool(params, factory);
+
+    pool->GetService();
+    std::this_thread::sleep_for(std::chrono::milliseconds{10});
+
+    // The checked object is bad, so its slot is used for a new one by the same call.
+    *factory->isGood = false;
+    auto service = pool->GetService();
+    *factory->isGood = true;
+    BOOST_CHECK_EQUAL(GetNumber(service), 2);
+
+    auto const counters = GetCounters(pool);
+    BOOST_CHECK_EQUAL(counters.evictions, 1u);
+    BOOST_CHECK_EQUAL(counters.created, 2u);
+    BOOST_CHECK_EQUAL(counters.size, 1u);
+}
+
+BOOST_AUTO_TEST_CASE(IdleObjectsAreEvicted)
+{
+    auto factory = Mif::Service::Make<Factory, Factory>();
+    auto params = MakeParams(4, std::chrono::milliseconds{0});
+    params.minSize = 1;
+    params.checkInterval = std::chrono::milliseconds{50};
+    params.idleTimeout = std::chrono::milliseconds{50};
+    auto pool = CreatePool(params, factory);
+
+    {
+        auto first = pool->GetService();
+        auto second = pool->GetService();
+        auto third = pool->GetService();
+    }
+
+    BOOST_CHECK_EQUAL(GetCounters(pool).idle, 3u);
+
+    std::this_thread::sleep_for(std::chrono::milliseconds{500});
+
+    // The objects above the min size are released.
+    auto const counters = GetCounters(pool);
+    BOOST_CHECK_EQUAL(counters.size, 1u);
+    BOOST_CHECK_EQUAL(counters.idle, 1u);
+    BOOST_CHECK_EQUAL(counters.evictions, 2u);
+}